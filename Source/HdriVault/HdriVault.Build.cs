@@ -1,5 +1,6 @@
 // Copyright Pyre Labs. All Rights Reserved.
 
+using System.IO;
 using UnrealBuildTool;
 
 public class HdriVault : ModuleRules
@@ -77,5 +78,29 @@ public class HdriVault : ModuleRules
 				// ... add any modules that your module loads dynamically here ...
 			}
 			);
+
+		// Inflater for ZIP-compressed EXRs: "zlib" links the engine's copy, "libdeflate" a build placed in
+		// Source/ThirdParty/libdeflate (include/ and lib/<Platform>/), "miniz" keeps the one bundled with tinyexr
+		string ExrInflateBackend = "zlib";
+
+		if (ExrInflateBackend == "libdeflate")
+		{
+			string LibDeflateDir = Path.Combine(ModuleDirectory, "..", "ThirdParty", "libdeflate");
+			string LibraryName = Target.Platform == UnrealTargetPlatform.Win64 ? "libdeflatestatic.lib" : "libdeflate.a";
+			string LibraryPath = Path.Combine(LibDeflateDir, "lib", Target.Platform.ToString(), LibraryName);
+			if (!File.Exists(LibraryPath))
+			{
+				throw new BuildException("HdriVault: libdeflate was selected for EXR inflate but {0} does not exist", LibraryPath);
+			}
+
+			PrivateIncludePaths.Add(Path.Combine(LibDeflateDir, "include"));
+			PublicAdditionalLibraries.Add(LibraryPath);
+			PrivateDefinitions.Add("HDRIVAULT_INFLATE_LIBDEFLATE=1");
+		}
+		else if (ExrInflateBackend == "zlib")
+		{
+			AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
+			PrivateDefinitions.Add("HDRIVAULT_INFLATE_ZLIB=1");
+		}
 	}
 }
@@ -15,6 +15,8 @@
 
 const FName FHdriVaultModule::HdriVaultTabName("HdriVault");
 
+DEFINE_LOG_CATEGORY(LogHdriVault);
+
 #define LOCTEXT_NAMESPACE "FHdriVaultModule"
 
 void FHdriVaultModule::StartupModule()
@@ -110,6 +112,12 @@ TSharedRef<SDockTab> FHdriVaultModule::OnSpawnHdriVaultTab(const FSpawnTabArgs&
 
 void FHdriVaultModule::OnHdriVaultTabClosed(TSharedRef<SDockTab> Tab)
 {
+	// Work queued for the closed view would only hitch the editor for nothing; imports keep running
+	if (HdriVaultManager)
+	{
+		HdriVaultManager->CancelQueuedWork();
+	}
+	
 	HdriVaultWidget.Reset();
 	bIsTabOpen = false;
 }
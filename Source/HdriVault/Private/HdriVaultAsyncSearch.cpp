@@ -0,0 +1,179 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultAsyncSearch.h"
+#include "HdriVaultCatalogSnapshot.h"
+#include "HdriVaultQuery.h"
+#include "HdriVaultWorkScheduler.h"
+#include "HdriVaultWorkerPool.h"
+#include "Async/Async.h"
+
+namespace HdriVaultAsyncSearchUtils
+{
+	// Candidates evaluated between cancellation checks and result hand-offs
+	static constexpr int32 BatchSize = 2048;
+
+	// Results are interactive work; without a scheduler they go straight to the game thread
+	static void PostToGameThread(const TWeakPtr<FHdriVaultWorkScheduler>& WorkScheduler, TUniqueFunction<void()>&& Work)
+	{
+		if (TSharedPtr<FHdriVaultWorkScheduler> PinnedWorkScheduler = WorkScheduler.Pin())
+		{
+			PinnedWorkScheduler->Enqueue(EHdriVaultWorkPriority::Interactive, MoveTemp(Work));
+		}
+		else
+		{
+			AsyncTask(ENamedThreads::GameThread, MoveTemp(Work));
+		}
+	}
+}
+
+FHdriVaultAsyncSearch::~FHdriVaultAsyncSearch()
+{
+	Cancel();
+}
+
+void FHdriVaultAsyncSearch::Start(const FString& QueryText, TSharedPtr<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> Snapshot,
+	TArray<FHdriVaultItemHandle>&& Candidates, uint64 CandidateSetId,
+	TFunctionRef<bool(TArray<FHdriVaultItemHandle>&)> SeedCandidates)
+{
+	check(IsInGameThread());
+
+	Cancel();
+
+	if (!Snapshot.IsValid())
+	{
+		return;
+	}
+
+	// Narrow from the previous results when they are complete and still describe the same items
+	TArray<int32> Scope;
+	const bool bNarrow = bLastCompleted
+		&& CandidateSetId == LastCandidateSetId
+		&& Snapshot->GetVersion() == LastSnapshotVersion
+		&& FHdriVaultQuery::IsRefinementOf(LastQueryText, QueryText);
+	TArray<FHdriVaultItemHandle> Seed;
+	bool bSeeded = false;
+	if (bNarrow)
+	{
+		Scope = MoveTemp(LastResults);
+	}
+	else
+	{
+		// Index lookups are cheap; mapping the seed onto candidate indices is left to the worker
+		bSeeded = SeedCandidates(Seed);
+	}
+
+	LastQueryText = QueryText;
+	LastSnapshotVersion = Snapshot->GetVersion();
+	LastCandidateSetId = CandidateSetId;
+	LastResults.Reset();
+	bLastCompleted = false;
+
+	CurrentRun = MakeShared<FRun, ESPMode::ThreadSafe>();
+	CurrentRun->Generation = ++Generation;
+	bRunning = true;
+
+	TWeakPtr<FHdriVaultAsyncSearch, ESPMode::ThreadSafe> WeakThis = AsShared();
+	TUniqueFunction<void()> Work = [WeakThis, WeakWorkScheduler = WorkScheduler, Run = CurrentRun, Query = FHdriVaultQuery::Parse(QueryText), Snapshot, Candidates = MoveTemp(Candidates), Scope = MoveTemp(Scope), Seed = MoveTemp(Seed), bNarrow, bSeeded]() mutable
+	{
+		if (bSeeded)
+		{
+			const TSet<FHdriVaultItemHandle> SeedSet(MoveTemp(Seed));
+			Scope.Reserve(FMath::Min(SeedSet.Num(), Candidates.Num()));
+			for (int32 CandidateIndex = 0; CandidateIndex < Candidates.Num(); ++CandidateIndex)
+			{
+				if (SeedSet.Contains(Candidates[CandidateIndex]))
+				{
+					Scope.Add(CandidateIndex);
+				}
+			}
+		}
+
+		const bool bScoped = bNarrow || bSeeded;
+		const int32 NumToVisit = bScoped ? Scope.Num() : Candidates.Num();
+		TArray<int32> Matches;
+
+		for (int32 Visit = 0; Visit < NumToVisit; ++Visit)
+		{
+			const int32 CandidateIndex = bScoped ? Scope[Visit] : Visit;
+			const FHdriVaultSnapshotEntry* Entry = Snapshot->Find(Candidates[CandidateIndex]);
+			if (Entry && Query.Matches(*Entry))
+			{
+				Matches.Add(CandidateIndex);
+			}
+
+			const bool bBatchEnd = (Visit + 1) % HdriVaultAsyncSearchUtils::BatchSize == 0;
+			if (bBatchEnd || Visit + 1 == NumToVisit)
+			{
+				if (Run->bCancelled.load(std::memory_order_relaxed))
+				{
+					return;
+				}
+
+				if (Matches.Num() > 0)
+				{
+					HdriVaultAsyncSearchUtils::PostToGameThread(WeakWorkScheduler, [WeakThis, RunGeneration = Run->Generation, Batch = MoveTemp(Matches)]() mutable
+					{
+						if (TSharedPtr<FHdriVaultAsyncSearch, ESPMode::ThreadSafe> This = WeakThis.Pin())
+						{
+							This->HandleResults(RunGeneration, MoveTemp(Batch));
+						}
+					});
+					Matches.Reset();
+				}
+			}
+		}
+
+		HdriVaultAsyncSearchUtils::PostToGameThread(WeakWorkScheduler, [WeakThis, RunGeneration = Run->Generation]()
+		{
+			if (TSharedPtr<FHdriVaultAsyncSearch, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				This->HandleFinished(RunGeneration);
+			}
+		});
+	};
+
+	// The user is waiting on this, so it goes ahead of any bulk vault work
+	if (TSharedPtr<FHdriVaultWorkerPool> PinnedWorkerPool = WorkerPool.Pin())
+	{
+		PinnedWorkerPool->Launch(EHdriVaultWorkerPriority::Interactive, MoveTemp(Work));
+	}
+	else
+	{
+		Async(EAsyncExecution::ThreadPool, MoveTemp(Work));
+	}
+}
+
+void FHdriVaultAsyncSearch::Cancel()
+{
+	if (CurrentRun.IsValid())
+	{
+		CurrentRun->bCancelled = true;
+		CurrentRun.Reset();
+	}
+	bRunning = false;
+}
+
+void FHdriVaultAsyncSearch::HandleResults(uint32 RunGeneration, TArray<int32>&& Matches)
+{
+	// Batches from a cancelled search may still be queued behind the new one
+	if (RunGeneration != Generation || !bRunning)
+	{
+		return;
+	}
+
+	LastResults.Append(Matches);
+	OnResults.ExecuteIfBound(Matches);
+}
+
+void FHdriVaultAsyncSearch::HandleFinished(uint32 RunGeneration)
+{
+	if (RunGeneration != Generation || !bRunning)
+	{
+		return;
+	}
+
+	CurrentRun.Reset();
+	bRunning = false;
+	bLastCompleted = true;
+	OnFinished.ExecuteIfBound();
+}
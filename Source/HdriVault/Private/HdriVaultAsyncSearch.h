@@ -0,0 +1,71 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HdriVaultTypes.h"
+#include <atomic>
+
+class FHdriVaultCatalogSnapshot;
+class FHdriVaultWorkScheduler;
+class FHdriVaultWorkerPool;
+
+/**
+ * Runs vault queries against a catalog snapshot on a worker thread.
+ *
+ * Starting a search cancels the one in flight. Matches are streamed back to the game thread in
+ * batches as indices into the candidate list, in candidate order. When a query only narrows the
+ * previous one, it is evaluated against the previous results; otherwise candidates outside the
+ * index-backed seed are skipped before the snapshot is read.
+ */
+class FHdriVaultAsyncSearch : public TSharedFromThis<FHdriVaultAsyncSearch>
+{
+public:
+	DECLARE_DELEGATE_OneParam(FOnResults, TConstArrayView<int32>);
+	DECLARE_DELEGATE(FOnFinished);
+
+	~FHdriVaultAsyncSearch();
+
+	// Game thread only. CandidateSetId must change whenever the caller's candidate list does, so narrowing
+	// only reuses results from the same list and snapshot version. SeedCandidates is called when the search
+	// cannot narrow; it fills a superset of the matches and returns true, or returns false to check every candidate.
+	void Start(const FString& QueryText, TSharedPtr<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> Snapshot,
+		TArray<FHdriVaultItemHandle>&& Candidates, uint64 CandidateSetId,
+		TFunctionRef<bool(TArray<FHdriVaultItemHandle>&)> SeedCandidates);
+	void Cancel();
+
+	bool IsRunning() const { return bRunning; }
+
+	// Result batches are delivered as interactive work on this scheduler when set
+	void SetWorkScheduler(const TSharedPtr<FHdriVaultWorkScheduler>& InWorkScheduler) { WorkScheduler = InWorkScheduler; }
+
+	// Searches run as interactive work on this pool when set
+	void SetWorkerPool(const TSharedPtr<FHdriVaultWorkerPool>& InWorkerPool) { WorkerPool = InWorkerPool; }
+
+	// Fired on the game thread for each batch of matches, then once when the search completes
+	FOnResults OnResults;
+	FOnFinished OnFinished;
+
+private:
+	struct FRun
+	{
+		uint32 Generation = 0;
+		std::atomic<bool> bCancelled { false };
+	};
+
+	void HandleResults(uint32 Generation, TArray<int32>&& Matches);
+	void HandleFinished(uint32 Generation);
+
+	TWeakPtr<FHdriVaultWorkScheduler> WorkScheduler;
+	TWeakPtr<FHdriVaultWorkerPool> WorkerPool;
+	TSharedPtr<FRun, ESPMode::ThreadSafe> CurrentRun;
+	uint32 Generation = 0;
+	bool bRunning = false;
+
+	// Last search, kept so a refinement can narrow from its results
+	FString LastQueryText;
+	uint64 LastSnapshotVersion = 0;
+	uint64 LastCandidateSetId = 0;
+	TArray<int32> LastResults;
+	bool bLastCompleted = false;
+};
@@ -0,0 +1,558 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultCatalog.h"
+#include "Algo/BinarySearch.h"
+
+FHdriVaultCatalog::~FHdriVaultCatalog()
+{
+	Reset();
+}
+
+void FHdriVaultCatalog::Reset()
+{
+	// Items can outlive the catalog in widgets; make sure their handles never resolve into another catalog
+	for (const TSharedPtr<FHdriVaultMaterialItem>& Item : Items)
+	{
+		if (Item.IsValid())
+		{
+			Item->Handle = FHdriVaultItemHandle();
+		}
+	}
+
+	Generations.Empty();
+	Occupied.Empty();
+	FreeSlots.Empty();
+	NumItems = 0;
+
+	Items.Empty();
+	ObjectPaths.Empty();
+	AssetNames.Empty();
+	PackagePaths.Empty();
+	MaxDimensions.Empty();
+	RegistryDimensions.Empty();
+	TagBits.Empty();
+	PackageStamps.Empty();
+	MetadataFileTimes.Empty();
+	NameKeys.Empty();
+	ModifiedTimes.Empty();
+	ResourceSizes.Empty();
+	ClassNames.Empty();
+	CategoryKeys.Empty();
+
+	SortOrder = FSortOrder();
+	SortOrderIndex = INDEX_NONE;
+
+	SnapshotChunks.Empty();
+	SnapshotDirty.Empty();
+
+	PathLookup.Empty();
+	TagBitIndices.Empty();
+	TagNames.Empty();
+	TagUseCounts.Empty();
+	FreeTagBits.Empty();
+}
+
+void FHdriVaultCatalog::Reserve(int32 InNumItems)
+{
+	Generations.Reserve(InNumItems);
+	Occupied.Reserve(InNumItems);
+	Items.Reserve(InNumItems);
+	ObjectPaths.Reserve(InNumItems);
+	AssetNames.Reserve(InNumItems);
+	PackagePaths.Reserve(InNumItems);
+	MaxDimensions.Reserve(InNumItems);
+	RegistryDimensions.Reserve(InNumItems);
+	TagBits.Reserve(InNumItems);
+	PackageStamps.Reserve(InNumItems);
+	MetadataFileTimes.Reserve(InNumItems);
+	NameKeys.Reserve(InNumItems);
+	ModifiedTimes.Reserve(InNumItems);
+	ResourceSizes.Reserve(InNumItems);
+	ClassNames.Reserve(InNumItems);
+	CategoryKeys.Reserve(InNumItems);
+	PathLookup.Reserve(InNumItems);
+}
+
+void FHdriVaultCatalog::BeginBulkUpdate()
+{
+	bBulkUpdate = true;
+	SortOrder.bOrderDirty = true;
+}
+
+void FHdriVaultCatalog::EndBulkUpdate()
+{
+	bBulkUpdate = false;
+}
+
+FHdriVaultItemHandle FHdriVaultCatalog::Add(const TSharedPtr<FHdriVaultMaterialItem>& Item, const FAssetData& AssetData)
+{
+	check(Item.IsValid());
+
+	uint32 Index;
+	if (FreeSlots.Num() > 0)
+	{
+		Index = FreeSlots.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Index = Generations.Num();
+		check(Index <= FHdriVaultItemHandle::IndexMask);
+
+		Generations.Add(0);
+		Occupied.Add(false);
+		SnapshotDirty.Add(false);
+		Items.AddDefaulted();
+		ObjectPaths.AddDefaulted();
+		AssetNames.AddDefaulted();
+		PackagePaths.AddDefaulted();
+		MaxDimensions.AddDefaulted();
+		RegistryDimensions.AddDefaulted();
+		TagBits.AddDefaulted();
+		PackageStamps.AddDefaulted();
+		MetadataFileTimes.AddDefaulted();
+		NameKeys.AddDefaulted();
+		ModifiedTimes.AddDefaulted();
+		ResourceSizes.AddDefaulted();
+		ClassNames.AddDefaulted();
+		CategoryKeys.AddDefaulted();
+	}
+
+	// Skip generation 0 on wrap so a handle value is never zero
+	uint8& Generation = Generations[Index];
+	Generation = Generation == MAX_uint8 ? 1 : Generation + 1;
+	Occupied[Index] = true;
+	++NumItems;
+
+	const FHdriVaultItemHandle Handle(Index, Generation);
+	Item->Handle = Handle;
+	Items[Index] = Item;
+	ObjectPaths[Index] = AssetData.GetSoftObjectPath();
+	PathLookup.Add(ObjectPaths[Index], Handle);
+
+	WriteAssetColumns(Index, AssetData);
+	WriteMetadataColumns(Index);
+	InsertIntoOrders(Handle);
+	return Handle;
+}
+
+bool FHdriVaultCatalog::Remove(FHdriVaultItemHandle Handle)
+{
+	if (!IsValid(Handle))
+	{
+		return false;
+	}
+
+	const uint32 Index = Handle.GetIndex();
+	RemoveFromOrders(Handle);
+	PathLookup.Remove(ObjectPaths[Index]);
+
+	Items[Index]->Handle = FHdriVaultItemHandle();
+	Items[Index].Reset();
+	ObjectPaths[Index].Reset();
+	AssetNames[Index] = NAME_None;
+	PackagePaths[Index] = NAME_None;
+	MaxDimensions[Index] = 0;
+	RegistryDimensions[Index] = 0;
+	ReleaseTagBits(Index);
+	PackageStamps[Index] = FIoHash();
+	MetadataFileTimes[Index] = FDateTime::MinValue();
+	NameKeys[Index].Empty();
+	CategoryKeys[Index].Empty();
+	ClassNames[Index] = NAME_None;
+
+	Occupied[Index] = false;
+	SnapshotDirty[Index] = true;
+	FreeSlots.Add(Index);
+	--NumItems;
+	return true;
+}
+
+void FHdriVaultCatalog::UpdateColumns(FHdriVaultItemHandle Handle)
+{
+	if (!IsValid(Handle))
+	{
+		return;
+	}
+
+	// Orders are located by the old keys, so leave them before the columns change
+	RemoveFromOrders(Handle);
+	WriteMetadataColumns(Handle.GetIndex());
+	InsertIntoOrders(Handle);
+}
+
+void FHdriVaultCatalog::UpdateAssetColumns(FHdriVaultItemHandle Handle, const FAssetData& AssetData)
+{
+	if (!IsValid(Handle) || AssetData.GetSoftObjectPath() != ObjectPaths[Handle.GetIndex()])
+	{
+		return;
+	}
+
+	RemoveFromOrders(Handle);
+	WriteAssetColumns(Handle.GetIndex(), AssetData);
+	WriteMetadataColumns(Handle.GetIndex());
+	InsertIntoOrders(Handle);
+}
+
+void FHdriVaultCatalog::WriteAssetColumns(uint32 Index, const FAssetData& AssetData)
+{
+	SnapshotDirty[Index] = true;
+
+	AssetNames[Index] = AssetData.AssetName;
+	PackagePaths[Index] = AssetData.PackagePath;
+	ClassNames[Index] = AssetData.AssetClassPath.GetAssetName();
+	RegistryDimensions[Index] = EstimateSourceResolution(AssetData);
+
+	int64 ResourceSize = 0;
+	AssetData.GetTagValue(TEXT("ResourceSize"), ResourceSize);
+	ResourceSizes[Index] = ResourceSize;
+}
+
+void FHdriVaultCatalog::WriteMetadataColumns(uint32 Index)
+{
+	const FHdriVaultMetadata& Metadata = Items[Index]->Metadata;
+	SnapshotDirty[Index] = true;
+
+	// Recorded at import, so this is the long-lat width users mean by 8k
+	MaxDimensions[Index] = Metadata.SourceWidth > 0 ? FMath::Max(Metadata.SourceWidth, Metadata.SourceHeight) : RegistryDimensions[Index];
+	ModifiedTimes[Index] = Metadata.LastModified;
+	NameKeys[Index] = Items[Index]->GetDisplayName().ToLower();
+	CategoryKeys[Index] = Metadata.Category.ToLower();
+
+	// Take the new tags before dropping the old ones so unchanged tags keep their bits
+	TBitArray<> Bits;
+	for (const FString& Tag : Metadata.Tags)
+	{
+		if (Tag.IsEmpty())
+		{
+			continue;
+		}
+
+		const int32 TagBit = GetOrAddTagBit(Tag);
+		if (Bits.Num() <= TagBit)
+		{
+			Bits.Add(false, TagBit + 1 - Bits.Num());
+		}
+		if (!Bits[TagBit])
+		{
+			Bits[TagBit] = true;
+			++TagUseCounts[TagBit];
+		}
+	}
+
+	ReleaseTagBits(Index);
+	TagBits[Index] = MoveTemp(Bits);
+}
+
+bool FHdriVaultCatalog::IsValid(FHdriVaultItemHandle Handle) const
+{
+	const uint32 Index = Handle.GetIndex();
+	return Handle.IsValid()
+		&& Generations.IsValidIndex(Index)
+		&& Occupied[Index]
+		&& Generations[Index] == Handle.GetGeneration();
+}
+
+FHdriVaultItemHandle FHdriVaultCatalog::Find(const FSoftObjectPath& ObjectPath) const
+{
+	const FHdriVaultItemHandle* Handle = PathLookup.Find(ObjectPath);
+	return Handle ? *Handle : FHdriVaultItemHandle();
+}
+
+void FHdriVaultCatalog::GetHandles(TArray<FHdriVaultItemHandle>& OutHandles) const
+{
+	OutHandles.Reserve(OutHandles.Num() + NumItems);
+	ForEach([&OutHandles](FHdriVaultItemHandle Handle)
+	{
+		OutHandles.Add(Handle);
+	});
+}
+
+int32 FHdriVaultCatalog::FindTagBit(const FString& Tag) const
+{
+	const int32* TagBit = TagBitIndices.Find(Tag);
+	return TagBit ? *TagBit : INDEX_NONE;
+}
+
+bool FHdriVaultCatalog::HasTag(FHdriVaultItemHandle Handle, int32 TagBit) const
+{
+	const TBitArray<>& Bits = TagBits[Handle.GetIndex()];
+	return TagBit >= 0 && TagBit < Bits.Num() && Bits[TagBit];
+}
+
+void FHdriVaultCatalog::GetTags(FHdriVaultItemHandle Handle, TArray<FString>& OutTags) const
+{
+	if (!IsValid(Handle))
+	{
+		return;
+	}
+
+	for (TConstSetBitIterator<> It(TagBits[Handle.GetIndex()]); It; ++It)
+	{
+		OutTags.Add(TagNames[It.GetIndex()]);
+	}
+}
+
+const TArray<FHdriVaultItemHandle>& FHdriVaultCatalog::GetSortedHandles(EHdriVaultSortMode Primary, EHdriVaultSortMode Secondary) const
+{
+	return EnsureOrder(Primary, Secondary).Handles;
+}
+
+void FHdriVaultCatalog::SortHandles(TArray<FHdriVaultItemHandle>& Handles, EHdriVaultSortMode Primary, EHdriVaultSortMode Secondary) const
+{
+	if (Handles.Num() < 2)
+	{
+		return;
+	}
+
+	const FSortOrder& Order = EnsureOrder(Primary, Secondary);
+
+	// A handful of handles is cheaper to sort than walking every item
+	if (int64(Handles.Num()) * FMath::CeilLogTwo(Handles.Num()) < Order.Handles.Num())
+	{
+		Handles.Sort([this](FHdriVaultItemHandle A, FHdriVaultItemHandle B)
+		{
+			return OrderLess(SortOrderIndex, A, B);
+		});
+		return;
+	}
+
+	// Otherwise keep the maintained order, filtered down to the requested slots
+	TBitArray<> Selected(false, Generations.Num());
+	for (FHdriVaultItemHandle Handle : Handles)
+	{
+		Selected[Handle.GetIndex()] = true;
+	}
+
+	Handles.Reset();
+	for (FHdriVaultItemHandle Handle : Order.Handles)
+	{
+		if (Selected[Handle.GetIndex()])
+		{
+			Handles.Add(Handle);
+		}
+	}
+}
+
+TSharedRef<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> FHdriVaultCatalog::BuildSnapshot(uint64 Version)
+{
+	constexpr uint32 ChunkMask = FHdriVaultCatalogSnapshot::ChunkSize - 1;
+
+	SnapshotChunks.SetNum((Generations.Num() + ChunkMask) >> FHdriVaultCatalogSnapshot::ChunkBits);
+
+	// Dirty slots come in ascending order, so each touched chunk is copied exactly once
+	int32 WorkingChunkIndex = INDEX_NONE;
+	FHdriVaultCatalogSnapshot::FChunk WorkingChunk;
+	auto CommitWorkingChunk = [this, &WorkingChunkIndex, &WorkingChunk]()
+	{
+		if (WorkingChunkIndex != INDEX_NONE)
+		{
+			SnapshotChunks[WorkingChunkIndex] = MakeShared<FHdriVaultCatalogSnapshot::FChunk, ESPMode::ThreadSafe>(MoveTemp(WorkingChunk));
+			WorkingChunk.Reset();
+		}
+	};
+
+	for (TConstSetBitIterator<> It(SnapshotDirty); It; ++It)
+	{
+		const uint32 Index = It.GetIndex();
+		const int32 ChunkIndex = Index >> FHdriVaultCatalogSnapshot::ChunkBits;
+		if (ChunkIndex != WorkingChunkIndex)
+		{
+			CommitWorkingChunk();
+			WorkingChunkIndex = ChunkIndex;
+
+			if (SnapshotChunks[ChunkIndex].IsValid())
+			{
+				WorkingChunk = *SnapshotChunks[ChunkIndex];
+			}
+			else
+			{
+				WorkingChunk.SetNum(FHdriVaultCatalogSnapshot::ChunkSize);
+			}
+		}
+
+		WorkingChunk[Index & ChunkMask] = Occupied[Index] ? MakeSnapshotEntry(Index) : nullptr;
+	}
+	CommitWorkingChunk();
+
+	SnapshotDirty.Init(false, Generations.Num());
+	return MakeShared<FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe>(Version, SnapshotChunks, NumItems);
+}
+
+FHdriVaultCatalogSnapshot::FEntryPtr FHdriVaultCatalog::MakeSnapshotEntry(uint32 Index) const
+{
+	const FHdriVaultMaterialItem& Item = *Items[Index];
+
+	TSharedRef<FHdriVaultSnapshotEntry, ESPMode::ThreadSafe> Entry = MakeShared<FHdriVaultSnapshotEntry, ESPMode::ThreadSafe>();
+	Entry->Handle = FHdriVaultItemHandle(Index, Generations[Index]);
+	Entry->ObjectPath = ObjectPaths[Index];
+	Entry->PackagePath = PackagePaths[Index];
+	Entry->DisplayName = Item.GetDisplayName();
+	Entry->Author = Item.Metadata.Author;
+	Entry->Category = Item.Metadata.Category;
+	Entry->Notes = Item.Metadata.Notes;
+	Entry->Tags = Item.Metadata.Tags;
+	Entry->LastModified = ModifiedTimes[Index];
+	Entry->ResourceSize = ResourceSizes[Index];
+	Entry->MaxDimension = MaxDimensions[Index];
+	return Entry;
+}
+
+int32 FHdriVaultCatalog::CompareKeys(EHdriVaultSortMode Mode, uint32 IndexA, uint32 IndexB) const
+{
+	switch (Mode)
+	{
+	case EHdriVaultSortMode::Name:
+		return NameKeys[IndexA].Compare(NameKeys[IndexB], ESearchCase::CaseSensitive);
+	case EHdriVaultSortMode::DateModified:
+		// Newest first
+		return ModifiedTimes[IndexA] > ModifiedTimes[IndexB] ? -1 : (ModifiedTimes[IndexA] < ModifiedTimes[IndexB] ? 1 : 0);
+	case EHdriVaultSortMode::Size:
+		// Largest first
+		return ResourceSizes[IndexA] > ResourceSizes[IndexB] ? -1 : (ResourceSizes[IndexA] < ResourceSizes[IndexB] ? 1 : 0);
+	case EHdriVaultSortMode::Type:
+		return ClassNames[IndexA].Compare(ClassNames[IndexB]);
+	case EHdriVaultSortMode::Category:
+		{
+			// Uncategorized items go last
+			const bool bEmptyA = CategoryKeys[IndexA].IsEmpty();
+			const bool bEmptyB = CategoryKeys[IndexB].IsEmpty();
+			if (bEmptyA != bEmptyB)
+			{
+				return bEmptyA ? 1 : -1;
+			}
+			return CategoryKeys[IndexA].Compare(CategoryKeys[IndexB], ESearchCase::CaseSensitive);
+		}
+	default:
+		return 0;
+	}
+}
+
+bool FHdriVaultCatalog::OrderLess(int32 OrderIndex, FHdriVaultItemHandle A, FHdriVaultItemHandle B) const
+{
+	const EHdriVaultSortMode Primary = static_cast<EHdriVaultSortMode>(OrderIndex / NumSortModes);
+	const EHdriVaultSortMode Secondary = static_cast<EHdriVaultSortMode>(OrderIndex % NumSortModes);
+
+	int32 Result = CompareKeys(Primary, A.GetIndex(), B.GetIndex());
+	if (Result == 0 && Secondary != Primary)
+	{
+		Result = CompareKeys(Secondary, A.GetIndex(), B.GetIndex());
+	}
+
+	// Slot index breaks ties so every item has exactly one position
+	return Result != 0 ? Result < 0 : A.GetIndex() < B.GetIndex();
+}
+
+void FHdriVaultCatalog::InsertIntoOrders(FHdriVaultItemHandle Handle)
+{
+	if (bBulkUpdate || SortOrder.bOrderDirty)
+	{
+		return;
+	}
+
+	FSortOrder& Order = SortOrder;
+	const int32 InsertIndex = Algo::LowerBound(Order.Handles, Handle, [this](FHdriVaultItemHandle A, FHdriVaultItemHandle B)
+	{
+		return OrderLess(SortOrderIndex, A, B);
+	});
+	Order.Handles.Insert(Handle, InsertIndex);
+}
+
+void FHdriVaultCatalog::RemoveFromOrders(FHdriVaultItemHandle Handle)
+{
+	if (bBulkUpdate || SortOrder.bOrderDirty)
+	{
+		return;
+	}
+
+	FSortOrder& Order = SortOrder;
+	const int32 FoundIndex = Algo::LowerBound(Order.Handles, Handle, [this](FHdriVaultItemHandle A, FHdriVaultItemHandle B)
+	{
+		return OrderLess(SortOrderIndex, A, B);
+	});
+	if (Order.Handles.IsValidIndex(FoundIndex) && Order.Handles[FoundIndex] == Handle)
+	{
+		Order.Handles.RemoveAt(FoundIndex, 1, EAllowShrinking::No);
+	}
+	else
+	{
+		// Keys changed behind our back; fall back to a rebuild
+		Order.bOrderDirty = true;
+	}
+}
+
+const FHdriVaultCatalog::FSortOrder& FHdriVaultCatalog::EnsureOrder(EHdriVaultSortMode Primary, EHdriVaultSortMode Secondary) const
+{
+	const int32 OrderIndex = static_cast<int32>(Primary) * NumSortModes + static_cast<int32>(Secondary);
+
+	// Only the order in use is kept current, so switching sort modes rebuilds it
+	FSortOrder& Order = SortOrder;
+	if (OrderIndex != SortOrderIndex)
+	{
+		SortOrderIndex = OrderIndex;
+		Order.bOrderDirty = true;
+	}
+
+	if (Order.bOrderDirty)
+	{
+		Order.Handles.Reset();
+		GetHandles(Order.Handles);
+		Order.Handles.Sort([this, OrderIndex](FHdriVaultItemHandle A, FHdriVaultItemHandle B)
+		{
+			return OrderLess(OrderIndex, A, B);
+		});
+		Order.bOrderDirty = false;
+	}
+	return Order;
+}
+
+int32 FHdriVaultCatalog::GetOrAddTagBit(const FString& Tag)
+{
+	if (const int32* TagBit = TagBitIndices.Find(Tag))
+	{
+		return *TagBit;
+	}
+
+	int32 TagBit;
+	if (FreeTagBits.Num() > 0)
+	{
+		FreeTagBits.HeapPop(TagBit, EAllowShrinking::No);
+		TagNames[TagBit] = Tag;
+	}
+	else
+	{
+		TagBit = TagNames.Add(Tag);
+		TagUseCounts.Add(0);
+	}
+	TagBitIndices.Add(Tag, TagBit);
+	return TagBit;
+}
+
+void FHdriVaultCatalog::ReleaseTagBits(uint32 Index)
+{
+	for (TConstSetBitIterator<> It(TagBits[Index]); It; ++It)
+	{
+		const int32 TagBit = It.GetIndex();
+		if (--TagUseCounts[TagBit] == 0)
+		{
+			TagBitIndices.Remove(TagNames[TagBit]);
+			TagNames[TagBit].Reset();
+			FreeTagBits.HeapPush(TagBit);
+		}
+	}
+	TagBits[Index].Empty();
+}
+
+int32 FHdriVaultCatalog::EstimateSourceResolution(const FAssetData& AssetData)
+{
+	// Registry tag is formatted as "WidthxHeight" and holds the size of one cube face
+	FString Dimensions;
+	FString Width;
+	FString Height;
+	if (!AssetData.GetTagValue(TEXT("Dimensions"), Dimensions) || !Dimensions.Split(TEXT("x"), &Width, &Height))
+	{
+		return 0;
+	}
+
+	// Only cubes are catalogued; long-lat imports get the largest power-of-two face at or below half the source width
+	return FMath::Max(FCString::Atoi(*Width), FCString::Atoi(*Height)) * 2;
+}
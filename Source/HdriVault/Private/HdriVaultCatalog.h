@@ -0,0 +1,148 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "IO/IoHash.h"
+#include "HdriVaultTypes.h"
+#include "HdriVaultCatalogSnapshot.h"
+
+/**
+ * Slot map holding every vault item.
+ *
+ * Items are addressed by FHdriVaultItemHandle. The fields that filtering and sorting touch
+ * are stored as parallel column arrays indexed by slot, so hot loops never dereference the items.
+ * The item pointers are kept as one more column because Slate views and the public API still hand them out.
+ */
+class FHdriVaultCatalog
+{
+public:
+	static constexpr int32 NumSortModes = static_cast<int32>(EHdriVaultSortMode::Category) + 1;
+
+	~FHdriVaultCatalog();
+
+	void Reset();
+	void Reserve(int32 NumItems);
+
+	// Suspends incremental ordering while many items change at once; orders are rebuilt on next use
+	void BeginBulkUpdate();
+	void EndBulkUpdate();
+
+	// Adds the item and assigns its handle. Registry data is only kept in the columns, never on the item.
+	FHdriVaultItemHandle Add(const TSharedPtr<FHdriVaultMaterialItem>& Item, const FAssetData& AssetData);
+	bool Remove(FHdriVaultItemHandle Handle);
+
+	// Re-reads the metadata columns from the item after its metadata changed
+	void UpdateColumns(FHdriVaultItemHandle Handle);
+
+	// Re-reads the registry columns after the asset was re-saved or re-imported
+	void UpdateAssetColumns(FHdriVaultItemHandle Handle, const FAssetData& AssetData);
+
+	bool IsValid(FHdriVaultItemHandle Handle) const;
+	FHdriVaultItemHandle Find(const FSoftObjectPath& ObjectPath) const;
+	int32 Num() const { return NumItems; }
+
+	void GetHandles(TArray<FHdriVaultItemHandle>& OutHandles) const;
+
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (TConstSetBitIterator<> It(Occupied); It; ++It)
+		{
+			Func(FHdriVaultItemHandle(It.GetIndex(), Generations[It.GetIndex()]));
+		}
+	}
+
+	// Column access; handles must be valid
+	const TSharedPtr<FHdriVaultMaterialItem>& GetItem(FHdriVaultItemHandle Handle) const { return Items[Handle.GetIndex()]; }
+	const FSoftObjectPath& GetObjectPath(FHdriVaultItemHandle Handle) const { return ObjectPaths[Handle.GetIndex()]; }
+	FName GetAssetName(FHdriVaultItemHandle Handle) const { return AssetNames[Handle.GetIndex()]; }
+	FName GetPackagePath(FHdriVaultItemHandle Handle) const { return PackagePaths[Handle.GetIndex()]; }
+	int32 GetMaxDimension(FHdriVaultItemHandle Handle) const { return MaxDimensions[Handle.GetIndex()]; }
+	const FString& GetCategoryKey(FHdriVaultItemHandle Handle) const { return CategoryKeys[Handle.GetIndex()]; }
+
+	// Saved hash of the item's package when it was last read, used to detect changes on refresh
+	const FIoHash& GetPackageStamp(FHdriVaultItemHandle Handle) const { return PackageStamps[Handle.GetIndex()]; }
+	void SetPackageStamp(FHdriVaultItemHandle Handle, const FIoHash& Stamp) { PackageStamps[Handle.GetIndex()] = Stamp; }
+
+	// Timestamp of the item's metadata file when it was last read; MinValue if there was none
+	const FDateTime& GetMetadataFileTime(FHdriVaultItemHandle Handle) const { return MetadataFileTimes[Handle.GetIndex()]; }
+	void SetMetadataFileTime(FHdriVaultItemHandle Handle, const FDateTime& FileTime) { MetadataFileTimes[Handle.GetIndex()] = FileTime; }
+
+	// Tags are interned into bit positions; each slot stores the set of bits it carries
+	int32 FindTagBit(const FString& Tag) const;
+	bool HasTag(FHdriVaultItemHandle Handle, int32 TagBit) const;
+	void GetTags(FHdriVaultItemHandle Handle, TArray<FString>& OutTags) const;
+
+	// Every item ordered by Primary, then Secondary, kept up to date as items are added, changed and removed
+	const TArray<FHdriVaultItemHandle>& GetSortedHandles(EHdriVaultSortMode Primary, EHdriVaultSortMode Secondary) const;
+
+	// Puts a subset of valid, distinct handles into the same order as GetSortedHandles
+	void SortHandles(TArray<FHdriVaultItemHandle>& Handles, EHdriVaultSortMode Primary, EHdriVaultSortMode Secondary) const;
+
+	// Builds an immutable snapshot, copying only the chunks changed since the previous one
+	TSharedRef<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> BuildSnapshot(uint64 Version);
+
+private:
+	struct FSortOrder
+	{
+		TArray<FHdriVaultItemHandle> Handles;
+		bool bOrderDirty = true;
+	};
+
+	void WriteAssetColumns(uint32 Index, const FAssetData& AssetData);
+	void WriteMetadataColumns(uint32 Index);
+	FHdriVaultCatalogSnapshot::FEntryPtr MakeSnapshotEntry(uint32 Index) const;
+	int32 CompareKeys(EHdriVaultSortMode Mode, uint32 IndexA, uint32 IndexB) const;
+	bool OrderLess(int32 OrderIndex, FHdriVaultItemHandle A, FHdriVaultItemHandle B) const;
+	void InsertIntoOrders(FHdriVaultItemHandle Handle);
+	void RemoveFromOrders(FHdriVaultItemHandle Handle);
+	const FSortOrder& EnsureOrder(EHdriVaultSortMode Primary, EHdriVaultSortMode Secondary) const;
+
+	int32 GetOrAddTagBit(const FString& Tag);
+	void ReleaseTagBits(uint32 Index);
+	static int32 EstimateSourceResolution(const FAssetData& AssetData);
+
+	// Slot bookkeeping
+	TArray<uint8> Generations;
+	TBitArray<> Occupied;
+	TArray<uint32> FreeSlots;
+	int32 NumItems = 0;
+
+	// Columns
+	TArray<TSharedPtr<FHdriVaultMaterialItem>> Items;
+	TArray<FSoftObjectPath> ObjectPaths;
+	TArray<FName> AssetNames;
+	TArray<FName> PackagePaths;
+	TArray<int32> MaxDimensions;
+	TArray<int32> RegistryDimensions; // Source size estimated from the cube face, for items imported elsewhere
+	TArray<TBitArray<>> TagBits;
+	TArray<FIoHash> PackageStamps;
+	TArray<FDateTime> MetadataFileTimes;
+
+	// Sort key columns
+	TArray<FString> NameKeys; // Lower-case display names
+	TArray<FDateTime> ModifiedTimes;
+	TArray<int64> ResourceSizes;
+	TArray<FName> ClassNames;
+	TArray<FString> CategoryKeys; // Lower-case
+
+	TMap<FSoftObjectPath, FHdriVaultItemHandle> PathLookup;
+
+	// Tag dictionary (case-insensitive, like the rest of the tag handling). Bits no slot carries any more
+	// are freed and handed out again lowest first, so slot bit arrays stay as wide as the live tags.
+	TMap<FString, int32> TagBitIndices;
+	TArray<FString> TagNames;
+	TArray<int32> TagUseCounts;
+	TArray<int32> FreeTagBits; // Min-heap
+
+	// Chunks of the last snapshot, and the slots changed since
+	TArray<FHdriVaultCatalogSnapshot::FChunkPtr> SnapshotChunks;
+	TBitArray<> SnapshotDirty;
+
+	// Order for the last requested pair of sort modes; built lazily, then maintained incrementally
+	mutable FSortOrder SortOrder;
+	mutable int32 SortOrderIndex = INDEX_NONE;
+	bool bBulkUpdate = false;
+};
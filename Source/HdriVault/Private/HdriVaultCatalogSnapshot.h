@@ -0,0 +1,88 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HdriVaultTypes.h"
+
+/** Immutable copy of one catalog item, safe to read from any thread */
+struct FHdriVaultSnapshotEntry
+{
+	FHdriVaultItemHandle Handle;
+	FSoftObjectPath ObjectPath;
+	FName PackagePath;
+	FString DisplayName;
+	FString Author;
+	FString Category;
+	FString Notes;
+	TArray<FString> Tags;
+	FDateTime LastModified;
+	int64 ResourceSize = 0;
+	int32 MaxDimension = 0;
+};
+
+/**
+ * Versioned, immutable view of the catalog for background readers.
+ *
+ * Entries are grouped into fixed-size chunks shared between consecutive snapshots; publishing
+ * a change copies only the chunks it touched, never the whole catalog.
+ */
+class FHdriVaultCatalogSnapshot
+{
+public:
+	static constexpr uint32 ChunkBits = 8;
+	static constexpr uint32 ChunkSize = 1u << ChunkBits;
+
+	using FEntryPtr = TSharedPtr<const FHdriVaultSnapshotEntry, ESPMode::ThreadSafe>;
+	using FChunk = TArray<FEntryPtr>;
+	using FChunkPtr = TSharedPtr<const FChunk, ESPMode::ThreadSafe>;
+
+	FHdriVaultCatalogSnapshot(uint64 InVersion, const TArray<FChunkPtr>& InChunks, int32 InNumEntries)
+		: Version(InVersion)
+		, Chunks(InChunks)
+		, NumEntries(InNumEntries)
+	{
+	}
+
+	uint64 GetVersion() const { return Version; }
+	int32 Num() const { return NumEntries; }
+
+	// Null if the handle is stale or was never part of this snapshot
+	const FHdriVaultSnapshotEntry* Find(FHdriVaultItemHandle Handle) const
+	{
+		const uint32 Index = Handle.GetIndex();
+		const uint32 ChunkIndex = Index >> ChunkBits;
+		if (!Handle.IsValid() || !Chunks.IsValidIndex(ChunkIndex) || !Chunks[ChunkIndex].IsValid())
+		{
+			return nullptr;
+		}
+
+		const FEntryPtr& Entry = (*Chunks[ChunkIndex])[Index & (ChunkSize - 1)];
+		return Entry.IsValid() && Entry->Handle == Handle ? Entry.Get() : nullptr;
+	}
+
+	template<typename FuncType>
+	void ForEach(FuncType&& Func) const
+	{
+		for (const FChunkPtr& Chunk : Chunks)
+		{
+			if (!Chunk.IsValid())
+			{
+				continue;
+			}
+
+			for (const FEntryPtr& Entry : *Chunk)
+			{
+				if (Entry.IsValid())
+				{
+					Func(*Entry);
+				}
+			}
+		}
+	}
+
+private:
+	uint64 Version;
+	TArray<FChunkPtr> Chunks;
+	int32 NumEntries;
+};
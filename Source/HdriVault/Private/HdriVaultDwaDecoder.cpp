@@ -0,0 +1,787 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultDwaDecoder.h"
+#include "HdriVaultPixelKernels.h"
+
+namespace HdriVaultDwaUtils
+{
+	enum class EScheme : uint8
+	{
+		Unknown,	// Deflated as is
+		LossyDct,
+		Rle,
+		Num
+	};
+
+	// The 64-bit sizes every chunk starts with
+	enum ESize
+	{
+		Version,
+		UnknownUncompressedSize,
+		UnknownCompressedSize,
+		AcCompressedSize,
+		DcCompressedSize,
+		RleCompressedSize,
+		RleUncompressedSize,
+		RleRawSize,
+		AcUncompressedCount,
+		DcUncompressedCount,
+		AcCompression,
+		NumSizes
+	};
+
+	// How the AC coefficients are coded
+	static constexpr uint64 AcStaticHuffman = 0;
+	static constexpr uint64 AcDeflate = 1;
+
+	static constexpr int32 PixelTypeHalf = 1;
+	static constexpr int32 PixelTypeFloat = 2;
+
+	// Picks a scheme for channels whose name ends in Suffix
+	struct FRule
+	{
+		FString Suffix;
+		EScheme Scheme = EScheme::Unknown;
+		int32 PixelType = PixelTypeHalf;
+
+		// Position in an RGB triple, or -1
+		int32 CscIndex = -1;
+		bool bCaseInsensitive = false;
+
+		bool Matches(const FString& ChannelSuffix, int32 ChannelPixelType) const
+		{
+			return PixelType == ChannelPixelType && Suffix.Equals(ChannelSuffix, bCaseInsensitive ? ESearchCase::IgnoreCase : ESearchCase::CaseSensitive);
+		}
+	};
+
+	struct FChannel
+	{
+		EScheme Scheme = EScheme::Unknown;
+		int32 PixelType = PixelTypeHalf;
+		int32 SampleSize = 2;
+		bool bLinear = false;
+
+		// Of the channel's samples within a line of the output
+		int64 LineOffset = 0;
+
+		// Of the channel's plane within the unknown or RLE data
+		int64 PlaneOffset = 0;
+
+		bool bDecoded = false;
+	};
+
+	// Channels sharing a layer prefix that can form an RGB triple
+	struct FCscSet
+	{
+		FString Prefix;
+		int32 Channels[3] = { INDEX_NONE, INDEX_NONE, INDEX_NONE };
+	};
+
+	// Natural order index to zig-zag index of an 8x8 block
+	static const uint8 ZigZagOrder[64] =
+	{
+		 0,  1,  5,  6, 14, 15, 27, 28,
+		 2,  4,  7, 13, 16, 26, 29, 42,
+		 3,  8, 12, 17, 25, 30, 41, 43,
+		 9, 11, 18, 24, 31, 40, 44, 53,
+		10, 19, 23, 32, 39, 45, 52, 54,
+		20, 22, 33, 38, 46, 51, 55, 60,
+		21, 34, 37, 47, 50, 56, 59, 61,
+		35, 36, 48, 49, 57, 58, 62, 63
+	};
+
+	// Files written before channel rules were stored in the chunk use these
+	static const TArray<FRule>& GetLegacyRules()
+	{
+		static const TArray<FRule> Rules = []()
+		{
+			TArray<FRule> Result;
+			auto AddRule = [&Result](const TCHAR* Suffix, EScheme Scheme, int32 CscIndex)
+			{
+				FRule Rule;
+				Rule.Suffix = Suffix;
+				Rule.Scheme = Scheme;
+				Rule.CscIndex = CscIndex;
+				Rule.bCaseInsensitive = true;
+				Result.Add(Rule);
+			};
+			AddRule(TEXT("r"), EScheme::LossyDct, 0);
+			AddRule(TEXT("red"), EScheme::LossyDct, 0);
+			AddRule(TEXT("g"), EScheme::LossyDct, 1);
+			AddRule(TEXT("grn"), EScheme::LossyDct, 1);
+			AddRule(TEXT("green"), EScheme::LossyDct, 1);
+			AddRule(TEXT("b"), EScheme::LossyDct, 2);
+			AddRule(TEXT("blu"), EScheme::LossyDct, 2);
+			AddRule(TEXT("blue"), EScheme::LossyDct, 2);
+			AddRule(TEXT("y"), EScheme::LossyDct, -1);
+			AddRule(TEXT("by"), EScheme::Rle, -1);
+			AddRule(TEXT("ry"), EScheme::Rle, -1);
+			AddRule(TEXT("a"), EScheme::Rle, -1);
+			return Result;
+		}();
+		return Rules;
+	}
+
+	// The DCT runs on perceptually encoded halfs; this maps them back to linear
+	static const uint16* GetToLinearTable()
+	{
+		static const TArray<uint16> Table = []()
+		{
+			TArray<uint16> Result;
+			Result.SetNumUninitialized(65536);
+			for (int32 Bits = 0; Bits < 65536; ++Bits)
+			{
+				// Infinity and NaN pass through
+				if ((Bits & 0x7c00) == 0x7c00)
+				{
+					Result[Bits] = static_cast<uint16>(Bits);
+					continue;
+				}
+
+				const float Value = FHdriVaultPixelKernels::HalfToFloatScalar(static_cast<uint16>(Bits));
+				const float Magnitude = FMath::Abs(Value);
+				const float Linear = Magnitude <= 1.0f ? FMath::Pow(Magnitude, 2.2f) : FMath::Pow(9.0f, Magnitude - 1.0f);
+				Result[Bits] = FHdriVaultPixelKernels::FloatToHalfScalar(Value < 0.0f ? -Linear : Linear);
+			}
+			return Result;
+		}();
+		return Table.GetData();
+	}
+
+	static uint64 ReadUint64(const uint8* Bytes)
+	{
+		uint64 Value = 0;
+		for (int32 Byte = 7; Byte >= 0; --Byte)
+		{
+			Value = (Value << 8) | Bytes[Byte];
+		}
+		return Value;
+	}
+
+	// Version 2 chunks carry their channel rules after the sizes: a 16-bit byte count, then per rule the
+	// suffix, a byte packing the CSC index + 1, scheme and case flag, and the pixel type
+	static bool ReadRules(const uint8*& Cursor, const uint8* End, TArray<FRule>& OutRules)
+	{
+		if (End - Cursor < 2)
+		{
+			return false;
+		}
+		const int64 RulesSize = Cursor[0] | (Cursor[1] << 8);
+		if (RulesSize < 2 || RulesSize > End - Cursor)
+		{
+			return false;
+		}
+
+		const uint8* RulesEnd = Cursor + RulesSize;
+		Cursor += 2;
+		while (Cursor < RulesEnd)
+		{
+			const uint8* SuffixEnd = Cursor;
+			while (SuffixEnd < RulesEnd && *SuffixEnd != 0)
+			{
+				++SuffixEnd;
+			}
+			if (RulesEnd - SuffixEnd < 3)
+			{
+				return false;
+			}
+
+			FRule Rule;
+			Rule.Suffix = FString(static_cast<int32>(SuffixEnd - Cursor), reinterpret_cast<const ANSICHAR*>(Cursor));
+			const uint8 Packed = SuffixEnd[1];
+			Rule.CscIndex = int32(Packed >> 4) - 1;
+			Rule.Scheme = static_cast<EScheme>((Packed >> 2) & 3);
+			Rule.bCaseInsensitive = (Packed & 1) != 0;
+			Rule.PixelType = SuffixEnd[2];
+			if (Rule.CscIndex > 2 || Rule.Scheme >= EScheme::Num || Rule.PixelType > 2)
+			{
+				return false;
+			}
+
+			OutRules.Add(MoveTemp(Rule));
+			Cursor = SuffixEnd + 3;
+		}
+		return true;
+	}
+
+	// Every rule that matches a channel applies in turn, so the last one decides its scheme
+	static void ClassifyChannels(TConstArrayView<FHdriVaultDwaChannel> Channels, const TArray<FRule>& Rules, TArray<FChannel>& InOutChannels, TArray<FCscSet>& OutCscSets)
+	{
+		TArray<FCscSet> Candidates;
+		for (int32 Index = 0; Index < Channels.Num(); ++Index)
+		{
+			FString Prefix;
+			FString Suffix = ANSI_TO_TCHAR(Channels[Index].Name);
+			int32 LastDot = INDEX_NONE;
+			if (Suffix.FindLastChar(TEXT('.'), LastDot))
+			{
+				Prefix = Suffix.Left(LastDot);
+				Suffix.RightChopInline(LastDot + 1);
+			}
+
+			FCscSet* Set = Candidates.FindByPredicate([&Prefix](const FCscSet& Candidate)
+			{
+				return Candidate.Prefix.Equals(Prefix, ESearchCase::CaseSensitive);
+			});
+			if (!Set)
+			{
+				Set = &Candidates.AddDefaulted_GetRef();
+				Set->Prefix = Prefix;
+			}
+
+			for (const FRule& Rule : Rules)
+			{
+				if (Rule.Matches(Suffix, InOutChannels[Index].PixelType))
+				{
+					InOutChannels[Index].Scheme = Rule.Scheme;
+					if (Rule.CscIndex >= 0)
+					{
+						Set->Channels[Rule.CscIndex] = Index;
+					}
+				}
+			}
+		}
+
+		// Complete triples decode in prefix order, which is the order they were encoded in
+		Candidates.Sort([](const FCscSet& A, const FCscSet& B)
+		{
+			return A.Prefix.Compare(B.Prefix, ESearchCase::CaseSensitive) < 0;
+		});
+		for (const FCscSet& Candidate : Candidates)
+		{
+			if (Candidate.Channels[0] != INDEX_NONE && Candidate.Channels[1] != INDEX_NONE && Candidate.Channels[2] != INDEX_NONE)
+			{
+				OutCscSets.Add(Candidate);
+			}
+		}
+	}
+
+	/**
+	 * Expands one block's run-length coded AC coefficients into zig-zag order. 0xff00 ends the block and
+	 * 0xffnn skips nn zeros; anything else is a coefficient.
+	 * @param OutLastNonZero - Zig-zag index of the last coefficient, 0 when there are none
+	 */
+	static bool UnpackAc(const uint16*& Ac, const uint16* AcEnd, uint16* ZigZag, int32& OutLastNonZero)
+	{
+		OutLastNonZero = 0;
+		int32 Index = 1;
+		while (Index < 64)
+		{
+			if (Ac == AcEnd)
+			{
+				return false;
+			}
+
+			const uint16 Value = *Ac++;
+			if (Value == 0xff00)
+			{
+				Index = 64;
+			}
+			else if ((Value >> 8) == 0xff)
+			{
+				Index += Value & 0xff;
+			}
+			else
+			{
+				ZigZag[Index] = Value;
+				OutLastNonZero = Index++;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Inverse 8x8 DCT in place, rows then columns, with the constants of the reference encoder.
+	 * @param NumZeroRows - Trailing rows known to hold only zeros, which the row pass skips
+	 */
+	static void InverseDct(float* Data, int32 NumZeroRows)
+	{
+		static const float A = 0.5f * FMath::Cos(3.14159f / 4.0f);
+		static const float B = 0.5f * FMath::Cos(3.14159f / 16.0f);
+		static const float C = 0.5f * FMath::Cos(3.14159f / 8.0f);
+		static const float D = 0.5f * FMath::Cos(3.0f * 3.14159f / 16.0f);
+		static const float E = 0.5f * FMath::Cos(5.0f * 3.14159f / 16.0f);
+		static const float F = 0.5f * FMath::Cos(3.0f * 3.14159f / 8.0f);
+		static const float G = 0.5f * FMath::Cos(7.0f * 3.14159f / 16.0f);
+
+		auto Transform = [](float* Values, int32 Stride)
+		{
+			float* V0 = Values;
+			float* V1 = Values + Stride;
+			float* V2 = Values + 2 * Stride;
+			float* V3 = Values + 3 * Stride;
+			float* V4 = Values + 4 * Stride;
+			float* V5 = Values + 5 * Stride;
+			float* V6 = Values + 6 * Stride;
+			float* V7 = Values + 7 * Stride;
+
+			const float Alpha0 = C * *V2;
+			const float Alpha1 = F * *V2;
+			const float Alpha2 = C * *V6;
+			const float Alpha3 = F * *V6;
+
+			const float Beta0 = B * *V1 + D * *V3 + E * *V5 + G * *V7;
+			const float Beta1 = D * *V1 - G * *V3 - B * *V5 - E * *V7;
+			const float Beta2 = E * *V1 - B * *V3 + G * *V5 + D * *V7;
+			const float Beta3 = G * *V1 - E * *V3 + D * *V5 - B * *V7;
+
+			const float Theta0 = A * (*V0 + *V4);
+			const float Theta3 = A * (*V0 - *V4);
+			const float Theta1 = Alpha0 + Alpha3;
+			const float Theta2 = Alpha1 - Alpha2;
+
+			const float Gamma0 = Theta0 + Theta1;
+			const float Gamma1 = Theta3 + Theta2;
+			const float Gamma2 = Theta3 - Theta2;
+			const float Gamma3 = Theta0 - Theta1;
+
+			*V0 = Gamma0 + Beta0;
+			*V1 = Gamma1 + Beta1;
+			*V2 = Gamma2 + Beta2;
+			*V3 = Gamma3 + Beta3;
+			*V4 = Gamma3 - Beta3;
+			*V5 = Gamma2 - Beta2;
+			*V6 = Gamma1 - Beta1;
+			*V7 = Gamma0 - Beta0;
+		};
+
+		for (int32 Row = 0; Row < 8 - NumZeroRows; ++Row)
+		{
+			Transform(Data + Row * 8, 1);
+		}
+		for (int32 Column = 0; Column < 8; ++Column)
+		{
+			Transform(Data + Column, 8);
+		}
+	}
+
+	// Rows of the natural order block that are all zero when the last coefficient is at a zig-zag index
+	static int32 GetNumZeroRows(int32 LastNonZero)
+	{
+		// Zig-zag index of the first coefficient in rows 1 to 7
+		static const int32 RowStarts[7] = { 2, 3, 9, 10, 20, 21, 35 };
+		for (int32 Row = 0; Row < 7; ++Row)
+		{
+			if (LastNonZero < RowStarts[Row])
+			{
+				return 7 - Row;
+			}
+		}
+		return 0;
+	}
+
+	// Rec. 709 Y'CbCr to R'G'B'
+	static void CscInverse(float& InOutY, float& InOutCb, float& InOutCr)
+	{
+		const float Y = InOutY;
+		const float Cb = InOutCb;
+		const float Cr = InOutCr;
+		InOutY = Y + 1.5747f * Cr;
+		InOutCb = Y - 0.1873f * Cb - 0.4682f * Cr;
+		InOutCr = Y + 1.8556f * Cb;
+	}
+
+	/**
+	 * Decodes one lossy DCT channel, or an RGB triple stored as Y'CbCr. The image is cut into 8x8 blocks,
+	 * each coded as a DC value, planar per component, and run-length coded AC values, interleaved per block.
+	 * @param Outputs - Each component's samples in the first line of the output
+	 */
+	static bool DecodeLossyDct(int32 NumComponents, uint8* const* Outputs, const int32* PixelTypes, bool bToLinear, int64 LineSize, int32 Width, int32 Height,
+		const uint16*& Ac, const uint16* AcEnd, const uint16*& Dc, const uint16* DcEnd)
+	{
+		const int32 NumBlocksX = FMath::DivideAndRoundUp(Width, 8);
+		const int32 NumBlocksY = FMath::DivideAndRoundUp(Height, 8);
+		const int32 LastBlockWidth = Width - (NumBlocksX - 1) * 8;
+		const int32 LastBlockHeight = Height - (NumBlocksY - 1) * 8;
+		const int64 NumBlocks = int64(NumBlocksX) * NumBlocksY;
+		if (DcEnd - Dc < NumComponents * NumBlocks)
+		{
+			return false;
+		}
+
+		const uint16* DcComponents[3] = {};
+		for (int32 Component = 0; Component < NumComponents; ++Component)
+		{
+			DcComponents[Component] = Dc + Component * NumBlocks;
+		}
+		Dc += NumComponents * NumBlocks;
+
+		const uint16* ToLinear = bToLinear ? GetToLinearTable() : nullptr;
+
+		// One row of blocks as perceptual halfs, then one output line
+		TArray<uint16> RowBlocks;
+		RowBlocks.SetNumUninitialized(NumComponents * NumBlocksX * 64);
+		TArray<uint16> LineHalves;
+		LineHalves.SetNumUninitialized(Width);
+		TArray<float> LineFloats;
+
+		float Coefficients[3][64];
+		float Unzigged[64];
+		uint16 ZigZag[64];
+
+		for (int32 BlockY = 0; BlockY < NumBlocksY; ++BlockY)
+		{
+			for (int32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+			{
+				// Blocks with no AC at all are flat, so only their first value is carried through
+				bool bConstant = true;
+				for (int32 Component = 0; Component < NumComponents; ++Component)
+				{
+					FMemory::Memzero(ZigZag);
+					ZigZag[0] = *DcComponents[Component]++;
+
+					int32 LastNonZero = 0;
+					if (!UnpackAc(Ac, AcEnd, ZigZag, LastNonZero))
+					{
+						return false;
+					}
+
+					float* Block = Coefficients[Component];
+					if (LastNonZero == 0)
+					{
+						const float Value = FHdriVaultPixelKernels::HalfToFloatScalar(ZigZag[0]) * 3.535536e-01f * 3.535536e-01f;
+						for (int32 Index = 0; Index < 64; ++Index)
+						{
+							Block[Index] = Value;
+						}
+					}
+					else
+					{
+						bConstant = false;
+						FHdriVaultPixelKernels::HalfToFloat(ZigZag, Unzigged, 64);
+						for (int32 Index = 0; Index < 64; ++Index)
+						{
+							Block[Index] = Unzigged[ZigZagOrder[Index]];
+						}
+						InverseDct(Block, GetNumZeroRows(LastNonZero));
+					}
+				}
+
+				if (NumComponents == 3)
+				{
+					const int32 NumValues = bConstant ? 1 : 64;
+					for (int32 Index = 0; Index < NumValues; ++Index)
+					{
+						CscInverse(Coefficients[0][Index], Coefficients[1][Index], Coefficients[2][Index]);
+					}
+				}
+
+				for (int32 Component = 0; Component < NumComponents; ++Component)
+				{
+					uint16* Block = RowBlocks.GetData() + (Component * NumBlocksX + BlockX) * 64;
+					if (bConstant)
+					{
+						const uint16 Value = FHdriVaultPixelKernels::FloatToHalfScalar(Coefficients[Component][0]);
+						for (int32 Index = 0; Index < 64; ++Index)
+						{
+							Block[Index] = Value;
+						}
+					}
+					else
+					{
+						FHdriVaultPixelKernels::FloatToHalf(Coefficients[Component], Block, 64);
+					}
+				}
+			}
+
+			// Unblock into lines, back to linear, widened for float channels
+			const int32 NumRows = BlockY == NumBlocksY - 1 ? LastBlockHeight : 8;
+			for (int32 Component = 0; Component < NumComponents; ++Component)
+			{
+				for (int32 Row = 0; Row < NumRows; ++Row)
+				{
+					for (int32 BlockX = 0; BlockX < NumBlocksX; ++BlockX)
+					{
+						const uint16* Source = RowBlocks.GetData() + (Component * NumBlocksX + BlockX) * 64 + Row * 8;
+						uint16* Dest = LineHalves.GetData() + BlockX * 8;
+						const int32 Count = BlockX == NumBlocksX - 1 ? LastBlockWidth : 8;
+						for (int32 X = 0; X < Count; ++X)
+						{
+							Dest[X] = ToLinear ? ToLinear[Source[X]] : Source[X];
+						}
+					}
+
+					uint8* Line = Outputs[Component] + (int64(BlockY) * 8 + Row) * LineSize;
+					if (PixelTypes[Component] == PixelTypeHalf)
+					{
+						FMemory::Memcpy(Line, LineHalves.GetData(), Width * sizeof(uint16));
+					}
+					else
+					{
+						LineFloats.SetNumUninitialized(Width, EAllowShrinking::No);
+						FHdriVaultPixelKernels::HalfToFloat(LineHalves.GetData(), LineFloats.GetData(), Width);
+						FMemory::Memcpy(Line, LineFloats.GetData(), Width * sizeof(float));
+					}
+				}
+			}
+		}
+		return true;
+	}
+
+	// Undoes the byte delta and split into odd and even bytes that ZIP compression applies before deflating
+	static void UndoZipPredictor(uint8* Data, int64 Size, uint8* Dest)
+	{
+		for (int64 Index = 1; Index < Size; ++Index)
+		{
+			Data[Index] = static_cast<uint8>(int32(Data[Index - 1]) + int32(Data[Index]) - 128);
+		}
+
+		const uint8* Even = Data;
+		const uint8* Odd = Data + (Size + 1) / 2;
+		for (int64 Index = 0; Index < Size; ++Index)
+		{
+			Dest[Index] = (Index & 1) ? *Odd++ : *Even++;
+		}
+	}
+
+	// OpenEXR's run-length code: a negative count is followed by that many literal bytes, any other count
+	// by one byte repeated count + 1 times
+	static bool DecodeRle(const uint8* Source, int64 SourceSize, uint8* Dest, int64 DestSize)
+	{
+		const uint8* SourceEnd = Source + SourceSize;
+		const uint8* DestEnd = Dest + DestSize;
+		while (Source < SourceEnd)
+		{
+			const int32 Count = static_cast<int8>(*Source++);
+			if (Count < 0)
+			{
+				if (SourceEnd - Source < -Count || DestEnd - Dest < -Count)
+				{
+					return false;
+				}
+				FMemory::Memcpy(Dest, Source, -Count);
+				Source += -Count;
+				Dest += -Count;
+			}
+			else
+			{
+				if (Source == SourceEnd || DestEnd - Dest < Count + 1)
+				{
+					return false;
+				}
+				FMemory::Memset(Dest, *Source++, Count + 1);
+				Dest += Count + 1;
+			}
+		}
+		return Dest == DestEnd;
+	}
+}
+
+bool FHdriVaultDwaDecoder::Decode(const uint8* Source, int64 SourceSize, TConstArrayView<FHdriVaultDwaChannel> Channels, int32 Width, int32 NumLines,
+	uint8* Dest, int64 DestSize, const FHdriVaultDwaEntropyDecoders& Decoders)
+{
+	using namespace HdriVaultDwaUtils;
+
+	if (SourceSize < NumSizes * 8 || Width <= 0 || NumLines <= 0 || Channels.Num() == 0 || !Decoders.Inflate || !Decoders.DecodeHuffman)
+	{
+		return false;
+	}
+
+	uint64 Sizes[NumSizes];
+	for (int32 Index = 0; Index < NumSizes; ++Index)
+	{
+		Sizes[Index] = ReadUint64(Source + Index * 8);
+	}
+
+	const uint8* SourceEnd = Source + SourceSize;
+	const uint8* Cursor = Source + NumSizes * 8;
+
+	TArray<FRule> FileRules;
+	if (Sizes[Version] > 2)
+	{
+		return false;
+	}
+	if (Sizes[Version] == 2 && !ReadRules(Cursor, SourceEnd, FileRules))
+	{
+		return false;
+	}
+	const TArray<FRule>& Rules = Sizes[Version] == 2 ? FileRules : GetLegacyRules();
+
+	// Where each channel sits in an output line and in the planar data of its scheme
+	TArray<FChannel> ChannelData;
+	ChannelData.SetNum(Channels.Num());
+	int64 LineSize = 0;
+	for (int32 Index = 0; Index < Channels.Num(); ++Index)
+	{
+		FChannel& Channel = ChannelData[Index];
+		Channel.PixelType = Channels[Index].PixelType;
+		Channel.SampleSize = Channel.PixelType == PixelTypeHalf ? 2 : 4;
+		Channel.bLinear = Channels[Index].bLinear;
+		Channel.LineOffset = LineSize;
+		LineSize += int64(Channel.SampleSize) * Width;
+	}
+	if (LineSize * NumLines != DestSize)
+	{
+		return false;
+	}
+
+	TArray<FCscSet> CscSets;
+	ClassifyChannels(Channels, Rules, ChannelData, CscSets);
+
+	const int64 NumPixels = int64(Width) * NumLines;
+	int64 UnknownSize = 0;
+	int64 RleSize = 0;
+	for (FChannel& Channel : ChannelData)
+	{
+		// The DCT produces halfs, which only widen to float
+		if (Channel.Scheme == EScheme::LossyDct && Channel.PixelType != PixelTypeHalf && Channel.PixelType != PixelTypeFloat)
+		{
+			return false;
+		}
+
+		if (Channel.Scheme == EScheme::Unknown)
+		{
+			Channel.PlaneOffset = UnknownSize;
+			UnknownSize += NumPixels * Channel.SampleSize;
+		}
+		else if (Channel.Scheme == EScheme::Rle)
+		{
+			Channel.PlaneOffset = RleSize;
+			RleSize += NumPixels * Channel.SampleSize;
+		}
+	}
+
+	// The four streams follow each other: unknown, AC, DC, then RLE. No stream holds more values than the
+	// chunk has samples, give or take partial blocks.
+	const uint64 MaxCount = uint64(FMath::DivideAndRoundUp(Width, 8) * 8) * uint64(FMath::DivideAndRoundUp(NumLines, 8) * 8) * Channels.Num();
+	const uint64 Remaining = static_cast<uint64>(SourceEnd - Cursor);
+	if (Sizes[UnknownCompressedSize] > Remaining
+		|| Sizes[AcCompressedSize] > Remaining - Sizes[UnknownCompressedSize]
+		|| Sizes[DcCompressedSize] > Remaining - Sizes[UnknownCompressedSize] - Sizes[AcCompressedSize]
+		|| Sizes[RleCompressedSize] > Remaining - Sizes[UnknownCompressedSize] - Sizes[AcCompressedSize] - Sizes[DcCompressedSize]
+		|| Sizes[UnknownUncompressedSize] != uint64(UnknownSize)
+		|| Sizes[RleRawSize] != uint64(RleSize)
+		|| Sizes[RleUncompressedSize] > 2 * uint64(RleSize) + 64
+		|| Sizes[AcUncompressedCount] > MaxCount
+		|| Sizes[DcUncompressedCount] > MaxCount)
+	{
+		return false;
+	}
+
+	const int64 UnknownStreamSize = static_cast<int64>(Sizes[UnknownCompressedSize]);
+	const int64 AcStreamSize = static_cast<int64>(Sizes[AcCompressedSize]);
+	const int64 DcStreamSize = static_cast<int64>(Sizes[DcCompressedSize]);
+	const int64 RleStreamSize = static_cast<int64>(Sizes[RleCompressedSize]);
+	const uint8* UnknownStream = Cursor;
+	const uint8* AcStream = UnknownStream + UnknownStreamSize;
+	const uint8* DcStream = AcStream + AcStreamSize;
+	const uint8* RleStream = DcStream + DcStreamSize;
+
+	TArray<uint8> UnknownData;
+	if (UnknownSize > 0)
+	{
+		UnknownData.SetNumUninitialized(static_cast<int32>(UnknownSize));
+		if (!Decoders.Inflate(UnknownData.GetData(), UnknownSize, UnknownStream, UnknownStreamSize))
+		{
+			return false;
+		}
+	}
+
+	TArray<uint16> AcData;
+	const int64 AcCount = static_cast<int64>(Sizes[AcUncompressedCount]);
+	if (AcCount > 0)
+	{
+		AcData.SetNumUninitialized(static_cast<int32>(AcCount));
+		const bool bAcDecoded = Sizes[AcCompression] == AcStaticHuffman
+			? Decoders.DecodeHuffman(AcData.GetData(), AcCount, AcStream, AcStreamSize)
+			: Sizes[AcCompression] == AcDeflate && Decoders.Inflate(reinterpret_cast<uint8*>(AcData.GetData()), AcCount * 2, AcStream, AcStreamSize);
+		if (!bAcDecoded)
+		{
+			return false;
+		}
+	}
+
+	TArray<uint16> DcData;
+	const int64 DcCount = static_cast<int64>(Sizes[DcUncompressedCount]);
+	if (DcCount > 0)
+	{
+		TArray<uint8> DcBytes;
+		DcBytes.SetNumUninitialized(static_cast<int32>(DcCount * 2));
+		if (!Decoders.Inflate(DcBytes.GetData(), DcBytes.Num(), DcStream, DcStreamSize))
+		{
+			return false;
+		}
+		DcData.SetNumUninitialized(static_cast<int32>(DcCount));
+		UndoZipPredictor(DcBytes.GetData(), DcBytes.Num(), reinterpret_cast<uint8*>(DcData.GetData()));
+	}
+
+	TArray<uint8> RleData;
+	if (RleSize > 0)
+	{
+		TArray<uint8> RleBytes;
+		RleBytes.SetNumUninitialized(static_cast<int32>(Sizes[RleUncompressedSize]));
+		RleData.SetNumUninitialized(static_cast<int32>(RleSize));
+		if (!Decoders.Inflate(RleBytes.GetData(), RleBytes.Num(), RleStream, RleStreamSize)
+			|| !DecodeRle(RleBytes.GetData(), RleBytes.Num(), RleData.GetData(), RleSize))
+		{
+			return false;
+		}
+	}
+
+	// Lossy channels write straight to the output: RGB triples first, in the order they were encoded,
+	// then single channels in channel order
+	const uint16* Ac = AcData.GetData();
+	const uint16* AcEnd = Ac + AcData.Num();
+	const uint16* Dc = DcData.GetData();
+	const uint16* DcEnd = Dc + DcData.Num();
+
+	for (const FCscSet& Set : CscSets)
+	{
+		uint8* Outputs[3];
+		int32 PixelTypes[3];
+		for (int32 Component = 0; Component < 3; ++Component)
+		{
+			FChannel& Channel = ChannelData[Set.Channels[Component]];
+			if (Channel.Scheme != EScheme::LossyDct)
+			{
+				return false;
+			}
+			Outputs[Component] = Dest + Channel.LineOffset;
+			PixelTypes[Component] = Channel.PixelType;
+			Channel.bDecoded = true;
+		}
+
+		if (!DecodeLossyDct(3, Outputs, PixelTypes, true, LineSize, Width, NumLines, Ac, AcEnd, Dc, DcEnd))
+		{
+			return false;
+		}
+	}
+
+	for (FChannel& Channel : ChannelData)
+	{
+		if (Channel.Scheme == EScheme::LossyDct && !Channel.bDecoded)
+		{
+			uint8* Output = Dest + Channel.LineOffset;
+			if (!DecodeLossyDct(1, &Output, &Channel.PixelType, !Channel.bLinear, LineSize, Width, NumLines, Ac, AcEnd, Dc, DcEnd))
+			{
+				return false;
+			}
+			Channel.bDecoded = true;
+		}
+	}
+
+	// The rest is planar per channel; RLE channels are also split into one plane per byte of a sample
+	for (int32 Line = 0; Line < NumLines; ++Line)
+	{
+		for (const FChannel& Channel : ChannelData)
+		{
+			uint8* Output = Dest + Line * LineSize + Channel.LineOffset;
+			if (Channel.Scheme == EScheme::Unknown)
+			{
+				FMemory::Memcpy(Output, UnknownData.GetData() + Channel.PlaneOffset + int64(Line) * Width * Channel.SampleSize, int64(Width) * Channel.SampleSize);
+			}
+			else if (Channel.Scheme == EScheme::Rle)
+			{
+				const uint8* Planes = RleData.GetData() + Channel.PlaneOffset + int64(Line) * Width;
+				for (int32 X = 0; X < Width; ++X)
+				{
+					for (int32 Byte = 0; Byte < Channel.SampleSize; ++Byte)
+					{
+						*Output++ = Planes[Byte * NumPixels + X];
+					}
+				}
+			}
+		}
+	}
+	return true;
+}
@@ -0,0 +1,47 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// One channel of a DWA chunk, in the order the channels are stored
+struct FHdriVaultDwaChannel
+{
+	// Full channel name, layer prefix included
+	const ANSICHAR* Name = nullptr;
+
+	// EXR pixel type: 0 uint, 1 half, 2 float
+	int32 PixelType = 0;
+
+	// Stored without the perceptual curve DWA otherwise applies ahead of the DCT
+	bool bLinear = false;
+};
+
+// The general purpose decoders DWA's entropy stages are built on; supplied by the code hosting tinyexr
+struct FHdriVaultDwaEntropyDecoders
+{
+	// Inflates a zlib stream to exactly DestSize bytes
+	bool (*Inflate)(uint8* Dest, int64 DestSize, const uint8* Source, int64 SourceSize) = nullptr;
+
+	// Decodes OpenEXR's PIZ Huffman code to exactly Count values
+	bool (*DecodeHuffman)(uint16* Dest, int64 Count, const uint8* Source, int64 SourceSize) = nullptr;
+};
+
+/**
+ * Decoder for DWAA and DWAB compressed EXR chunks, which differ only in how many scanlines a chunk holds.
+ *
+ * DWA sorts a chunk's channels by name. Color channels go through a lossy 8x8 DCT, RGB triples after a
+ * conversion to Y'CbCr; alpha is run-length coded; anything else is deflated as is. Chunks do not depend
+ * on each other, so callers decode them in parallel.
+ */
+class FHdriVaultDwaDecoder
+{
+public:
+	/**
+	 * Decodes one chunk to the uncompressed EXR layout: line by line, each channel's samples in channel
+	 * order. Safe to call from any thread.
+	 * @param DestSize - Must be Width * NumLines samples of every channel
+	 */
+	static bool Decode(const uint8* Source, int64 SourceSize, TConstArrayView<FHdriVaultDwaChannel> Channels, int32 Width, int32 NumLines,
+		uint8* Dest, int64 DestSize, const FHdriVaultDwaEntropyDecoders& Decoders);
+};
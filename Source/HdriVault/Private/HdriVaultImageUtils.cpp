@@ -1,12 +1,25 @@
 // Copyright Pyre Labs 2025. All Rights Reserved.
 
 #include "HdriVaultImageUtils.h"
+#include "HdriVaultDwaDecoder.h"
+#include "HdriVaultInflate.h"
+#include "HdriVaultPixelKernels.h"
+#include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Async/ParallelFor.h"
+#include "Serialization/Archive.h"
+#include "Serialization/MemoryReader.h"
 
 // Standard library includes for tinyexr
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 
 // Disable warnings for third party libraries
@@ -24,6 +37,32 @@
 #define TEXR_ASSERT assert
 #endif
 
+// ZIP and ZIPS chunks inflate through the backend picked in HdriVault.Build.cs, when there is one
+#if HDRIVAULT_INFLATE_FAST
+namespace HdriVaultExrUtils
+{
+	static bool Inflate(unsigned char* Dest, unsigned long* InOutSize, const unsigned char* Source, unsigned long SourceSize)
+	{
+		int64 WrittenSize = 0;
+		if (!FHdriVaultInflate::Uncompress(Dest, *InOutSize, Source, SourceSize, WrittenSize))
+		{
+			return false;
+		}
+		*InOutSize = static_cast<unsigned long>(WrittenSize);
+		return true;
+	}
+}
+#define TINYEXR_INFLATE HdriVaultExrUtils::Inflate
+#endif
+
+// DWAA and DWAB chunks go to FHdriVaultDwaDecoder, through a hook defined once tinyexr's types are known
+#include "ThirdParty/tinyexr.h"
+namespace HdriVaultExrUtils
+{
+	static bool DecompressDwa(unsigned char* Dest, size_t DestSize, const unsigned char* Source, size_t SourceSize, size_t NumChannels, const EXRChannelInfo* Channels, int Width, int NumLines);
+}
+#define TINYEXR_DWA_DECOMPRESS HdriVaultExrUtils::DecompressDwa
+
 #define TINYEXR_IMPLEMENTATION
 #include "ThirdParty/tinyexr.h"
 
@@ -34,53 +73,1384 @@
 	#pragma warning(pop)
 #endif
 
-bool FHdriVaultImageUtils::ConvertExrToHdr(const FString& InputFile, const FString& OutputFile, FString& OutError)
+namespace HdriVaultImageFileUtils
 {
-	float* Rgba = nullptr; // width * height * 4
-	int Width = 0;
-	int Height = 0;
-	const char* Err = nullptr;
+	// Buffered reader over a file archive; headers and Radiance scanlines are decoded a byte at a time
+	class FByteReader
+	{
+	public:
+		explicit FByteReader(FArchive& InArchive)
+			: Archive(InArchive)
+		{
+		}
+
+		bool ReadByte(uint8& OutByte)
+		{
+			if (Position == Buffer.Num())
+			{
+				const int64 Remaining = Archive.TotalSize() - Archive.Tell();
+				if (Remaining <= 0)
+				{
+					return false;
+				}
+
+				Buffer.SetNumUninitialized(static_cast<int32>(FMath::Min<int64>(Remaining, 64 * 1024)), EAllowShrinking::No);
+				Archive.Serialize(Buffer.GetData(), Buffer.Num());
+				Position = 0;
+				if (Archive.IsError())
+				{
+					return false;
+				}
+			}
+
+			OutByte = Buffer[Position++];
+			return true;
+		}
+
+		bool ReadBytes(uint8* OutBytes, int32 Count)
+		{
+			for (int32 Index = 0; Index < Count; ++Index)
+			{
+				if (!ReadByte(OutBytes[Index]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		// Reads up to the next newline; header lines are short, so anything longer is treated as corrupt
+		bool ReadLine(FString& OutLine)
+		{
+			OutLine.Reset();
+			uint8 Char = 0;
+			while (ReadByte(Char))
+			{
+				if (Char == '\n')
+				{
+					OutLine.RemoveFromEnd(TEXT("\r"));
+					return true;
+				}
+				if (OutLine.Len() >= 4096)
+				{
+					return false;
+				}
+				OutLine.AppendChar(static_cast<TCHAR>(Char));
+			}
+			return false;
+		}
+
+		bool Skip(int64 Count)
+		{
+			const int64 Buffered = Buffer.Num() - Position;
+			if (Count <= Buffered)
+			{
+				Position += static_cast<int32>(Count);
+				return true;
+			}
 
-	// Load EXR
-	// InputFile is FString, TCHAR*. TinyEXR expects char*.
-	// On Windows, paths with non-ASCII chars might be tricky with ANSI_TO_TCHAR/TCHAR_TO_ANSI if not handled well, 
-	// but for now we assume standard paths or that TCHAR_TO_ANSI works for the file system api used by tinyexr (fopen/ifstream).
-	// TinyEXR uses standard C++ ifstream or FILE*, which takes const char* on Windows usually implying ANSI/UTF8 depending on locale.
-	// Ideally we'd use the wchar_t version if available or UTF8, but let's try standard conversion.
-	
-	int Ret = LoadEXR(&Rgba, &Width, &Height, TCHAR_TO_ANSI(*InputFile), &Err);
+			// Seek past whatever is not buffered yet instead of reading it
+			const int64 Target = Archive.Tell() + (Count - Buffered);
+			if (Target > Archive.TotalSize())
+			{
+				return false;
+			}
+			Archive.Seek(Target);
+			Buffer.Reset();
+			Position = 0;
+			return !Archive.IsError();
+		}
+
+		// Offset of the next byte to be read
+		int64 Tell() const
+		{
+			return Archive.Tell() - (Buffer.Num() - Position);
+		}
+
+	private:
+		FArchive& Archive;
+		TArray<uint8> Buffer;
+		int32 Position = 0;
+	};
+
+	static float GetLuminance(float R, float G, float B)
+	{
+		return 0.2126f * R + 0.7152f * G + 0.0722f * B;
+	}
+
+	// Preview dimensions for a source image, and the source step between preview pixels
+	static void GetPreviewSize(int32 Width, int32 Height, int32& OutWidth, int32& OutHeight, int32& OutStep)
+	{
+		OutStep = FMath::Max(1, FMath::DivideAndRoundUp(FMath::Max(Width, Height), FHdriVaultImageUtils::MaxPreviewSize));
+		OutWidth = FMath::Max(1, Width / OutStep);
+		OutHeight = FMath::Max(1, Height / OutStep);
+	}
+
+	static FColor ToPreviewColor(float R, float G, float B)
+	{
+		const FLinearColor Color(FMath::IsFinite(R) ? R : 0.0f, FMath::IsFinite(G) ? G : 0.0f, FMath::IsFinite(B) ? B : 0.0f);
+		return Color.GetClamped().ToFColor(true);
+	}
 
-	if (Ret != TINYEXR_SUCCESS)
+	// Point-samples decoded RGBA float pixels down to preview size
+	static void BuildPreview(const float* Rgba, int32 Width, int32 Height, FHdriVaultImagePreview& OutPreview)
 	{
-		if (Err)
+		int32 Step = 1;
+		GetPreviewSize(Width, Height, OutPreview.Width, OutPreview.Height, Step);
+		OutPreview.Pixels.SetNumUninitialized(OutPreview.Width * OutPreview.Height);
+		OutPreview.bFromHeader = false;
+
+		for (int32 Y = 0; Y < OutPreview.Height; ++Y)
 		{
-			OutError = FString::Printf(TEXT("TinyEXR Error: %s"), ANSI_TO_TCHAR(Err));
-			FreeEXRErrorMessage(Err);
+			for (int32 X = 0; X < OutPreview.Width; ++X)
+			{
+				const float* Pixel = Rgba + (int64(Y) * Step * Width + int64(X) * Step) * 4;
+				OutPreview.Pixels[Y * OutPreview.Width + X] = ToPreviewColor(Pixel[0], Pixel[1], Pixel[2]);
+			}
 		}
-		else
+	}
+}
+
+namespace HdriVaultExrUtils
+{
+	// A tinyexr header that frees itself
+	struct FScopedHeader
+	{
+		EXRVersion Version;
+		EXRHeader Header;
+
+		// Bytes up to the end of the header, where the offset table starts
+		int64 HeaderSize = 0;
+
+		FScopedHeader() { InitEXRHeader(&Header); }
+		~FScopedHeader() { FreeEXRHeader(&Header); }
+	};
+
+	// The entropy stages DWA shares with the other codecs, from tinyexr
+	static bool InflateExact(uint8* Dest, int64 DestSize, const uint8* Source, int64 SourceSize)
+	{
+#if HDRIVAULT_INFLATE_FAST
+		int64 WrittenSize = 0;
+		return FHdriVaultInflate::Uncompress(Dest, DestSize, Source, SourceSize, WrittenSize) && WrittenSize == DestSize;
+#else
+		tinyexr::miniz::mz_ulong WrittenSize = static_cast<tinyexr::miniz::mz_ulong>(DestSize);
+		return tinyexr::miniz::mz_uncompress(Dest, &WrittenSize, Source, static_cast<tinyexr::miniz::mz_ulong>(SourceSize)) == tinyexr::miniz::MZ_OK
+			&& int64(WrittenSize) == DestSize;
+#endif
+	}
+
+	static bool DecodeHuffman(uint16* Dest, int64 Count, const uint8* Source, int64 SourceSize)
+	{
+		// Below the 20-byte table header there is nothing to decode
+		if (SourceSize < 20 || SourceSize > MAX_int32)
+		{
+			return false;
+		}
+
+		std::vector<unsigned short> Values(static_cast<size_t>(Count));
+		if (!tinyexr::hufUncompress(reinterpret_cast<const char*>(Source), static_cast<int>(SourceSize), &Values))
+		{
+			return false;
+		}
+		FMemory::Memcpy(Dest, Values.data(), Count * sizeof(uint16));
+		return true;
+	}
+
+	static bool DecompressDwa(unsigned char* Dest, size_t DestSize, const unsigned char* Source, size_t SourceSize, size_t NumChannels, const EXRChannelInfo* Channels, int Width, int NumLines)
+	{
+		// Chunks that would not have got smaller are stored as is
+		if (SourceSize == DestSize)
+		{
+			FMemory::Memcpy(Dest, Source, DestSize);
+			return true;
+		}
+
+		TArray<FHdriVaultDwaChannel, TInlineAllocator<8>> DwaChannels;
+		for (size_t Index = 0; Index < NumChannels; ++Index)
+		{
+			FHdriVaultDwaChannel& Channel = DwaChannels.AddDefaulted_GetRef();
+			Channel.Name = Channels[Index].name;
+			Channel.PixelType = Channels[Index].pixel_type;
+			Channel.bLinear = Channels[Index].p_linear != 0;
+		}
+
+		FHdriVaultDwaEntropyDecoders Decoders;
+		Decoders.Inflate = &InflateExact;
+		Decoders.DecodeHuffman = &DecodeHuffman;
+		return FHdriVaultDwaDecoder::Decode(Source, static_cast<int64>(SourceSize), DwaChannels, Width, NumLines, Dest, static_cast<int64>(DestSize), Decoders);
+	}
+
+	// Scanlines per chunk of each compression type
+	static int32 GetLinesPerChunk(int CompressionType)
+	{
+		switch (CompressionType)
+		{
+		case TINYEXR_COMPRESSIONTYPE_ZIP:
+			return 16;
+		case TINYEXR_COMPRESSIONTYPE_PIZ:
+		case TINYEXR_COMPRESSIONTYPE_DWAA:
+			return 32;
+		case TINYEXR_COMPRESSIONTYPE_DWAB:
+			return 256;
+		default:
+			return 1;
+		}
+	}
+
+	// Reads a null-terminated header string; EXR names are at most 255 characters
+	static bool SkipString(HdriVaultImageFileUtils::FByteReader& Reader, int32& OutLength)
+	{
+		OutLength = 0;
+		uint8 Char = 0;
+		while (Reader.ReadByte(Char))
 		{
-			OutError = TEXT("Unknown TinyEXR Error");
+			if (Char == 0)
+			{
+				return true;
+			}
+			if (++OutLength > 255)
+			{
+				return false;
+			}
 		}
 		return false;
 	}
 
-	if (!Rgba)
+	// Parses the header of a single-part EXR. Only the header bytes are read: the attribute list is walked
+	// to find where it ends and just that much is handed to tinyexr, whose file entry point loads the
+	// whole image first.
+	static bool ReadHeader(FArchive& Archive, FScopedHeader& OutHeader, FString& OutError)
 	{
-		OutError = TEXT("Failed to load EXR data (null buffer)");
+		HdriVaultImageFileUtils::FByteReader Reader(Archive);
+		uint8 VersionBytes[8];
+		if (!Reader.ReadBytes(VersionBytes, 8) || ParseEXRVersionFromMemory(&OutHeader.Version, VersionBytes, 8) != TINYEXR_SUCCESS)
+		{
+			OutError = TEXT("Not a valid EXR file");
+			return false;
+		}
+		if (OutHeader.Version.multipart || OutHeader.Version.non_image)
+		{
+			OutError = TEXT("Multi-part and deep EXR files are not supported");
+			return false;
+		}
+
+		// Attributes are "name\0type\0" followed by a 32-bit size and the value; an empty name ends the list
+		for (int32 NumAttributes = 0; ; ++NumAttributes)
+		{
+			int32 NameLength = 0;
+			int32 TypeLength = 0;
+			uint8 SizeBytes[4];
+			if (NumAttributes > TINYEXR_MAX_HEADER_ATTRIBUTES || !SkipString(Reader, NameLength))
+			{
+				OutError = TEXT("Corrupt or truncated EXR header");
+				return false;
+			}
+			if (NameLength == 0)
+			{
+				break;
+			}
+			if (!SkipString(Reader, TypeLength) || !Reader.ReadBytes(SizeBytes, 4))
+			{
+				OutError = TEXT("Corrupt or truncated EXR header");
+				return false;
+			}
+
+			const uint32 Size = uint32(SizeBytes[0]) | (uint32(SizeBytes[1]) << 8) | (uint32(SizeBytes[2]) << 16) | (uint32(SizeBytes[3]) << 24);
+			if (!Reader.Skip(Size))
+			{
+				OutError = TEXT("Corrupt or truncated EXR header");
+				return false;
+			}
+		}
+
+		OutHeader.HeaderSize = Reader.Tell();
+		TArray<uint8> HeaderBytes;
+		HeaderBytes.SetNumUninitialized(static_cast<int32>(OutHeader.HeaderSize));
+		Archive.Seek(0);
+		Archive.Serialize(HeaderBytes.GetData(), HeaderBytes.Num());
+		if (Archive.IsError())
+		{
+			OutError = TEXT("Could not read the EXR header");
+			return false;
+		}
+
+		const char* Err = nullptr;
+		if (ParseEXRHeaderFromMemory(&OutHeader.Header, &OutHeader.Version, HeaderBytes.GetData(), HeaderBytes.Num(), &Err) != TINYEXR_SUCCESS)
+		{
+			OutError = Err ? FString::Printf(TEXT("TinyEXR Error: %s"), ANSI_TO_TCHAR(Err)) : TEXT("Unknown TinyEXR Error");
+			FreeEXRErrorMessage(Err);
+			return false;
+		}
+		return true;
+	}
+
+	// The standard "preview" attribute: 32-bit width and height, then 8-bit RGBA pixels
+	static bool ReadPreviewAttribute(const EXRHeader& Header, FHdriVaultImagePreview& OutPreview)
+	{
+		for (int32 Index = 0; Index < Header.num_custom_attributes; ++Index)
+		{
+			const EXRAttribute& Attribute = Header.custom_attributes[Index];
+			if (FCStringAnsi::Strcmp(Attribute.name, "preview") != 0 || FCStringAnsi::Strcmp(Attribute.type, "preview") != 0 || Attribute.size < 8)
+			{
+				continue;
+			}
+
+			uint32 Size[2];
+			FMemory::Memcpy(Size, Attribute.value, sizeof(Size));
+			const int64 NumPixels = int64(Size[0]) * Size[1];
+			if (NumPixels <= 0 || NumPixels > 4096 * 4096 || Attribute.size != 8 + NumPixels * 4)
+			{
+				return false;
+			}
+
+			OutPreview.Width = static_cast<int32>(Size[0]);
+			OutPreview.Height = static_cast<int32>(Size[1]);
+			OutPreview.Pixels.SetNumUninitialized(static_cast<int32>(NumPixels));
+			OutPreview.bFromHeader = true;
+
+			const uint8* Rgba = Attribute.value + 8;
+			for (int32 Pixel = 0; Pixel < OutPreview.Pixels.Num(); ++Pixel, Rgba += 4)
+			{
+				OutPreview.Pixels[Pixel] = FColor(Rgba[0], Rgba[1], Rgba[2], Rgba[3]);
+			}
+			return true;
+		}
 		return false;
 	}
 
+	static bool HasLevels(const EXRHeader& Header)
+	{
+		return Header.tiled && Header.tile_level_mode != TINYEXR_TILE_ONE_LEVEL;
+	}
+
+	// Level counts and sizes follow the OpenEXR tiling rules: each level halves the one above, rounding
+	// down or up as the header says, until a side reaches one pixel
+	static int32 GetNumLevels(int32 Size, bool bRoundUp)
+	{
+		return static_cast<int32>(bRoundUp ? FMath::CeilLogTwo(static_cast<uint32>(Size)) : FMath::FloorLog2(static_cast<uint32>(Size))) + 1;
+	}
+
+	static int32 GetLevelSize(int32 Size, int32 Level, bool bRoundUp)
+	{
+		return FMath::Max(1, bRoundUp ? (Size + (1 << Level) - 1) >> Level : Size >> Level);
+	}
+
+	// Which decoded channels make up RGBA, and the one sample type they are all decoded to
+	struct FChannelMap
+	{
+		int32 Channels[4] = { INDEX_NONE, INDEX_NONE, INDEX_NONE, INDEX_NONE };
+		EHdriVaultChannelLayout Layout = EHdriVaultChannelLayout::RGBA;
+		EHdriVaultPixelType PixelType = EHdriVaultPixelType::Half;
+	};
+
+	/**
+	 * Picks R, G, B and A by name, ignoring any layer prefix, or a lone luminance channel. Sets the
+	 * header's requested pixel types so the picked channels decode to a single sample type: half
+	 * channels stay half unless mixed with float ones, and are widened by the pixel kernels instead.
+	 */
+	static bool MapChannels(EXRHeader& Header, FChannelMap& OutMap, FString& OutError)
+	{
+		int32 Luminance = INDEX_NONE;
+		for (int32 Channel = 0; Channel < Header.num_channels; ++Channel)
+		{
+			Header.requested_pixel_types[Channel] = Header.channels[Channel].pixel_type;
+			if (Header.channels[Channel].pixel_type == TINYEXR_PIXELTYPE_UINT)
+			{
+				continue;
+			}
+
+			const ANSICHAR* Name = Header.channels[Channel].name;
+			if (const ANSICHAR* LastDot = FCStringAnsi::Strrchr(Name, '.'))
+			{
+				Name = LastDot + 1;
+			}
+
+			const int32 Component = FCStringAnsi::Strcmp(Name, "R") == 0 ? 0
+				: FCStringAnsi::Strcmp(Name, "G") == 0 ? 1
+				: FCStringAnsi::Strcmp(Name, "B") == 0 ? 2
+				: FCStringAnsi::Strcmp(Name, "A") == 0 ? 3
+				: INDEX_NONE;
+			if (Component != INDEX_NONE && OutMap.Channels[Component] == INDEX_NONE)
+			{
+				OutMap.Channels[Component] = Channel;
+			}
+			else if (Luminance == INDEX_NONE && (FCStringAnsi::Strcmp(Name, "Y") == 0 || Header.num_channels == 1))
+			{
+				Luminance = Channel;
+			}
+		}
+
+		if (OutMap.Channels[0] != INDEX_NONE && OutMap.Channels[1] != INDEX_NONE && OutMap.Channels[2] != INDEX_NONE)
+		{
+			OutMap.Layout = OutMap.Channels[3] != INDEX_NONE ? EHdriVaultChannelLayout::RGBA : EHdriVaultChannelLayout::RGB;
+		}
+		else if (Luminance != INDEX_NONE)
+		{
+			OutMap.Channels[0] = Luminance;
+			OutMap.Layout = EHdriVaultChannelLayout::Y;
+		}
+		else
+		{
+			OutError = TEXT("EXR has no RGB or luminance channels");
+			return false;
+		}
+
+		const int32 NumPlanes = FHdriVaultPixelKernels::GetNumPlanes(OutMap.Layout);
+		bool bAllHalf = true;
+		for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+		{
+			bAllHalf &= Header.channels[OutMap.Channels[Plane]].pixel_type == TINYEXR_PIXELTYPE_HALF;
+		}
+
+		OutMap.PixelType = bAllHalf ? EHdriVaultPixelType::Half : EHdriVaultPixelType::Float;
+		if (!bAllHalf)
+		{
+			for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+			{
+				Header.requested_pixel_types[OutMap.Channels[Plane]] = TINYEXR_PIXELTYPE_FLOAT;
+			}
+		}
+		return true;
+	}
+
+	// Interleaves Count pixels, starting at pixel Offset of each decoded channel image, into RGBA floats
+	static void InterleaveRgba(const FChannelMap& Map, const unsigned char* const* Images, int64 Offset, float* Dest, int32 Count)
+	{
+		const int64 SampleSize = Map.PixelType == EHdriVaultPixelType::Half ? sizeof(uint16) : sizeof(float);
+		const void* Planes[4] = {};
+		for (int32 Plane = 0; Plane < FHdriVaultPixelKernels::GetNumPlanes(Map.Layout); ++Plane)
+		{
+			Planes[Plane] = Images[Map.Channels[Plane]] + Offset * SampleSize;
+		}
+		FHdriVaultPixelKernels::PlanarToRgba(Planes, Map.PixelType, Map.Layout, Dest, Count);
+	}
+
+	static int32 ReadInt32(const uint8* Bytes)
+	{
+		return static_cast<int32>(uint32(Bytes[0]) | (uint32(Bytes[1]) << 8) | (uint32(Bytes[2]) << 16) | (uint32(Bytes[3]) << 24));
+	}
+
+	// Per-worker planar buffer that chunks decode into before being interleaved, with room for every
+	// channel at up to four bytes a sample
+	struct FDecodeContext
+	{
+		TArray<float> Pixels;
+		TArray<unsigned char*> Images;
+
+		unsigned char** Get(int32 NumChannels, int32 Area)
+		{
+			if (Images.Num() != NumChannels || Pixels.Num() != NumChannels * Area)
+			{
+				Pixels.SetNumUninitialized(NumChannels * Area);
+				Images.Reset(NumChannels);
+				for (int32 Channel = 0; Channel < NumChannels; ++Channel)
+				{
+					Images.Add(reinterpret_cast<unsigned char*>(Pixels.GetData() + Channel * Area));
+				}
+			}
+			return Images.GetData();
+		}
+	};
+
+	/**
+	 * Decodes a single level of a tiled EXR into interleaved RGBA floats. Only the part of the offset
+	 * table covering that level and that level's own tiles are read, so a small level of a large file
+	 * costs a handful of reads. A missing alpha reads as one.
+	 */
+	static bool LoadLevel(FArchive& Archive, FScopedHeader& InHeader, int32 MaxWidth, TArray<float>& OutRgba, int32& OutWidth, int32& OutHeight, FString& OutError)
+	{
+		EXRHeader& Header = InHeader.Header;
+		const int32 Width = Header.data_window[2] - Header.data_window[0] + 1;
+		const int32 Height = Header.data_window[3] - Header.data_window[1] + 1;
+		const int32 TileSizeX = Header.tile_size_x;
+		const int32 TileSizeY = Header.tile_size_y;
+		if (Width <= 0 || Height <= 0 || int64(Width) * Height > MAX_int32 / 4 || TileSizeX <= 0 || TileSizeY <= 0 || int64(TileSizeX) * TileSizeY > 4096 * 4096)
+		{
+			OutError = TEXT("Invalid EXR data window or tile size");
+			return false;
+		}
+
+		// Mip levels shrink both sides together; rip levels shrink them independently, and the level used
+		// here keeps the source aspect
+		const bool bRoundUp = Header.tile_rounding_mode == TINYEXR_TILE_ROUND_UP;
+		const bool bRipMap = Header.tile_level_mode == TINYEXR_TILE_RIPMAP_LEVELS;
+		int32 NumLevelsX = 1;
+		int32 NumLevelsY = 1;
+		if (bRipMap)
+		{
+			NumLevelsX = GetNumLevels(Width, bRoundUp);
+			NumLevelsY = GetNumLevels(Height, bRoundUp);
+		}
+		else if (Header.tile_level_mode == TINYEXR_TILE_MIPMAP_LEVELS)
+		{
+			NumLevelsX = NumLevelsY = GetNumLevels(FMath::Max(Width, Height), bRoundUp);
+		}
+
+		int32 LevelX = 0;
+		while (LevelX + 1 < NumLevelsX && GetLevelSize(Width, LevelX, bRoundUp) > MaxWidth)
+		{
+			++LevelX;
+		}
+		const int32 LevelY = FMath::Min(LevelX, NumLevelsY - 1);
+
+		auto GetNumTiles = [&](int32 InLevelX, int32 InLevelY, int32& OutNumX, int32& OutNumY)
+		{
+			OutNumX = FMath::DivideAndRoundUp(GetLevelSize(Width, InLevelX, bRoundUp), TileSizeX);
+			OutNumY = FMath::DivideAndRoundUp(GetLevelSize(Height, InLevelY, bRoundUp), TileSizeY);
+		};
+
+		// The offset table lists every tile of every level in order: mip levels from the largest down,
+		// rip levels row by row
+		int64 FirstTile = 0;
+		int32 NumX = 0;
+		int32 NumY = 0;
+		if (bRipMap)
+		{
+			for (int32 Y = 0; Y <= LevelY; ++Y)
+			{
+				for (int32 X = 0; X < (Y < LevelY ? NumLevelsX : LevelX); ++X)
+				{
+					GetNumTiles(X, Y, NumX, NumY);
+					FirstTile += int64(NumX) * NumY;
+				}
+			}
+		}
+		else
+		{
+			for (int32 Level = 0; Level < LevelX; ++Level)
+			{
+				GetNumTiles(Level, Level, NumX, NumY);
+				FirstTile += int64(NumX) * NumY;
+			}
+		}
+
+		GetNumTiles(LevelX, LevelY, NumX, NumY);
+		const int32 NumTiles = NumX * NumY;
+		OutWidth = GetLevelSize(Width, LevelX, bRoundUp);
+		OutHeight = GetLevelSize(Height, LevelY, bRoundUp);
+
+		TArray<uint8> OffsetBytes;
+		OffsetBytes.SetNumUninitialized(NumTiles * 8);
+		const int64 TableStart = InHeader.HeaderSize + FirstTile * 8;
+		if (TableStart + OffsetBytes.Num() > Archive.TotalSize())
+		{
+			OutError = TEXT("Truncated EXR offset table");
+			return false;
+		}
+		Archive.Seek(TableStart);
+		Archive.Serialize(OffsetBytes.GetData(), OffsetBytes.Num());
+		if (Archive.IsError())
+		{
+			OutError = TEXT("Could not read the EXR offset table");
+			return false;
+		}
+
+		// Tiles decode to planar channels, which are interleaved a row at a time
+		FChannelMap ChannelMap;
+		if (!MapChannels(Header, ChannelMap, OutError))
+		{
+			return false;
+		}
+
+		std::vector<size_t> ChannelOffsets;
+		int PixelDataSize = 0;
+		size_t ChannelOffset = 0;
+		if (!tinyexr::ComputeChannelLayout(&ChannelOffsets, &PixelDataSize, &ChannelOffset, Header.num_channels, Header.channels))
+		{
+			OutError = TEXT("Unsupported EXR channel layout");
+			return false;
+		}
+
+		OutRgba.SetNumZeroed(OutWidth * OutHeight * 4);
+
+		// Tiles are read in file order, then decoded and interleaved in parallel
+		struct FTile
+		{
+			int64 Offset = 0;
+			int32 Size = 0;
+			int32 X = 0;
+			int32 Y = 0;
+		};
+		TArray<FTile> Tiles;
+		Tiles.SetNum(NumTiles);
+		TArray64<uint8> TileData;
+		for (int32 Tile = 0; Tile < NumTiles; ++Tile)
+		{
+			uint64 Offset = 0;
+			FMemory::Memcpy(&Offset, OffsetBytes.GetData() + Tile * 8, 8);
+
+			// Each chunk starts with its tile and level coordinates and the size of its data
+			uint8 ChunkHeader[20];
+			if (Offset + sizeof(ChunkHeader) > uint64(Archive.TotalSize()))
+			{
+				OutError = TEXT("Invalid EXR tile offset");
+				return false;
+			}
+			Archive.Seek(static_cast<int64>(Offset));
+			Archive.Serialize(ChunkHeader, sizeof(ChunkHeader));
+
+			FTile& Entry = Tiles[Tile];
+			Entry.X = ReadInt32(ChunkHeader);
+			Entry.Y = ReadInt32(ChunkHeader + 4);
+			Entry.Size = ReadInt32(ChunkHeader + 16);
+			if (ReadInt32(ChunkHeader + 8) != LevelX || ReadInt32(ChunkHeader + 12) != LevelY
+				|| Entry.X < 0 || Entry.X >= NumX || Entry.Y < 0 || Entry.Y >= NumY
+				|| Entry.Size <= 0 || Offset + sizeof(ChunkHeader) + Entry.Size > uint64(Archive.TotalSize()))
+			{
+				OutError = TEXT("Corrupt EXR tile");
+				return false;
+			}
+
+			Entry.Offset = TileData.Num();
+			TileData.AddUninitialized(Entry.Size);
+			Archive.Serialize(TileData.GetData() + Entry.Offset, Entry.Size);
+			if (Archive.IsError())
+			{
+				OutError = TEXT("Could not read EXR tile data");
+				return false;
+			}
+		}
+
+		const int32 TileArea = TileSizeX * TileSizeY;
+		std::atomic<bool> bFailed(false);
+		TArray<FDecodeContext> Contexts;
+		ParallelForWithTaskContext(Contexts, NumTiles,
+			[&](FDecodeContext& Context, int32 Tile)
+			{
+				if (bFailed.load(std::memory_order_relaxed))
+				{
+					return;
+				}
+
+				// Line order says how chunks are stored in the file, not how rows run inside a tile
+				const FTile& Entry = Tiles[Tile];
+				unsigned char** ChannelImages = Context.Get(Header.num_channels, TileArea);
+				int TileWidth = 0;
+				int TileHeight = 0;
+				if (!tinyexr::DecodeTiledPixelData(ChannelImages, &TileWidth, &TileHeight, Header.requested_pixel_types,
+					TileData.GetData() + Entry.Offset, static_cast<size_t>(Entry.Size), Header.compression_type, 0, OutWidth, OutHeight,
+					Entry.X, Entry.Y, TileSizeX, TileSizeY, static_cast<size_t>(PixelDataSize),
+					static_cast<size_t>(Header.num_custom_attributes), Header.custom_attributes,
+					static_cast<size_t>(Header.num_channels), Header.channels, ChannelOffsets))
+				{
+					bFailed = true;
+					return;
+				}
+
+				// Tiles do not overlap, so workers write to disjoint parts of the output
+				for (int32 Y = 0; Y < TileHeight; ++Y)
+				{
+					float* Row = OutRgba.GetData() + (int64(Entry.Y * TileSizeY + Y) * OutWidth + Entry.X * TileSizeX) * 4;
+					InterleaveRgba(ChannelMap, ChannelImages, int64(Y) * TileSizeX, Row, TileWidth);
+				}
+			});
+
+		if (bFailed)
+		{
+			OutError = TEXT("Failed to decode EXR tile");
+			return false;
+		}
+		return true;
+	}
+
+	/**
+	 * Decodes a scanline EXR into interleaved RGBA floats, chunks in parallel. Chunks are read in one go
+	 * from the end of the offset table, decoded to per-worker planar buffers and interleaved straight into
+	 * their rows of the output. Rows always run top to bottom; line order only says how chunks are stored.
+	 */
+	static bool LoadScanlineImage(FArchive& Archive, FScopedHeader& InHeader, TArray<float>& OutRgba, int32& OutWidth, int32& OutHeight, FString& OutError)
+	{
+		EXRHeader& Header = InHeader.Header;
+		const int32 Width = Header.data_window[2] - Header.data_window[0] + 1;
+		const int32 Height = Header.data_window[3] - Header.data_window[1] + 1;
+		if (Width <= 0 || Height <= 0 || int64(Width) * Height > MAX_int32 / 4)
+		{
+			OutError = TEXT("Invalid EXR data window");
+			return false;
+		}
+
+		FChannelMap ChannelMap;
+		if (!MapChannels(Header, ChannelMap, OutError))
+		{
+			return false;
+		}
+
+		std::vector<size_t> ChannelOffsets;
+		int PixelDataSize = 0;
+		size_t ChannelOffset = 0;
+		if (!tinyexr::ComputeChannelLayout(&ChannelOffsets, &PixelDataSize, &ChannelOffset, Header.num_channels, Header.channels))
+		{
+			OutError = TEXT("Unsupported EXR channel layout");
+			return false;
+		}
+
+		const int32 LinesPerChunk = GetLinesPerChunk(Header.compression_type);
+		const int32 NumChunks = FMath::DivideAndRoundUp(Height, LinesPerChunk);
+		const int64 TableStart = InHeader.HeaderSize;
+		const int64 DataStart = TableStart + int64(NumChunks) * 8;
+		const int64 FileSize = Archive.TotalSize();
+		if (DataStart > FileSize)
+		{
+			OutError = TEXT("Truncated EXR offset table");
+			return false;
+		}
+
+		// Everything after the offset table is chunk data
+		TArray64<uint8> FileData;
+		FileData.SetNumUninitialized(FileSize - TableStart);
+		Archive.Seek(TableStart);
+		Archive.Serialize(FileData.GetData(), FileData.Num());
+		if (Archive.IsError())
+		{
+			OutError = TEXT("Could not read EXR chunk data");
+			return false;
+		}
+
+		// Each chunk starts with the y coordinate of its first line and the size of its data, and the
+		// table lists chunks top to bottom whatever order they are stored in
+		struct FChunk
+		{
+			int64 Offset = 0;
+			int32 Size = 0;
+		};
+		TArray<FChunk> Chunks;
+		Chunks.SetNum(NumChunks);
+		const int64 RawLineSize = int64(Width) * PixelDataSize;
+		for (int32 Index = 0; Index < NumChunks; ++Index)
+		{
+			uint64 Offset = 0;
+			FMemory::Memcpy(&Offset, FileData.GetData() + int64(Index) * 8, 8);
+			if (Offset < uint64(DataStart) || Offset + 8 > uint64(FileSize))
+			{
+				OutError = TEXT("Invalid EXR chunk offset");
+				return false;
+			}
+
+			const uint8* ChunkHeader = FileData.GetData() + (Offset - TableStart);
+			const int32 FirstLine = Header.data_window[1] + Index * LinesPerChunk;
+			const int32 NumLines = FMath::Min(LinesPerChunk, Height - Index * LinesPerChunk);
+			FChunk& Chunk = Chunks[Index];
+			Chunk.Offset = Offset - TableStart + 8;
+			Chunk.Size = ReadInt32(ChunkHeader + 4);
+			if (ReadInt32(ChunkHeader) != FirstLine || Chunk.Size <= 0 || Offset + 8 + Chunk.Size > uint64(FileSize)
+				|| (Header.compression_type == TINYEXR_COMPRESSIONTYPE_NONE && Chunk.Size < RawLineSize * NumLines))
+			{
+				OutError = TEXT("Corrupt EXR chunk");
+				return false;
+			}
+		}
+
+		OutWidth = Width;
+		OutHeight = Height;
+		OutRgba.SetNumUninitialized(OutWidth * OutHeight * 4);
+
+		const int32 ChunkArea = Width * FMath::Min(LinesPerChunk, Height);
+		std::atomic<bool> bFailed(false);
+		TArray<FDecodeContext> Contexts;
+		ParallelForWithTaskContext(Contexts, NumChunks,
+			[&](FDecodeContext& Context, int32 Index)
+			{
+				if (bFailed.load(std::memory_order_relaxed))
+				{
+					return;
+				}
+
+				const FChunk& Chunk = Chunks[Index];
+				const int32 NumLines = FMath::Min(LinesPerChunk, Height - Index * LinesPerChunk);
+				unsigned char** ChannelImages = Context.Get(Header.num_channels, ChunkArea);
+				if (!tinyexr::DecodePixelData(ChannelImages, Header.requested_pixel_types,
+					FileData.GetData() + Chunk.Offset, static_cast<size_t>(Chunk.Size), Header.compression_type, 0,
+					Width, NumLines, Width, 0, 0, NumLines, static_cast<size_t>(PixelDataSize),
+					static_cast<size_t>(Header.num_custom_attributes), Header.custom_attributes,
+					static_cast<size_t>(Header.num_channels), Header.channels, ChannelOffsets))
+				{
+					bFailed = true;
+					return;
+				}
+
+				float* Rows = OutRgba.GetData() + int64(Index) * ChunkArea * 4;
+				InterleaveRgba(ChannelMap, ChannelImages, 0, Rows, Width * NumLines);
+			});
+
+		if (bFailed)
+		{
+			OutError = TEXT("Failed to decode EXR chunk");
+			return false;
+		}
+		return true;
+	}
+
+	// Where one compressed chunk's zlib stream sits in a file
+	struct FZipChunk
+	{
+		int64 Offset = 0;
+		int32 Size = 0;
+	};
+
+	/**
+	 * Finds the zlib streams of a single-part ZIP or ZIPS file, for benchmarking. The offset table ends
+	 * where the first chunk starts, which gives the number of chunks without working out the tile layout.
+	 * Chunks stored uncompressed are left out.
+	 * @param OutMaxInflatedSize - Largest size a chunk can inflate to
+	 */
+	static bool FindZipChunks(const TArray<uint8>& FileData, TArray<FZipChunk>& OutChunks, int64& OutMaxInflatedSize, FString& OutError)
+	{
+		FMemoryReader Archive(FileData);
+		FScopedHeader Header;
+		if (!ReadHeader(Archive, Header, OutError))
+		{
+			return false;
+		}
+
+		const EXRHeader& ExrHeader = Header.Header;
+		if (ExrHeader.compression_type != TINYEXR_COMPRESSIONTYPE_ZIP && ExrHeader.compression_type != TINYEXR_COMPRESSIONTYPE_ZIPS)
+		{
+			OutError = TEXT("Not ZIP compressed");
+			return false;
+		}
+
+		int64 PixelSize = 0;
+		for (int32 Channel = 0; Channel < ExrHeader.num_channels; ++Channel)
+		{
+			PixelSize += ExrHeader.pixel_types[Channel] == TINYEXR_PIXELTYPE_HALF ? 2 : 4;
+		}
+		const int64 Width = int64(ExrHeader.data_window[2]) - ExrHeader.data_window[0] + 1;
+		const int64 LinesPerChunk = GetLinesPerChunk(ExrHeader.compression_type);
+		OutMaxInflatedSize = ExrHeader.tiled
+			? int64(ExrHeader.tile_size_x) * ExrHeader.tile_size_y * PixelSize
+			: Width * LinesPerChunk * PixelSize;
+		if (OutMaxInflatedSize <= 0 || OutMaxInflatedSize > MAX_int32)
+		{
+			OutError = TEXT("Invalid EXR data window or tile size");
+			return false;
+		}
+
+		const int64 TableStart = Header.HeaderSize;
+		if (TableStart + 8 > FileData.Num())
+		{
+			OutError = TEXT("Truncated EXR offset table");
+			return false;
+		}
+
+		auto ReadOffset = [&FileData](int64 Position)
+		{
+			uint64 Offset = 0;
+			for (int32 Byte = 7; Byte >= 0; --Byte)
+			{
+				Offset = (Offset << 8) | FileData.GetData()[Position + Byte];
+			}
+			return Offset;
+		};
+
+		const uint64 FirstChunk = ReadOffset(TableStart);
+		if (FirstChunk <= uint64(TableStart) || FirstChunk > uint64(FileData.Num()) || (FirstChunk - TableStart) % 8 != 0)
+		{
+			OutError = TEXT("Corrupt EXR offset table");
+			return false;
+		}
+
+		// Scanline chunks start with their y coordinate, tiles with four tile and level coordinates
+		const int64 CoordinateSize = ExrHeader.tiled ? 16 : 4;
+		const int64 NumChunks = (FirstChunk - TableStart) / 8;
+		OutChunks.Reset(static_cast<int32>(NumChunks));
+		for (int64 Index = 0; Index < NumChunks; ++Index)
+		{
+			const uint64 ChunkStart = ReadOffset(TableStart + Index * 8);
+			if (ChunkStart > uint64(FileData.Num()) || ChunkStart + CoordinateSize + 4 > uint64(FileData.Num()))
+			{
+				OutError = TEXT("Corrupt EXR offset table");
+				return false;
+			}
+
+			FZipChunk Chunk;
+			Chunk.Offset = ChunkStart + CoordinateSize + 4;
+			Chunk.Size = ReadInt32(FileData.GetData() + Chunk.Offset - 4);
+			if (Chunk.Size < 2 || Chunk.Offset + Chunk.Size > FileData.Num())
+			{
+				OutError = TEXT("Corrupt EXR chunk");
+				return false;
+			}
+
+			// A zlib stream opens with a deflate method byte and a header check that is a multiple of 31
+			const uint8 Method = FileData.GetData()[Chunk.Offset];
+			const uint8 Flags = FileData.GetData()[Chunk.Offset + 1];
+			if ((Method & 0x0f) == 8 && ((uint32(Method) << 8) | Flags) % 31 == 0)
+			{
+				OutChunks.Add(Chunk);
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Times chunk decoding of the ZIP and ZIPS EXRs at a path, on this thread. Reports raw inflate
+	 * throughput of tinyexr's miniz and of the backend compiled in, checks that both inflate to the same
+	 * bytes, and times tinyexr's full chunk decode (inflate, predictor and byte reordering) as used on import.
+	 */
+	static void BenchmarkInflate(const TArray<FString>& Args)
+	{
+		if (Args.Num() == 0)
+		{
+			UE_LOG(LogTemp, Display, TEXT("HdriVault: Usage: HdriVault.BenchmarkExrInflate <file or folder> [passes]"));
+			return;
+		}
+
+		const FString Path = Args[0];
+		const int32 NumPasses = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 3;
+
+		TArray<FString> Files;
+		if (FPaths::DirectoryExists(Path))
+		{
+			IFileManager::Get().FindFilesRecursive(Files, *Path, TEXT("*.exr"), true, false);
+		}
+		else
+		{
+			Files.Add(Path);
+		}
+
+		int32 NumFiles = 0;
+		int64 NumChunks = 0;
+		int64 CompressedBytes = 0;
+		int64 InflatedBytes = 0;
+		int32 NumMismatches = 0;
+		double MinizSeconds = 0.0;
+		double BackendSeconds = 0.0;
+		double DecodeSeconds = 0.0;
+
+		for (const FString& File : Files)
+		{
+			TArray<uint8> FileData;
+			TArray<FZipChunk> Chunks;
+			int64 MaxInflatedSize = 0;
+			FString Error;
+			if (!FFileHelper::LoadFileToArray(FileData, *File) || !FindZipChunks(FileData, Chunks, MaxInflatedSize, Error) || Chunks.Num() == 0)
+			{
+				UE_LOG(LogTemp, Verbose, TEXT("HdriVault: Skipping %s: %s"), *File, *Error);
+				continue;
+			}
+
+			TArray<uint8> MinizOutput;
+			TArray<uint8> BackendOutput;
+			MinizOutput.SetNumUninitialized(static_cast<int32>(MaxInflatedSize));
+			BackendOutput.SetNumUninitialized(static_cast<int32>(MaxInflatedSize));
+
+			// Correctness first, which also warms the file data and the backend
+			bool bFileDecodes = true;
+			int64 FileInflatedBytes = 0;
+			for (const FZipChunk& Chunk : Chunks)
+			{
+				tinyexr::miniz::mz_ulong MinizSize = static_cast<tinyexr::miniz::mz_ulong>(MaxInflatedSize);
+				if (tinyexr::miniz::mz_uncompress(MinizOutput.GetData(), &MinizSize, FileData.GetData() + Chunk.Offset, Chunk.Size) != tinyexr::miniz::MZ_OK)
+				{
+					bFileDecodes = false;
+					break;
+				}
+				FileInflatedBytes += MinizSize;
+
+				int64 BackendSize = 0;
+				if (FHdriVaultInflate::IsAvailable()
+					&& (!FHdriVaultInflate::Uncompress(BackendOutput.GetData(), MaxInflatedSize, FileData.GetData() + Chunk.Offset, Chunk.Size, BackendSize)
+						|| BackendSize != int64(MinizSize)
+						|| FMemory::Memcmp(MinizOutput.GetData(), BackendOutput.GetData(), MinizSize) != 0))
+				{
+					++NumMismatches;
+				}
+			}
+			if (!bFileDecodes)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("HdriVault: Skipping %s: miniz could not inflate a chunk"), *File);
+				continue;
+			}
+
+			// Best of several passes, so a stray page fault or context switch does not skew a file
+			auto TimeBestPass = [NumPasses, &Chunks](TFunctionRef<void(const FZipChunk&)> DecodeChunk)
+			{
+				double BestSeconds = MAX_dbl;
+				for (int32 Pass = 0; Pass < NumPasses; ++Pass)
+				{
+					const double StartTime = FPlatformTime::Seconds();
+					for (const FZipChunk& Chunk : Chunks)
+					{
+						DecodeChunk(Chunk);
+					}
+					BestSeconds = FMath::Min(BestSeconds, FPlatformTime::Seconds() - StartTime);
+				}
+				return BestSeconds;
+			};
+
+			MinizSeconds += TimeBestPass([&](const FZipChunk& Chunk)
+			{
+				tinyexr::miniz::mz_ulong Size = static_cast<tinyexr::miniz::mz_ulong>(MaxInflatedSize);
+				tinyexr::miniz::mz_uncompress(MinizOutput.GetData(), &Size, FileData.GetData() + Chunk.Offset, Chunk.Size);
+			});
+
+			if (FHdriVaultInflate::IsAvailable())
+			{
+				BackendSeconds += TimeBestPass([&](const FZipChunk& Chunk)
+				{
+					int64 Size = 0;
+					FHdriVaultInflate::Uncompress(BackendOutput.GetData(), MaxInflatedSize, FileData.GetData() + Chunk.Offset, Chunk.Size, Size);
+				});
+			}
+
+			DecodeSeconds += TimeBestPass([&](const FZipChunk& Chunk)
+			{
+				unsigned long Size = static_cast<unsigned long>(MaxInflatedSize);
+				tinyexr::DecompressZip(BackendOutput.GetData(), &Size, FileData.GetData() + Chunk.Offset, static_cast<unsigned long>(Chunk.Size));
+			});
+
+			++NumFiles;
+			NumChunks += Chunks.Num();
+			InflatedBytes += FileInflatedBytes;
+			for (const FZipChunk& Chunk : Chunks)
+			{
+				CompressedBytes += Chunk.Size;
+			}
+		}
+
+		if (NumFiles == 0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("HdriVault: No ZIP or ZIPS compressed EXRs found at %s"), *Path);
+			return;
+		}
+
+		auto GetThroughput = [InflatedBytes](double Seconds)
+		{
+			return Seconds > 0.0 ? double(InflatedBytes) / (1024.0 * 1024.0) / Seconds : 0.0;
+		};
+
+		UE_LOG(LogTemp, Display, TEXT("HdriVault: Inflated %lld chunks from %d files, %.1f MB to %.1f MB, best of %d passes"),
+			NumChunks, NumFiles, CompressedBytes / (1024.0 * 1024.0), InflatedBytes / (1024.0 * 1024.0), NumPasses);
+		UE_LOG(LogTemp, Display, TEXT("HdriVault:   miniz inflate: %.0f MB/s"), GetThroughput(MinizSeconds));
+		if (FHdriVaultInflate::IsAvailable())
+		{
+			UE_LOG(LogTemp, Display, TEXT("HdriVault:   %s inflate: %.0f MB/s (%.2fx miniz)"),
+				FHdriVaultInflate::GetBackendName(), GetThroughput(BackendSeconds), BackendSeconds > 0.0 ? MinizSeconds / BackendSeconds : 0.0);
+		}
+		UE_LOG(LogTemp, Display, TEXT("HdriVault:   Chunk decode with %s: %.0f MB/s"), FHdriVaultInflate::GetBackendName(), GetThroughput(DecodeSeconds));
+
+		if (NumMismatches > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("HdriVault: %s inflated %d chunks differently from miniz"), FHdriVaultInflate::GetBackendName(), NumMismatches);
+		}
+	}
+
+	static FAutoConsoleCommand BenchmarkInflateCommand(
+		TEXT("HdriVault.BenchmarkExrInflate"),
+		TEXT("Times ZIP chunk decoding of the EXRs in a file or folder with miniz and the inflate backend compiled in. Usage: HdriVault.BenchmarkExrInflate <file or folder> [passes]"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&BenchmarkInflate));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHdriVaultInflateTest, "HdriVault.Inflate.MatchMiniz",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHdriVaultInflateTest::RunTest(const FString& Parameters)
+{
+	using namespace tinyexr::miniz;
+
+	if (!FHdriVaultInflate::IsAvailable())
+	{
+		AddInfo(TEXT("No inflate backend compiled in; EXR chunks are inflated by miniz"));
+		return true;
+	}
+	AddInfo(FString::Printf(TEXT("Inflate backend: %s"), FHdriVaultInflate::GetBackendName()));
+
+	// Half-float samples like a ZIP chunk holds: a smooth gradient, noise, then a run of one value
+	FRandomStream Random(0x5a495053);
+	const int32 NumSamples = 64 * 1024 + 7;
+	TArray<uint8> Source;
+	Source.Reserve(NumSamples * 2);
+	for (int32 Index = 0; Index < NumSamples; ++Index)
+	{
+		uint16 Half = 0x3c00;
+		if (Index < NumSamples / 3)
+		{
+			Half = FHdriVaultPixelKernels::FloatToHalfScalar(Index / 1024.0f);
+		}
+		else if (Index < NumSamples * 2 / 3)
+		{
+			Half = static_cast<uint16>(Random.RandHelper(0x7c00));
+		}
+		Source.Add(static_cast<uint8>(Half & 0xff));
+		Source.Add(static_cast<uint8>(Half >> 8));
+	}
+
+	TArray<uint8> Compressed;
+	TArray<uint8> MinizOutput;
+	TArray<uint8> BackendOutput;
+	MinizOutput.SetNumUninitialized(Source.Num());
+	BackendOutput.SetNumUninitialized(Source.Num());
+
+	// Stored, fast and best levels between them produce stored, fixed and dynamic Huffman blocks
+	for (const int32 Level : { 0, 1, 6, 9 })
+	{
+		mz_ulong CompressedSize = mz_compressBound(static_cast<mz_ulong>(Source.Num()));
+		Compressed.SetNumUninitialized(static_cast<int32>(CompressedSize));
+		if (!TestEqual(FString::Printf(TEXT("Level %d compress result"), Level),
+			mz_compress2(Compressed.GetData(), &CompressedSize, Source.GetData(), static_cast<mz_ulong>(Source.Num()), Level), int32(MZ_OK)))
+		{
+			continue;
+		}
+
+		mz_ulong MinizSize = static_cast<mz_ulong>(Source.Num());
+		const bool bMinizInflated = mz_uncompress(MinizOutput.GetData(), &MinizSize, Compressed.GetData(), CompressedSize) == MZ_OK;
+		int64 BackendSize = 0;
+		const bool bBackendInflated = FHdriVaultInflate::Uncompress(BackendOutput.GetData(), BackendOutput.Num(), Compressed.GetData(), CompressedSize, BackendSize);
+		TestTrue(FString::Printf(TEXT("Level %d stream inflates with miniz"), Level), bMinizInflated);
+		if (!TestTrue(FString::Printf(TEXT("Level %d stream inflates with the backend"), Level), bBackendInflated))
+		{
+			continue;
+		}
+		TestEqual(FString::Printf(TEXT("Level %d inflated size"), Level), BackendSize, int64(MinizSize));
+		TestTrue(FString::Printf(TEXT("Level %d backend output matches miniz and the source"), Level),
+			BackendSize == Source.Num() && FMemory::Memcmp(BackendOutput.GetData(), MinizOutput.GetData(), Source.Num()) == 0
+			&& FMemory::Memcmp(BackendOutput.GetData(), Source.GetData(), Source.Num()) == 0);
+
+		// Chunks that do not fit or are cut short must fail rather than hand back partial data
+		TestFalse(FString::Printf(TEXT("Level %d stream inflates into a buffer one byte short"), Level),
+			FHdriVaultInflate::Uncompress(BackendOutput.GetData(), BackendOutput.Num() - 1, Compressed.GetData(), CompressedSize, BackendSize));
+		TestFalse(FString::Printf(TEXT("Level %d stream inflates when truncated"), Level),
+			FHdriVaultInflate::Uncompress(BackendOutput.GetData(), BackendOutput.Num(), Compressed.GetData(), CompressedSize / 2, BackendSize));
+	}
+	return true;
+}
+
+#endif
+
+namespace HdriVaultRadianceUtils
+{
+	using HdriVaultImageFileUtils::FByteReader;
+
+	static bool ReadHeader(FByteReader& Reader, int32& OutWidth, int32& OutHeight, FString& OutError)
+	{
+		FString Line;
+		if (!Reader.ReadLine(Line) || !(Line.StartsWith(TEXT("#?RADIANCE")) || Line.StartsWith(TEXT("#?RGBE"))))
+		{
+			OutError = TEXT("Not a Radiance HDR file");
+			return false;
+		}
+
+		// Variables run up to the first empty line
+		for (;;)
+		{
+			if (!Reader.ReadLine(Line))
+			{
+				OutError = TEXT("Truncated HDR header");
+				return false;
+			}
+			if (Line.IsEmpty())
+			{
+				break;
+			}
+			if (Line.StartsWith(TEXT("FORMAT=")) && Line != TEXT("FORMAT=32-bit_rle_rgbe"))
+			{
+				OutError = FString::Printf(TEXT("Unsupported HDR pixel format: %s"), *Line);
+				return false;
+			}
+		}
+
+		// Resolution string, normally "-Y <rows> +X <columns>"
+		TArray<FString> Tokens;
+		if (!Reader.ReadLine(Line) || Line.ParseIntoArrayWS(Tokens) != 4)
+		{
+			OutError = TEXT("Missing HDR resolution string");
+			return false;
+		}
+
+		const int32 First = FCString::Atoi(*Tokens[1]);
+		const int32 Second = FCString::Atoi(*Tokens[3]);
+		const bool bRowsFirst = Tokens[0].EndsWith(TEXT("Y"));
+		OutWidth = bRowsFirst ? Second : First;
+		OutHeight = bRowsFirst ? First : Second;
+
+		if (OutWidth <= 0 || OutHeight <= 0)
+		{
+			OutError = FString::Printf(TEXT("Invalid HDR resolution: %s"), *Line);
+			return false;
+		}
+		return true;
+	}
+
+	// Decodes one scanline into OutRgbe (Width * 4 bytes): run-length encoded per channel, or flat
+	// pixels with the old-style (1, 1, 1, count) repeats
+	static bool ReadScanline(FByteReader& Reader, int32 Width, uint8* OutRgbe)
+	{
+		uint8 Pixel[4];
+		if (!Reader.ReadBytes(Pixel, 4))
+		{
+			return false;
+		}
+
+		const bool bChannelRle = Width >= 8 && Width < 32768 && Pixel[0] == 2 && Pixel[1] == 2 && (Pixel[2] & 0x80) == 0;
+		if (!bChannelRle)
+		{
+			int32 X = 0;
+			int32 RepeatShift = 0;
+			for (;;)
+			{
+				if (Pixel[0] == 1 && Pixel[1] == 1 && Pixel[2] == 1)
+				{
+					const int32 Count = static_cast<int32>(Pixel[3]) << RepeatShift;
+					if (X == 0 || X + Count > Width)
+					{
+						return false;
+					}
+					for (int32 Index = 0; Index < Count; ++Index, ++X)
+					{
+						FMemory::Memcpy(OutRgbe + X * 4, OutRgbe + (X - 1) * 4, 4);
+					}
+					RepeatShift += 8;
+				}
+				else
+				{
+					FMemory::Memcpy(OutRgbe + X * 4, Pixel, 4);
+					++X;
+					RepeatShift = 0;
+				}
+
+				if (X >= Width)
+				{
+					return true;
+				}
+				if (!Reader.ReadBytes(Pixel, 4))
+				{
+					return false;
+				}
+			}
+		}
+
+		if (((Pixel[2] << 8) | Pixel[3]) != Width)
+		{
+			return false;
+		}
+
+		for (int32 Channel = 0; Channel < 4; ++Channel)
+		{
+			int32 X = 0;
+			while (X < Width)
+			{
+				uint8 Count = 0;
+				if (!Reader.ReadByte(Count))
+				{
+					return false;
+				}
+
+				if (Count > 128)
+				{
+					// A run of one value
+					Count -= 128;
+					uint8 Value = 0;
+					if (X + Count > Width || !Reader.ReadByte(Value))
+					{
+						return false;
+					}
+					for (int32 Index = 0; Index < Count; ++Index)
+					{
+						OutRgbe[(X++) * 4 + Channel] = Value;
+					}
+				}
+				else
+				{
+					// Count literal values
+					if (Count == 0 || X + Count > Width)
+					{
+						return false;
+					}
+					for (int32 Index = 0; Index < Count; ++Index)
+					{
+						if (!Reader.ReadByte(OutRgbe[(X++) * 4 + Channel]))
+						{
+							return false;
+						}
+					}
+				}
+			}
+		}
+		return true;
+	}
+}
+
+int64 FHdriVaultImageInfo::GetEstimatedMemoryBytes() const
+{
+	if (Width <= 0 || Height <= 0)
+	{
+		return 0;
+	}
+
+	// Long-lat sources become cube faces of half the source width, rounded down to a power of two
+	const int64 FaceSize = FMath::Max<int64>(32, int64(1) << FMath::FloorLog2(static_cast<uint32>(FMath::Max(Width / 2, 1))));
+	const int64 TopMipBytes = 6 * FaceSize * FaceSize * 8;
+	return TopMipBytes * 4 / 3;
+}
+
+bool FHdriVaultImageUtils::ConvertExrToHdr(const FString& InputFile, const FString& OutputFile, FString& OutError, FHdriVaultImageInfo* OutInfo, FHdriVaultImagePreview* OutPreview)
+{
+	// Files are read through the engine's file system, so paths are not limited to what fopen accepts
+	TArray<float> Pixels; // width * height * 4
+	int32 Width = 0;
+	int32 Height = 0;
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*InputFile));
+		if (!Archive)
+		{
+			OutError = FString::Printf(TEXT("Could not open %s"), *InputFile);
+			return false;
+		}
+
+		HdriVaultExrUtils::FScopedHeader Header;
+		if (!HdriVaultExrUtils::ReadHeader(*Archive, Header, OutError))
+		{
+			return false;
+		}
+
+		// Tiled files go through the level reader, which unlike tinyexr also handles mip and rip levels
+		if (Header.Header.tiled)
+		{
+			if (!HdriVaultExrUtils::LoadLevel(*Archive, Header, MAX_int32, Pixels, Width, Height, OutError))
+			{
+				return false;
+			}
+		}
+		else if (!HdriVaultExrUtils::LoadScanlineImage(*Archive, Header, Pixels, Width, Height, OutError))
+		{
+			return false;
+		}
+	}
+	const float* Rgba = Pixels.GetData();
+
+	if (OutInfo)
+	{
+		OutInfo->Width = Width;
+		OutInfo->Height = Height;
+		OutInfo->PeakLuminance = 0.0f;
+		const int64 NumPixels = int64(Width) * Height;
+		for (int64 Index = 0; Index < NumPixels; ++Index)
+		{
+			const float* Pixel = Rgba + Index * 4;
+			const float Luminance = HdriVaultImageFileUtils::GetLuminance(Pixel[0], Pixel[1], Pixel[2]);
+			if (FMath::IsFinite(Luminance))
+			{
+				OutInfo->PeakLuminance = FMath::Max(OutInfo->PeakLuminance, Luminance);
+			}
+		}
+		OutInfo->bHasPixelStats = true;
+	}
+
+	if (OutPreview)
+	{
+		HdriVaultImageFileUtils::BuildPreview(Rgba, Width, Height, *OutPreview);
+	}
+
 	// Save as HDR using stbi_write_hdr
 	// stbi_write_hdr expects float* pointing to RGB or RGBA data.
-	// Since LoadEXR returns RGBA, we pass 4 components.
+	// The decoded pixels are RGBA, so we pass 4 components.
 	// stbi_write_hdr supports 4 components (it will just write RGBA, though .hdr is usually RGBE, stbi might handle alpha or discard it, 
     // but standard Radiance HDR is RGBE. stbi_write_hdr doc says it supports 1, 2, 3, 4 components).
     
 	int WriteRet = stbi_write_hdr(TCHAR_TO_ANSI(*OutputFile), Width, Height, 4, Rgba);
 
-	// Clean up EXR memory
-	free(Rgba);
-
 	if (WriteRet == 0)
 	{
 		OutError = TEXT("Failed to write HDR file using stbi_write_hdr");
@@ -90,3 +1460,143 @@ bool FHdriVaultImageUtils::ConvertExrToHdr(const FString& InputFile, const FStri
 	return true;
 }
 
+bool FHdriVaultImageUtils::LoadExrLevel(const FString& File, int32 MaxWidth, TArray<float>& OutRgba, int32& OutWidth, int32& OutHeight, FString& OutError)
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*File));
+	if (!Archive)
+	{
+		OutError = FString::Printf(TEXT("Could not open %s"), *File);
+		return false;
+	}
+
+	HdriVaultExrUtils::FScopedHeader Header;
+	if (!HdriVaultExrUtils::ReadHeader(*Archive, Header, OutError))
+	{
+		return false;
+	}
+	if (!Header.Header.tiled)
+	{
+		OutError = TEXT("Scanline EXR files have no levels");
+		return false;
+	}
+
+	return HdriVaultExrUtils::LoadLevel(*Archive, Header, MaxWidth, OutRgba, OutWidth, OutHeight, OutError);
+}
+
+bool FHdriVaultImageUtils::ReadImageHeader(const FString& File, FHdriVaultImageInfo& OutInfo, FString& OutError, FHdriVaultImagePreview* OutPreview)
+{
+	const FString Extension = FPaths::GetExtension(File).ToLower();
+	if (Extension == TEXT("exr"))
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*File));
+		if (!Archive)
+		{
+			OutError = FString::Printf(TEXT("Could not open %s"), *File);
+			return false;
+		}
+
+		HdriVaultExrUtils::FScopedHeader Header;
+		if (!HdriVaultExrUtils::ReadHeader(*Archive, Header, OutError))
+		{
+			return false;
+		}
+
+		// The data window is inclusive: (min x, min y, max x, max y)
+		OutInfo.Width = Header.Header.data_window[2] - Header.Header.data_window[0] + 1;
+		OutInfo.Height = Header.Header.data_window[3] - Header.Header.data_window[1] + 1;
+
+		// Without a preview attribute, a tiled file's smallest useful level is nearly as cheap
+		if (OutPreview && !HdriVaultExrUtils::ReadPreviewAttribute(Header.Header, *OutPreview) && HdriVaultExrUtils::HasLevels(Header.Header))
+		{
+			TArray<float> LevelRgba;
+			int32 LevelWidth = 0;
+			int32 LevelHeight = 0;
+			FString LevelError;
+			if (HdriVaultExrUtils::LoadLevel(*Archive, Header, MaxPreviewSize, LevelRgba, LevelWidth, LevelHeight, LevelError))
+			{
+				HdriVaultImageFileUtils::BuildPreview(LevelRgba.GetData(), LevelWidth, LevelHeight, *OutPreview);
+			}
+		}
+		return OutInfo.Width > 0 && OutInfo.Height > 0;
+	}
+
+	if (Extension == TEXT("hdr"))
+	{
+		TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*File));
+		if (!Archive)
+		{
+			OutError = FString::Printf(TEXT("Could not open %s"), *File);
+			return false;
+		}
+
+		HdriVaultImageFileUtils::FByteReader Reader(*Archive);
+		return HdriVaultRadianceUtils::ReadHeader(Reader, OutInfo.Width, OutInfo.Height, OutError);
+	}
+
+	OutError = FString::Printf(TEXT("Unsupported file type: %s"), *Extension);
+	return false;
+}
+
+bool FHdriVaultImageUtils::AnalyzeHdrFile(const FString& File, FHdriVaultImageInfo& OutInfo, FString& OutError, FHdriVaultImagePreview* OutPreview)
+{
+	TUniquePtr<FArchive> Archive(IFileManager::Get().CreateFileReader(*File));
+	if (!Archive)
+	{
+		OutError = FString::Printf(TEXT("Could not open %s"), *File);
+		return false;
+	}
+
+	HdriVaultImageFileUtils::FByteReader Reader(*Archive);
+	if (!HdriVaultRadianceUtils::ReadHeader(Reader, OutInfo.Width, OutInfo.Height, OutError))
+	{
+		return false;
+	}
+
+	// Every Step-th pixel of every Step-th row goes into the preview
+	int32 PreviewStep = 1;
+	if (OutPreview)
+	{
+		HdriVaultImageFileUtils::GetPreviewSize(OutInfo.Width, OutInfo.Height, OutPreview->Width, OutPreview->Height, PreviewStep);
+		OutPreview->Pixels.SetNumZeroed(OutPreview->Width * OutPreview->Height);
+		OutPreview->bFromHeader = false;
+	}
+
+	// Only one scanline is held at a time, so large panoramas cost no more memory than small ones
+	TArray<uint8> Scanline;
+	Scanline.SetNumUninitialized(OutInfo.Width * 4);
+	float PeakLuminance = 0.0f;
+
+	for (int32 Y = 0; Y < OutInfo.Height; ++Y)
+	{
+		if (!HdriVaultRadianceUtils::ReadScanline(Reader, OutInfo.Width, Scanline.GetData()))
+		{
+			OutError = FString::Printf(TEXT("Corrupt or truncated HDR data at scanline %d"), Y);
+			return false;
+		}
+
+		for (int32 X = 0; X < OutInfo.Width; ++X)
+		{
+			const uint8* Rgbe = Scanline.GetData() + X * 4;
+			if (Rgbe[3] != 0)
+			{
+				const float Scale = FMath::Exp2(static_cast<float>(Rgbe[3]) - 136.0f);
+				PeakLuminance = FMath::Max(PeakLuminance, HdriVaultImageFileUtils::GetLuminance(Rgbe[0] * Scale, Rgbe[1] * Scale, Rgbe[2] * Scale));
+			}
+		}
+
+		if (OutPreview && Y % PreviewStep == 0 && Y / PreviewStep < OutPreview->Height)
+		{
+			FColor* PreviewRow = OutPreview->Pixels.GetData() + (Y / PreviewStep) * OutPreview->Width;
+			for (int32 X = 0; X < OutPreview->Width; ++X)
+			{
+				const uint8* Rgbe = Scanline.GetData() + X * PreviewStep * 4;
+				const float Scale = Rgbe[3] != 0 ? FMath::Exp2(static_cast<float>(Rgbe[3]) - 136.0f) : 0.0f;
+				PreviewRow[X] = HdriVaultImageFileUtils::ToPreviewColor(Rgbe[0] * Scale, Rgbe[1] * Scale, Rgbe[2] * Scale);
+			}
+		}
+	}
+
+	OutInfo.PeakLuminance = PeakLuminance;
+	OutInfo.bHasPixelStats = true;
+	return true;
+}
@@ -4,16 +4,73 @@
 
 #include "CoreMinimal.h"
 
+// What is known about a source image before it is imported
+struct FHdriVaultImageInfo
+{
+	int32 Width = 0;
+	int32 Height = 0;
+
+	// Brightest pixel's luminance; only known once the pixels have been read
+	float PeakLuminance = 0.0f;
+	bool bHasPixelStats = false;
+
+	// Rough GPU memory of the imported cubemap (RGBA16F faces with a full mip chain)
+	int64 GetEstimatedMemoryBytes() const;
+};
+
+// Small 8-bit preview of a source image, for showing files that have not been imported yet
+struct FHdriVaultImagePreview
+{
+	int32 Width = 0;
+	int32 Height = 0;
+	TArray<FColor> Pixels;
+
+	// Whether it came from the file's own preview attribute rather than from its pixels
+	bool bFromHeader = false;
+
+	bool IsValid() const { return Width > 0 && Height > 0 && Pixels.Num() == Width * Height; }
+};
+
 class FHdriVaultImageUtils
 {
 public:
+	// Longest side of previews made from decoded pixels
+	static constexpr int32 MaxPreviewSize = 128;
+
 	/**
 	 * Converts an EXR file to HDR format using tinyexr and stb_image_write.
 	 * @param InputFile - Full path to the source .exr file
 	 * @param OutputFile - Full path to the destination .hdr file
 	 * @param OutError - Error message if conversion fails
+	 * @param OutInfo - Optional; receives the size and pixel stats of the decoded image
+	 * @param OutPreview - Optional; receives a preview sampled from the decoded image
 	 * @return true if successful
 	 */
-	static bool ConvertExrToHdr(const FString& InputFile, const FString& OutputFile, FString& OutError);
+	static bool ConvertExrToHdr(const FString& InputFile, const FString& OutputFile, FString& OutError, FHdriVaultImageInfo* OutInfo = nullptr, FHdriVaultImagePreview* OutPreview = nullptr);
+
+	/**
+	 * Decodes one resolution level of a tiled EXR, reading only that level's tiles. Mip and rip mapped
+	 * files already store low resolution copies of the image, so previews of them cost a fraction of a
+	 * full decode.
+	 * @param MaxWidth - The first level no wider than this is decoded, or the smallest level if none is
+	 * @param OutRgba - Interleaved RGBA float pixels
+	 * @return false for scanline files, which only have the full resolution image
+	 */
+	static bool LoadExrLevel(const FString& File, int32 MaxWidth, TArray<float>& OutRgba, int32& OutWidth, int32& OutHeight, FString& OutError);
+
+	/**
+	 * Reads only the header of an .exr or .hdr file.
+	 * @param OutPreview - Optional; receives the EXR preview attribute, or for tiled files without one,
+	 * a preview made from their smallest useful level. Left empty otherwise.
+	 * @return true if the size could be determined
+	 */
+	static bool ReadImageHeader(const FString& File, FHdriVaultImageInfo& OutInfo, FString& OutError, FHdriVaultImagePreview* OutPreview = nullptr);
+
+	/**
+	 * Decodes a Radiance .hdr file one scanline at a time to fill in its pixel stats.
+	 * @param OutPreview - Optional; receives a preview sampled from the decoded scanlines
+	 * @return true if the whole file could be read
+	 */
+	static bool AnalyzeHdrFile(const FString& File, FHdriVaultImageInfo& OutInfo, FString& OutError, FHdriVaultImagePreview* OutPreview = nullptr);
 };
 
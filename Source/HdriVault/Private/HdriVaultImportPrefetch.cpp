@@ -0,0 +1,275 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultImportPrefetch.h"
+#include "HdriVaultWorkScheduler.h"
+#include "HdriVaultWorkerPool.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+
+namespace HdriVaultImportPrefetchUtils
+{
+	static int32 SpeculativeImport = 1;
+	static FAutoConsoleVariableRef CVarSpeculativeImport(
+		TEXT("HdriVault.SpeculativeImport"),
+		SpeculativeImport,
+		TEXT("Probe and convert dropped files in the background while the import dialog is open. 0 waits until Import is clicked."),
+		ECVF_Default);
+}
+
+FHdriVaultImportPrefetch::FHdriVaultImportPrefetch(const TArray<FString>& InFiles)
+{
+	StagingDir = FPaths::ProjectIntermediateDir() / TEXT("HdriVault") / TEXT("ImportStaging") / FGuid::NewGuid().ToString();
+
+	Files.Reserve(InFiles.Num());
+	for (int32 Index = 0; Index < InFiles.Num(); ++Index)
+	{
+		TSharedRef<FFile, ESPMode::ThreadSafe> File = MakeShared<FFile, ESPMode::ThreadSafe>();
+		File->SourceFile = InFiles[Index];
+
+		// One folder per file, so sources that share a name in different folders cannot collide
+		if (FPaths::GetExtension(File->SourceFile).ToLower() == TEXT("exr"))
+		{
+			File->StagedFile = StagingDir / FString::FromInt(Index) / (FPaths::GetBaseFilename(File->SourceFile) + TEXT(".hdr"));
+		}
+		Files.Add(File);
+	}
+}
+
+FHdriVaultImportPrefetch::~FHdriVaultImportPrefetch()
+{
+	// Claimed files have been moved out by now; whatever is left was never used
+	IFileManager::Get().DeleteDirectory(*StagingDir, false, true);
+}
+
+bool FHdriVaultImportPrefetch::IsEnabled()
+{
+	return HdriVaultImportPrefetchUtils::SpeculativeImport != 0;
+}
+
+void FHdriVaultImportPrefetch::Start(const TSharedRef<FHdriVaultWorkScheduler>& InWorkScheduler, const TSharedRef<FHdriVaultWorkerPool>& InWorkerPool)
+{
+	check(IsInGameThread());
+
+	if (!IsEnabled() || Files.Num() == 0)
+	{
+		return;
+	}
+
+	// The pool waits for running work before the scheduler is released, so workers can post to it
+	FHdriVaultWorkScheduler* Scheduler = &InWorkScheduler.Get();
+	TWeakPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe> WeakThis = AsWeak();
+
+	// Headers first, in one quick pass ahead of any bulk work, so the dialog fills in right away
+	TArray<FString> SourceFiles;
+	for (const TSharedRef<FFile, ESPMode::ThreadSafe>& File : Files)
+	{
+		SourceFiles.Add(File->SourceFile);
+	}
+
+	InWorkerPool->Launch(EHdriVaultWorkerPriority::Interactive, [WeakThis, Scheduler, SourceFiles = MoveTemp(SourceFiles)]()
+	{
+		TArray<FHeader> Headers;
+		for (int32 Index = 0; Index < SourceFiles.Num(); ++Index)
+		{
+			FHeader Header;
+			FString Error;
+			if (FHdriVaultImageUtils::ReadImageHeader(SourceFiles[Index], Header.Info, Error, &Header.Preview))
+			{
+				Header.FileIndex = Index;
+				Headers.Add(MoveTemp(Header));
+			}
+		}
+
+		Scheduler->Enqueue(EHdriVaultWorkPriority::Interactive, [WeakThis, Headers = MoveTemp(Headers)]() mutable
+		{
+			if (TSharedPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				This->HandleHeaders(MoveTemp(Headers));
+			}
+		});
+	});
+
+	// Then the full read of each file: EXRs are converted, HDRs only analyzed. Either also yields a
+	// preview, for files without one in the header.
+	for (int32 Index = 0; Index < Files.Num(); ++Index)
+	{
+		InWorkerPool->Launch(EHdriVaultWorkerPriority::Bulk, [WeakThis, Scheduler, File = Files[Index], Index]()
+		{
+			TSharedPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe> This = WeakThis.Pin();
+			if (!This.IsValid() || This->bDiscarded.load())
+			{
+				return;
+			}
+
+			// The import queue may have claimed the file before its turn came
+			EFileState Expected = EFileState::Queued;
+			if (!File->State.compare_exchange_strong(Expected, EFileState::Running))
+			{
+				return;
+			}
+
+			const bool bSucceeded = ProcessFile(*File);
+			File->State.store(bSucceeded ? EFileState::Done : EFileState::Failed);
+
+			Scheduler->Enqueue(EHdriVaultWorkPriority::Visible, [WeakThis, Index]()
+			{
+				if (TSharedPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe> PinnedThis = WeakThis.Pin())
+				{
+					PinnedThis->HandleFileProcessed(Index);
+				}
+			});
+		});
+	}
+}
+
+void FHdriVaultImportPrefetch::Discard()
+{
+	check(IsInGameThread());
+
+	// Queued work is skipped from here on; running conversions clean up after themselves
+	bDiscarded.store(true);
+	IFileManager::Get().DeleteDirectory(*StagingDir, false, true);
+}
+
+void FHdriVaultImportPrefetch::Claim(const FString& SourceFile, TUniqueFunction<void(const FString&)>&& OnReady)
+{
+	check(IsInGameThread());
+
+	const TSharedRef<FFile, ESPMode::ThreadSafe>* FoundFile = FindFile(SourceFile);
+	if (!FoundFile || bDiscarded.load())
+	{
+		OnReady(FString());
+		return;
+	}
+
+	// Nothing to hand over for files that need no conversion
+	FFile& File = FoundFile->Get();
+	if (File.StagedFile.IsEmpty())
+	{
+		OnReady(FString());
+		return;
+	}
+
+	EFileState State = EFileState::Queued;
+	if (File.State.compare_exchange_strong(State, EFileState::Claimed))
+	{
+		OnReady(FString());
+		return;
+	}
+
+	switch (State)
+	{
+	case EFileState::Running:
+		// Finishing the conversion is cheaper than starting it over
+		File.OnClaimReady = MoveTemp(OnReady);
+		break;
+
+	case EFileState::Done:
+		OnReady(File.StagedFile);
+		break;
+
+	default:
+		OnReady(FString());
+		break;
+	}
+}
+
+bool FHdriVaultImportPrefetch::GetStatus(const FString& SourceFile, FFileStatus& OutStatus) const
+{
+	const TSharedRef<FFile, ESPMode::ThreadSafe>* FoundFile = FindFile(SourceFile);
+	if (!FoundFile)
+	{
+		return false;
+	}
+
+	const FFile& File = FoundFile->Get();
+	OutStatus.State = File.State.load();
+	OutStatus.bHasHeader = File.bHasHeader || OutStatus.State == EFileState::Done;
+	OutStatus.ImageInfo = OutStatus.State == EFileState::Done ? File.Result : File.HeaderInfo;
+	return true;
+}
+
+const FHdriVaultImagePreview* FHdriVaultImportPrefetch::GetPreview(const FString& SourceFile) const
+{
+	const TSharedRef<FFile, ESPMode::ThreadSafe>* FoundFile = FindFile(SourceFile);
+	if (!FoundFile)
+	{
+		return nullptr;
+	}
+
+	const FFile& File = FoundFile->Get();
+	if (File.HeaderPreview.IsValid())
+	{
+		return &File.HeaderPreview;
+	}
+	if (File.State.load() == EFileState::Done && File.ResultPreview.IsValid())
+	{
+		return &File.ResultPreview;
+	}
+	return nullptr;
+}
+
+const TSharedRef<FHdriVaultImportPrefetch::FFile, ESPMode::ThreadSafe>* FHdriVaultImportPrefetch::FindFile(const FString& SourceFile) const
+{
+	return Files.FindByPredicate([&SourceFile](const TSharedRef<FFile, ESPMode::ThreadSafe>& File)
+	{
+		return File->SourceFile == SourceFile;
+	});
+}
+
+bool FHdriVaultImportPrefetch::ProcessFile(FFile& File)
+{
+	FString Error;
+	bool bSucceeded = false;
+
+	if (!File.StagedFile.IsEmpty())
+	{
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(File.StagedFile), true);
+		bSucceeded = FHdriVaultImageUtils::ConvertExrToHdr(File.SourceFile, File.StagedFile, Error, &File.Result, &File.ResultPreview);
+	}
+	else
+	{
+		bSucceeded = FHdriVaultImageUtils::AnalyzeHdrFile(File.SourceFile, File.Result, Error, &File.ResultPreview);
+	}
+
+	if (!bSucceeded)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HdriVault: Could not pre-read %s: %s"), *File.SourceFile, *Error);
+	}
+	return bSucceeded;
+}
+
+void FHdriVaultImportPrefetch::HandleHeaders(TArray<FHeader>&& Headers)
+{
+	for (FHeader& Header : Headers)
+	{
+		FFile& File = Files[Header.FileIndex].Get();
+		File.HeaderInfo = Header.Info;
+		File.HeaderPreview = MoveTemp(Header.Preview);
+		File.bHasHeader = true;
+	}
+}
+
+void FHdriVaultImportPrefetch::HandleFileProcessed(int32 FileIndex)
+{
+	FFile& File = Files[FileIndex].Get();
+	const EFileState State = File.State.load();
+	if (State == EFileState::Done)
+	{
+		File.bHasHeader = true;
+	}
+
+	// Written after the dialog was cancelled
+	if (bDiscarded.load() && !File.StagedFile.IsEmpty())
+	{
+		IFileManager::Get().Delete(*File.StagedFile, false, true, true);
+	}
+
+	if (File.OnClaimReady)
+	{
+		TUniqueFunction<void(const FString&)> OnReady = MoveTemp(File.OnClaimReady);
+		OnReady(State == EFileState::Done ? File.StagedFile : FString());
+	}
+}
@@ -0,0 +1,102 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HdriVaultImageUtils.h"
+#include <atomic>
+
+class FHdriVaultWorkScheduler;
+class FHdriVaultWorkerPool;
+
+/**
+ * Speculative work on the files waiting in the import dialog.
+ *
+ * As soon as the dialog opens, every header is probed and EXRs are converted into a private staging
+ * folder on the vault's worker threads, so most of the conversion is done by the time Import is
+ * clicked. Previews come from the EXR preview attribute where there is one, read along with the
+ * header, and are otherwise sampled from the full decode. The import queue claims the staged files one at a time. Anything discarded or never
+ * claimed is deleted along with the staging folder.
+ */
+class FHdriVaultImportPrefetch : public TSharedFromThis<FHdriVaultImportPrefetch, ESPMode::ThreadSafe>
+{
+public:
+	enum class EFileState : uint8
+	{
+		Queued,		// Nothing read yet
+		Running,	// Being converted or analyzed
+		Done,
+		Failed,
+		Claimed		// Handed to the import queue before any work started
+	};
+
+	// What the dialog shows for one file
+	struct FFileStatus
+	{
+		EFileState State = EFileState::Queued;
+		bool bHasHeader = false;
+		FHdriVaultImageInfo ImageInfo;
+	};
+
+	explicit FHdriVaultImportPrefetch(const TArray<FString>& InFiles);
+	~FHdriVaultImportPrefetch();
+
+	// Probes and converts every file in the background. Game thread only.
+	void Start(const TSharedRef<FHdriVaultWorkScheduler>& InWorkScheduler, const TSharedRef<FHdriVaultWorkerPool>& InWorkerPool);
+
+	// Stops outstanding work and deletes everything staged so far. Game thread only.
+	void Discard();
+
+	/**
+	 * Hands over the staged conversion of SourceFile. OnReady receives the staged file, or an empty
+	 * string when the caller has to prepare the file itself. It runs right away, unless a conversion
+	 * is still running, in which case it runs on the game thread once that finishes. Game thread only.
+	 */
+	void Claim(const FString& SourceFile, TUniqueFunction<void(const FString& /*StagedFile*/)>&& OnReady);
+
+	// Game thread only
+	bool GetStatus(const FString& SourceFile, FFileStatus& OutStatus) const;
+
+	// Preview of SourceFile, or null while there is none yet. Game thread only.
+	const FHdriVaultImagePreview* GetPreview(const FString& SourceFile) const;
+
+	static bool IsEnabled();
+
+private:
+	struct FFile
+	{
+		FString SourceFile;
+
+		// Where an EXR's conversion is written; empty for files that need none
+		FString StagedFile;
+
+		// Written by the worker before State becomes Done
+		FHdriVaultImageInfo Result;
+		FHdriVaultImagePreview ResultPreview;
+		std::atomic<EFileState> State { EFileState::Queued };
+
+		// Game thread only
+		bool bHasHeader = false;
+		FHdriVaultImageInfo HeaderInfo;
+		FHdriVaultImagePreview HeaderPreview;
+		TUniqueFunction<void(const FString&)> OnClaimReady;
+	};
+
+	// One file's header pass result
+	struct FHeader
+	{
+		int32 FileIndex = INDEX_NONE;
+		FHdriVaultImageInfo Info;
+		FHdriVaultImagePreview Preview;
+	};
+
+	const TSharedRef<FFile, ESPMode::ThreadSafe>* FindFile(const FString& SourceFile) const;
+	static bool ProcessFile(FFile& File);
+	void HandleHeaders(TArray<FHeader>&& Headers);
+	void HandleFileProcessed(int32 FileIndex);
+
+	TArray<TSharedRef<FFile, ESPMode::ThreadSafe>> Files;
+	FString StagingDir;
+
+	std::atomic<bool> bDiscarded { false };
+};
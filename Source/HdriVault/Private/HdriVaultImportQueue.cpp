@@ -0,0 +1,334 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultImportQueue.h"
+#include "HdriVaultWorkScheduler.h"
+#include "HdriVaultWorkerPool.h"
+#include "HdriVaultImageUtils.h"
+#include "HdriVaultImportPrefetch.h"
+#include "HAL/FileManager.h"
+#include "Framework/Notifications/NotificationManager.h"
+#include "Widgets/Notifications/SNotificationList.h"
+#include "Misc/Paths.h"
+
+#define LOCTEXT_NAMESPACE "HdriVaultImportQueue"
+
+namespace HdriVaultImportQueueUtils
+{
+	// Converts EXR files to HDR beside the source; returns the file to hand to the importer.
+	// Safe to call from any thread.
+	static FString PrepareImportFile(const FString& File, bool& bOutConverted)
+	{
+		bOutConverted = false;
+		if (FPaths::GetExtension(File).ToLower() != TEXT("exr"))
+		{
+			return File;
+		}
+
+		const FString HdrFile = FPaths::ChangeExtension(File, TEXT("hdr"));
+		FString Error;
+		if (!FHdriVaultImageUtils::ConvertExrToHdr(File, HdrFile, Error))
+		{
+			UE_LOG(LogTemp, Error, TEXT("HdriVault: Failed to convert %s: %s"), *File, *Error);
+			// Fallback to original file if conversion fails
+			return File;
+		}
+
+		bOutConverted = true;
+		return HdrFile;
+	}
+
+	// Moves a conversion staged by the import dialog to where PrepareImportFile would have written it.
+	// Falls back to converting again if the move fails. Safe to call from any thread.
+	static FString TakeStagedFile(const FString& File, const FString& StagedFile, bool& bOutConverted)
+	{
+		const FString HdrFile = FPaths::ChangeExtension(File, TEXT("hdr"));
+		if (IFileManager::Get().Move(*HdrFile, *StagedFile, true, true))
+		{
+			bOutConverted = true;
+			return HdrFile;
+		}
+
+		UE_LOG(LogTemp, Warning, TEXT("HdriVault: Could not move staged conversion %s, converting again"), *StagedFile);
+		return PrepareImportFile(File, bOutConverted);
+	}
+}
+
+FHdriVaultImportQueue::FHdriVaultImportQueue()
+	: bIsInitialized(false)
+{
+}
+
+FHdriVaultImportQueue::~FHdriVaultImportQueue()
+{
+	if (bIsInitialized)
+	{
+		Shutdown();
+	}
+}
+
+void FHdriVaultImportQueue::Initialize(const TSharedRef<FHdriVaultWorkScheduler>& InWorkScheduler, const TSharedRef<FHdriVaultWorkerPool>& InWorkerPool)
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	WorkScheduler = InWorkScheduler;
+	WorkerPool = InWorkerPool;
+	bIsInitialized = true;
+}
+
+void FHdriVaultImportQueue::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	CancelAll();
+	WorkScheduler.Reset();
+	WorkerPool.Reset();
+	bIsInitialized = false;
+}
+
+void FHdriVaultImportQueue::Enqueue(const FHdriVaultImportOptions& Options, const FHdriVaultOperationRef& Operation)
+{
+	check(IsInGameThread());
+
+	if (!bIsInitialized || Options.Files.Num() == 0)
+	{
+		Operation->Complete(EHdriVaultOperationResult::Failed);
+		return;
+	}
+
+	TSharedRef<FJob, ESPMode::ThreadSafe> Job = MakeShared<FJob, ESPMode::ThreadSafe>();
+	Job->Options = Options;
+	Job->Operation = Operation;
+	PendingJobs.Add(Job);
+
+	if (!ActiveJob.IsValid())
+	{
+		StartNextJob();
+	}
+}
+
+void FHdriVaultImportQueue::CancelAll()
+{
+	check(IsInGameThread());
+
+	TArray<TSharedRef<FJob, ESPMode::ThreadSafe>> DroppedJobs = MoveTemp(PendingJobs);
+	for (const TSharedRef<FJob, ESPMode::ThreadSafe>& Job : DroppedJobs)
+	{
+		Job->Operation->Cancel();
+		Job->Operation->Complete(EHdriVaultOperationResult::Cancelled);
+	}
+
+	if (ActiveJob.IsValid())
+	{
+		ActiveJob->Operation->Cancel();
+		FinishActiveJob(EHdriVaultOperationResult::Cancelled);
+	}
+}
+
+void FHdriVaultImportQueue::StartNextJob()
+{
+	while (PendingJobs.Num() > 0)
+	{
+		TSharedRef<FJob, ESPMode::ThreadSafe> Job = PendingJobs[0];
+		PendingJobs.RemoveAt(0);
+
+		// Cancelled while it was waiting
+		if (Job->Operation->IsCancelRequested())
+		{
+			Job->Operation->Complete(EHdriVaultOperationResult::Cancelled);
+			continue;
+		}
+
+		ActiveJob = Job;
+
+		TWeakPtr<FHdriVaultOperation, ESPMode::ThreadSafe> WeakOperation = Job->Operation;
+		FNotificationInfo Info(FText::GetEmpty());
+		Info.bFireAndForget = false;
+		Info.ExpireDuration = 5.0f;
+		Info.ButtonDetails.Add(FNotificationButtonInfo(
+			LOCTEXT("CancelImport", "Cancel"),
+			LOCTEXT("CancelImportTooltip", "Stop importing once the current file is done"),
+			FSimpleDelegate::CreateLambda([WeakOperation]()
+			{
+				if (TSharedPtr<FHdriVaultOperation, ESPMode::ThreadSafe> Operation = WeakOperation.Pin())
+				{
+					Operation->Cancel();
+				}
+			}),
+			SNotificationItem::CS_Pending));
+
+		Job->Notification = FSlateNotificationManager::Get().AddNotification(Info);
+		if (Job->Notification.IsValid())
+		{
+			Job->Notification->SetCompletionState(SNotificationItem::CS_Pending);
+		}
+
+		PrepareNextFile();
+		return;
+	}
+}
+
+void FHdriVaultImportQueue::PrepareNextFile()
+{
+	TSharedRef<FJob, ESPMode::ThreadSafe> Job = ActiveJob.ToSharedRef();
+	const TArray<FString>& Files = Job->Options.Files;
+
+	if (Job->Operation->IsCancelRequested())
+	{
+		FinishActiveJob(EHdriVaultOperationResult::Cancelled);
+		return;
+	}
+
+	if (Job->NextFile >= Files.Num())
+	{
+		FinishActiveJob(Job->Totals.NumCubemaps > 0 ? EHdriVaultOperationResult::Succeeded : EHdriVaultOperationResult::Failed);
+		return;
+	}
+
+	const FString SourceFile = Files[Job->NextFile];
+	Job->Operation->SetProgress(float(Job->NextFile) / Files.Num(),
+		FText::Format(LOCTEXT("ImportingFile", "Importing {0}"), FText::FromString(FPaths::GetCleanFilename(SourceFile))));
+	UpdateNotification(*Job);
+
+	// Take over whatever the dialog already converted; a conversion still running is waited for
+	if (Job->Options.Prefetch.IsValid())
+	{
+		TWeakPtr<FHdriVaultImportQueue, ESPMode::ThreadSafe> WeakThis = AsWeak();
+		Job->Options.Prefetch->Claim(SourceFile, [WeakThis, Job, SourceFile](const FString& StagedFile)
+		{
+			if (TSharedPtr<FHdriVaultImportQueue, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				This->LaunchPrepare(Job, SourceFile, StagedFile);
+			}
+		});
+		return;
+	}
+
+	LaunchPrepare(Job, SourceFile, FString());
+}
+
+void FHdriVaultImportQueue::LaunchPrepare(const TSharedRef<FJob, ESPMode::ThreadSafe>& Job, const FString& SourceFile, const FString& StagedFile)
+{
+	// The job was cancelled while waiting on its staged file
+	if (ActiveJob != Job)
+	{
+		return;
+	}
+
+	TSharedPtr<FHdriVaultWorkScheduler> PinnedWorkScheduler = WorkScheduler.Pin();
+	TSharedPtr<FHdriVaultWorkerPool> PinnedWorkerPool = WorkerPool.Pin();
+	if (!PinnedWorkScheduler.IsValid() || !PinnedWorkerPool.IsValid())
+	{
+		FinishActiveJob(EHdriVaultOperationResult::Cancelled);
+		return;
+	}
+
+	// Conversion reads and writes whole images, so it runs on a worker; the import creates UObjects and
+	// comes back to the game thread. The pool waits for running work before the scheduler is released.
+	FHdriVaultWorkScheduler* Scheduler = PinnedWorkScheduler.Get();
+	TWeakPtr<FHdriVaultImportQueue, ESPMode::ThreadSafe> WeakThis = AsWeak();
+	PinnedWorkerPool->Launch(EHdriVaultWorkerPriority::Bulk, [WeakThis, Job, SourceFile, StagedFile, Scheduler]()
+	{
+		bool bConverted = false;
+		FString PreparedFile = StagedFile.IsEmpty()
+			? HdriVaultImportQueueUtils::PrepareImportFile(SourceFile, bConverted)
+			: HdriVaultImportQueueUtils::TakeStagedFile(SourceFile, StagedFile, bConverted);
+
+		Scheduler->Enqueue(EHdriVaultWorkPriority::Visible, [WeakThis, Job, PreparedFile = MoveTemp(PreparedFile), bConverted]()
+		{
+			if (TSharedPtr<FHdriVaultImportQueue, ESPMode::ThreadSafe> This = WeakThis.Pin())
+			{
+				This->ImportPreparedFile(Job, PreparedFile, bConverted);
+			}
+		});
+	});
+}
+
+void FHdriVaultImportQueue::ImportPreparedFile(const TSharedRef<FJob, ESPMode::ThreadSafe>& Job, const FString& PreparedFile, bool bConverted)
+{
+	// The job was cancelled while its file was being converted
+	if (ActiveJob != Job)
+	{
+		return;
+	}
+
+	Job->NumConverted += bConverted ? 1 : 0;
+
+	if (Job->Operation->IsCancelRequested())
+	{
+		FinishActiveJob(EHdriVaultOperationResult::Cancelled);
+		return;
+	}
+
+	if (OnImportFile.IsBound())
+	{
+		const FHdriVaultImportFileResult FileResult = OnImportFile.Execute(PreparedFile, Job->Options);
+		Job->Totals.NumCubemaps += FileResult.NumCubemaps;
+		Job->Totals.NumTexture2Ds += FileResult.NumTexture2Ds;
+	}
+
+	++Job->NextFile;
+	PrepareNextFile();
+}
+
+void FHdriVaultImportQueue::FinishActiveJob(EHdriVaultOperationResult Result)
+{
+	TSharedRef<FJob, ESPMode::ThreadSafe> Job = ActiveJob.ToSharedRef();
+	ActiveJob.Reset();
+
+	if (Job->Notification.IsValid())
+	{
+		Job->Notification->SetText(GetSummaryText(*Job, Result));
+		Job->Notification->SetCompletionState(Result == EHdriVaultOperationResult::Succeeded && Job->Totals.NumTexture2Ds == 0
+			? SNotificationItem::CS_Success : SNotificationItem::CS_Fail);
+		Job->Notification->ExpireAndFadeout();
+		Job->Notification.Reset();
+	}
+
+	if (Job->NumConverted > 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("HdriVault: Converted %d EXR files to HDR"), Job->NumConverted);
+	}
+
+	Job->Operation->Complete(Result);
+	StartNextJob();
+}
+
+void FHdriVaultImportQueue::UpdateNotification(const FJob& Job) const
+{
+	if (Job.Notification.IsValid())
+	{
+		Job.Notification->SetText(FText::Format(LOCTEXT("ImportProgress", "Importing HDRI {0} of {1}\n{2}"),
+			FText::AsNumber(Job.NextFile + 1), FText::AsNumber(Job.Options.Files.Num()),
+			FText::FromString(FPaths::GetCleanFilename(Job.Options.Files[Job.NextFile]))));
+	}
+}
+
+FText FHdriVaultImportQueue::GetSummaryText(const FJob& Job, EHdriVaultOperationResult Result)
+{
+	if (Result == EHdriVaultOperationResult::Cancelled)
+	{
+		return FText::Format(LOCTEXT("ImportCancelled", "Import cancelled after {0} of {1} files"),
+			FText::AsNumber(Job.NextFile), FText::AsNumber(Job.Options.Files.Num()));
+	}
+
+	if (Job.Totals.NumTexture2Ds > 0)
+	{
+		return FText::Format(LOCTEXT("ImportPartialSuccess", "Imported {0} Cubemaps and {1} Texture2Ds.\nTexture2Ds must be converted to Cubemaps to appear in the Vault."),
+			FText::AsNumber(Job.Totals.NumCubemaps), FText::AsNumber(Job.Totals.NumTexture2Ds));
+	}
+
+	if (Result == EHdriVaultOperationResult::Failed)
+	{
+		return LOCTEXT("ImportFailed", "No HDRIs were imported");
+	}
+
+	return FText::Format(LOCTEXT("ImportSuccess", "Successfully imported {0} HDRIs"), FText::AsNumber(Job.Totals.NumCubemaps));
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -0,0 +1,78 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HdriVaultOperation.h"
+#include "SHdriVaultImportOptions.h"
+
+class FHdriVaultWorkScheduler;
+class FHdriVaultWorkerPool;
+class SNotificationItem;
+
+// What importing a single file produced
+struct FHdriVaultImportFileResult
+{
+	int32 NumCubemaps = 0;
+	int32 NumTexture2Ds = 0;
+};
+
+/**
+ * Background HDRI imports, run one job at a time and one file at a time.
+ *
+ * Each file is converted on the vault's worker threads, then imported on the game thread through
+ * OnImportFile as work on the work scheduler, so finished files show up in the vault while the
+ * rest of the job is still running. Every job has a progress notification with a cancel button;
+ * cancellation takes effect between files.
+ */
+class FHdriVaultImportQueue : public TSharedFromThis<FHdriVaultImportQueue, ESPMode::ThreadSafe>
+{
+public:
+	// Imports one prepared file on the game thread
+	DECLARE_DELEGATE_RetVal_TwoParams(FHdriVaultImportFileResult, FOnImportFile, const FString& /*File*/, const FHdriVaultImportOptions& /*Options*/);
+
+	FHdriVaultImportQueue();
+	~FHdriVaultImportQueue();
+
+	// Initialize/cleanup. Shutdown cancels every job.
+	void Initialize(const TSharedRef<FHdriVaultWorkScheduler>& InWorkScheduler, const TSharedRef<FHdriVaultWorkerPool>& InWorkerPool);
+	void Shutdown();
+
+	// Queues a job behind any already running; Operation completes when the job does. Game thread only.
+	void Enqueue(const FHdriVaultImportOptions& Options, const FHdriVaultOperationRef& Operation);
+
+	// Cancels the running job and drops the queued ones. Game thread only.
+	void CancelAll();
+
+	int32 GetNumJobs() const { return PendingJobs.Num() + (ActiveJob.IsValid() ? 1 : 0); }
+
+	FOnImportFile OnImportFile;
+
+private:
+	struct FJob
+	{
+		FHdriVaultImportOptions Options;
+		FHdriVaultOperationPtr Operation;
+		TSharedPtr<SNotificationItem> Notification;
+		int32 NextFile = 0;
+		int32 NumConverted = 0;
+		FHdriVaultImportFileResult Totals;
+	};
+
+	void StartNextJob();
+	void PrepareNextFile();
+	void LaunchPrepare(const TSharedRef<FJob, ESPMode::ThreadSafe>& Job, const FString& SourceFile, const FString& StagedFile);
+	void ImportPreparedFile(const TSharedRef<FJob, ESPMode::ThreadSafe>& Job, const FString& PreparedFile, bool bConverted);
+	void FinishActiveJob(EHdriVaultOperationResult Result);
+
+	void UpdateNotification(const FJob& Job) const;
+	static FText GetSummaryText(const FJob& Job, EHdriVaultOperationResult Result);
+
+	TArray<TSharedRef<FJob, ESPMode::ThreadSafe>> PendingJobs;
+	TSharedPtr<FJob, ESPMode::ThreadSafe> ActiveJob;
+
+	TWeakPtr<FHdriVaultWorkScheduler> WorkScheduler;
+	TWeakPtr<FHdriVaultWorkerPool> WorkerPool;
+
+	bool bIsInitialized = false;
+};
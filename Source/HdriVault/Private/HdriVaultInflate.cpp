@@ -0,0 +1,70 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultInflate.h"
+
+#if HDRIVAULT_INFLATE_LIBDEFLATE
+	#include "libdeflate.h"
+#elif HDRIVAULT_INFLATE_ZLIB
+	THIRD_PARTY_INCLUDES_START
+	#include "zlib.h"
+	THIRD_PARTY_INCLUDES_END
+#endif
+
+#if HDRIVAULT_INFLATE_LIBDEFLATE
+namespace HdriVaultInflateUtils
+{
+	// libdeflate decompressors are not thread safe, so every thread that decodes keeps its own
+	struct FThreadDecompressor
+	{
+		libdeflate_decompressor* Decompressor = libdeflate_alloc_decompressor();
+		~FThreadDecompressor() { libdeflate_free_decompressor(Decompressor); }
+	};
+
+	static libdeflate_decompressor* GetDecompressor()
+	{
+		static thread_local FThreadDecompressor ThreadDecompressor;
+		return ThreadDecompressor.Decompressor;
+	}
+}
+#endif
+
+bool FHdriVaultInflate::Uncompress(uint8* Dest, int64 DestSize, const uint8* Source, int64 SourceSize, int64& OutSize)
+{
+	OutSize = 0;
+	if (DestSize < 0 || SourceSize < 0 || DestSize > MAX_uint32 || SourceSize > MAX_uint32)
+	{
+		return false;
+	}
+
+#if HDRIVAULT_INFLATE_LIBDEFLATE
+	libdeflate_decompressor* Decompressor = HdriVaultInflateUtils::GetDecompressor();
+	size_t WrittenSize = 0;
+	if (!Decompressor || libdeflate_zlib_decompress(Decompressor, Source, static_cast<size_t>(SourceSize), Dest, static_cast<size_t>(DestSize), &WrittenSize) != LIBDEFLATE_SUCCESS)
+	{
+		return false;
+	}
+	OutSize = static_cast<int64>(WrittenSize);
+	return true;
+#elif HDRIVAULT_INFLATE_ZLIB
+	uLongf WrittenSize = static_cast<uLongf>(DestSize);
+	if (uncompress(Dest, &WrittenSize, Source, static_cast<uLong>(SourceSize)) != Z_OK)
+	{
+		return false;
+	}
+	OutSize = static_cast<int64>(WrittenSize);
+	return true;
+#else
+	return false;
+#endif
+}
+
+const TCHAR* FHdriVaultInflate::GetBackendName()
+{
+#if HDRIVAULT_INFLATE_LIBDEFLATE
+	return TEXT("libdeflate");
+#elif HDRIVAULT_INFLATE_ZLIB
+	return TEXT("zlib");
+#else
+	return TEXT("miniz");
+#endif
+}
@@ -0,0 +1,41 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Set by HdriVault.Build.cs from the chosen inflate backend
+#ifndef HDRIVAULT_INFLATE_ZLIB
+	#define HDRIVAULT_INFLATE_ZLIB 0
+#endif
+#ifndef HDRIVAULT_INFLATE_LIBDEFLATE
+	#define HDRIVAULT_INFLATE_LIBDEFLATE 0
+#endif
+
+#define HDRIVAULT_INFLATE_FAST (HDRIVAULT_INFLATE_ZLIB || HDRIVAULT_INFLATE_LIBDEFLATE)
+
+/**
+ * Inflates the zlib streams in ZIP and ZIPS compressed EXR chunks.
+ *
+ * The backend is fixed at build time in HdriVault.Build.cs: the engine's zlib, or libdeflate when a copy
+ * is placed under the plugin's ThirdParty folder. Builds with neither leave decoding to the miniz copy
+ * bundled with tinyexr. HdriVault.BenchmarkExrInflate compares the backend against miniz on real files,
+ * and the HdriVault.Inflate.MatchMiniz automation test checks its output on synthetic chunks.
+ */
+class FHdriVaultInflate
+{
+public:
+	/**
+	 * Inflates one zlib stream. Safe to call from any thread.
+	 * @param DestSize - Room in Dest; streams that inflate to more than this fail
+	 * @param OutSize - Bytes written to Dest
+	 * @return false for corrupt streams, or always when no backend was compiled in
+	 */
+	static bool Uncompress(uint8* Dest, int64 DestSize, const uint8* Source, int64 SourceSize, int64& OutSize);
+
+	// Whether a backend other than tinyexr's miniz was compiled in
+	static constexpr bool IsAvailable() { return HDRIVAULT_INFLATE_FAST != 0; }
+
+	// Name of the backend compiled in, for logs
+	static const TCHAR* GetBackendName();
+};
@@ -1,9 +1,23 @@
 // Copyright Pyre Labs 2025. All Rights Reserved.
 
 #include "HdriVaultManager.h"
+#include "HdriVault.h"
 #include "HdriVaultThumbnailManager.h"
+#include "HdriVaultMetadataWriter.h"
+#include "HdriVaultRefreshScheduler.h"
+#include "HdriVaultWorkScheduler.h"
+#include "HdriVaultWorkerPool.h"
+#include "HdriVaultImportQueue.h"
+#include "HdriVaultImportPrefetch.h"
+#include "HdriVaultSearchIndex.h"
+#include "HdriVaultCatalog.h"
+#include "HdriVaultCatalogSnapshot.h"
+#include "HdriVaultQuery.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/StableSort.h"
 #include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetRegistry/AssetData.h"
+#include "AssetRegistry/ARFilter.h"
 #include "Materials/Material.h"
 #include "Materials/MaterialInstance.h"
 #include "Materials/MaterialInstanceConstant.h"
@@ -14,7 +28,9 @@
 #include "Components/SkyLightComponent.h"
 #include "Engine/SkyLight.h"
 #include "Misc/DateTime.h"
+#include "Misc/PackageName.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
 #include "Misc/FileHelper.h"
 #include "Dom/JsonObject.h"
 #include "Serialization/JsonSerializer.h"
@@ -36,10 +52,148 @@
 #include "Factories/TextureFactory.h"
 #include "AutomatedAssetImportData.h"
 #include "Misc/FileHelper.h"
+#include "Async/ParallelFor.h"
+#include "Misc/ScopeRWLock.h"
 #include "HdriVaultImageUtils.h"
 
 #define LOCTEXT_NAMESPACE "HdriVaultManager"
 
+namespace HdriVaultMetadataUtils
+{
+	// Per-worker scratch used while ingesting metadata files in parallel
+	struct FIngestContext
+	{
+		FString FileContents;
+	};
+
+	// Result of the parallel ingest phase for a single asset
+	struct FIngestResult
+	{
+		FHdriVaultMetadata Metadata;
+		bool bHasMetadata = false;
+	};
+
+	static bool ParseMetadataJson(const FString& FileContents, FHdriVaultMetadata& OutMetadata)
+	{
+		TSharedPtr<FJsonObject> JsonObject;
+		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContents);
+
+		if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+		{
+			return false;
+		}
+
+		OutMetadata.MaterialName = JsonObject->GetStringField(TEXT("MaterialName"));
+		OutMetadata.Author = JsonObject->GetStringField(TEXT("Author"));
+		OutMetadata.Notes = JsonObject->GetStringField(TEXT("Notes"));
+		OutMetadata.Category = JsonObject->GetStringField(TEXT("Category"));
+
+		FString DateString = JsonObject->GetStringField(TEXT("LastModified"));
+		FDateTime::Parse(DateString, OutMetadata.LastModified);
+
+		const TArray<TSharedPtr<FJsonValue>>* TagsArray;
+		if (JsonObject->TryGetArrayField(TEXT("Tags"), TagsArray))
+		{
+			OutMetadata.Tags.Empty(TagsArray->Num());
+			for (const auto& TagValue : *TagsArray)
+			{
+				OutMetadata.Tags.Add(TagValue->AsString());
+			}
+		}
+
+		if (JsonObject->HasTypedField<EJson::String>(TEXT("CustomThumbnailPath")))
+		{
+			OutMetadata.CustomThumbnailPath = JsonObject->GetStringField(TEXT("CustomThumbnailPath"));
+		}
+		else
+		{
+			OutMetadata.CustomThumbnailPath.Empty();
+		}
+
+		// Files written before the source size was recorded leave it unknown
+		OutMetadata.SourceWidth = 0;
+		OutMetadata.SourceHeight = 0;
+		JsonObject->TryGetNumberField(TEXT("SourceWidth"), OutMetadata.SourceWidth);
+		JsonObject->TryGetNumberField(TEXT("SourceHeight"), OutMetadata.SourceHeight);
+
+		return true;
+	}
+
+	// Safe to call from any thread; Scratch is reused between calls to avoid reallocating file buffers
+	static bool ReadMetadataFile(const FString& MetadataPath, FString& Scratch, FHdriVaultMetadata& OutMetadata)
+	{
+		Scratch.Reset();
+		if (!FFileHelper::LoadFileToString(Scratch, *MetadataPath))
+		{
+			// A crash in the middle of replacing the file leaves only the staged write. A staged write that
+			// was itself cut short does not parse.
+			if (IFileManager::Get().FileExists(*MetadataPath)
+				|| !FFileHelper::LoadFileToString(Scratch, *FHdriVaultMetadataWriter::GetTempFilePath(MetadataPath)))
+			{
+				return false;
+			}
+		}
+
+		return ParseMetadataJson(Scratch, OutMetadata);
+	}
+}
+
+/**
+ * Progress of one reconciliation between the catalog and the registry (and optionally the metadata
+ * files on disk). Advanced in slices by StepReconcile; every phase resumes where it stopped.
+ */
+struct FHdriVaultReconcilePass
+{
+	enum class EPhase : uint8
+	{
+		QueryRegistry,
+		DiffAssets,
+		FindRemoved,
+		ApplyChanges,
+		CheckMetadata,
+		Done
+	};
+
+	EPhase Phase = EPhase::QueryRegistry;
+	bool bCheckMetadata = false;
+	bool bQueryStarted = false;
+	int32 Cursor = 0;
+
+	// Folders still to be queried, one per step so no registry call walks the whole scope
+	TArray<FString> PendingPaths;
+
+	// Registry results, and the catalog items that existed when they were queried
+	TArray<FAssetData> Assets;
+	TArray<FHdriVaultItemHandle> Handles;
+	TSet<FHdriVaultItemHandle> SeenHandles;
+
+	// Differences found, applied in the ApplyChanges phase
+	TArray<FAssetData> AddedAssets;
+	TArray<FAssetData> ChangedAssets;
+	TArray<FSoftObjectPath> RemovedPaths;
+
+	// Reused between metadata file reads
+	FString FileContents;
+
+	// Measured cost of creating one new item, which sizes the next chunk of additions
+	double AddSecondsPerItem = 0.0;
+	
+	// Rough fraction of the pass that is done, for progress reporting
+	float GetProgress() const
+	{
+		auto Fraction = [this](int32 Total) { return Total > 0 ? float(Cursor) / float(Total) : 1.0f; };
+		switch (Phase)
+		{
+		case EPhase::QueryRegistry:	return 0.0f;
+		case EPhase::DiffAssets:	return 0.05f + 0.25f * Fraction(Assets.Num());
+		case EPhase::FindRemoved:	return 0.3f + 0.1f * Fraction(Handles.Num());
+		case EPhase::ApplyChanges:	return 0.4f + 0.4f * Fraction(AddedAssets.Num() + ChangedAssets.Num() + RemovedPaths.Num());
+		case EPhase::CheckMetadata:	return 0.8f + 0.2f * Fraction(Handles.Num());
+		default:					return 1.0f;
+		}
+	}
+};
+
 UHdriVaultManager::UHdriVaultManager()
 	: AssetRegistryModule(nullptr)
 	, bIsInitialized(false)
@@ -61,10 +215,41 @@ void UHdriVaultManager::Initialize(FSubsystemCollectionBase& Collection)
 		AssetRegistry.OnAssetUpdated().AddUObject(this, &UHdriVaultManager::OnAssetUpdated);
 	}
 	
+	// Vault background work runs on its own threads instead of the shared task graph
+	WorkerPool = MakeShared<FHdriVaultWorkerPool>();
+	WorkerPool->Initialize();
+	
+	// Game-thread work from every vault system shares one per-frame budget
+	WorkScheduler = MakeShared<FHdriVaultWorkScheduler>();
+	WorkScheduler->Initialize();
+	
+	// Imports run as queued background jobs
+	ImportQueue = MakeShared<FHdriVaultImportQueue, ESPMode::ThreadSafe>();
+	ImportQueue->OnImportFile.BindUObject(this, &UHdriVaultManager::ImportPreparedFile);
+	ImportQueue->Initialize(WorkScheduler.ToSharedRef(), WorkerPool.ToSharedRef());
+	
 	// Initialize thumbnail manager
 	ThumbnailManager = MakeShared<FHdriVaultThumbnailManager>();
+	ThumbnailManager->SetWorkScheduler(WorkScheduler);
 	ThumbnailManager->Initialize();
 	
+	// Initialize metadata writer
+	MetadataWriter = MakeShared<FHdriVaultMetadataWriter>();
+	MetadataWriter->SetWorkerPool(WorkerPool);
+	MetadataWriter->Initialize();
+	
+	Catalog = MakeShared<FHdriVaultCatalog>();
+	SearchIndex = MakeShared<FHdriVaultSearchIndex>();
+	
+	UpdateScanScope();
+	
+	// Background reconciliation, driven by bAutoRefresh and RefreshInterval
+	RefreshScheduler = MakeShared<FHdriVaultRefreshScheduler>();
+	RefreshScheduler->OnBeginPass.BindUObject(this, &UHdriVaultManager::BeginBackgroundReconcile);
+	RefreshScheduler->OnStep.BindUObject(this, &UHdriVaultManager::StepBackgroundReconcile);
+	RefreshScheduler->SetAutoRefresh(Settings.bAutoRefresh, Settings.RefreshInterval);
+	RefreshScheduler->Initialize(WorkScheduler.ToSharedRef());
+	
 	// Initialize root folder
 	RootFolderNode = MakeShared<FHdriVaultFolderNode>(TEXT("Root"), Settings.RootFolder);
 	FolderMap.Add(Settings.RootFolder, RootFolderNode);
@@ -77,6 +262,9 @@ void UHdriVaultManager::Initialize(FSubsystemCollectionBase& Collection)
 
 void UHdriVaultManager::Deinitialize()
 {
+	// Their remaining work is about to be dropped
+	CancelActiveOperations();
+	
 	if (AssetRegistryModule)
 	{
 		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
@@ -86,16 +274,58 @@ void UHdriVaultManager::Deinitialize()
 		AssetRegistry.OnAssetUpdated().RemoveAll(this);
 	}
 	
+	if (RefreshScheduler.IsValid())
+	{
+		RefreshScheduler->Shutdown();
+		RefreshScheduler.Reset();
+	}
+	ReconcilePass.Reset();
+	
+	if (ImportQueue.IsValid())
+	{
+		ImportQueue->Shutdown();
+		ImportQueue.Reset();
+	}
+	
+	// Nothing queued may run against systems that are being torn down
+	if (WorkScheduler.IsValid())
+	{
+		WorkScheduler->Shutdown();
+	}
+	
 	if (ThumbnailManager.IsValid())
 	{
 		ThumbnailManager->Shutdown();
 		ThumbnailManager.Reset();
 	}
 	
+	// Flush queued metadata writes before tearing down
+	if (MetadataWriter.IsValid())
+	{
+		MetadataWriter->Shutdown();
+		MetadataWriter.Reset();
+	}
+	
+	// Last, so queued metadata writes can still run while the writer flushes
+	if (WorkerPool.IsValid())
+	{
+		WorkerPool->Shutdown();
+		WorkerPool.Reset();
+	}
+	
+	WorkScheduler.Reset();
+	
 	// Clean up data
 	FolderMap.Empty();
-	MaterialMap.Empty();
-	MetadataCache.Empty();
+	Catalog.Reset();
+	{
+		FWriteScopeLock Lock(SnapshotLock);
+		CurrentSnapshot.Reset();
+	}
+	FolderViewCache.Empty();
+	TagIndex.Empty();
+	SearchIndex.Reset();
+	ResolutionIndex.Empty();
 	RootFolderNode.Reset();
 	
 	bIsInitialized = false;
@@ -110,614 +340,1833 @@ void UHdriVaultManager::RefreshMaterialDatabase()
 		return;
 	}
 	
-	// Clear existing data
-	MaterialMap.Empty();
-	if (RootFolderNode.IsValid())
-	{
-		RootFolderNode->Materials.Empty();
-		RootFolderNode->Children.Empty();
-	}
-	
-	// Get all HDRI assets
-	TArray<FAssetData> HdriAssets;
-	if (AssetRegistryModule)
-	{
-		IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
-		
-		// Get TextureCube assets only
-		AssetRegistry.GetAssetsByClass(UTextureCube::StaticClass()->GetClassPathName(), HdriAssets);
-	}
-	
-	// Process each asset
-	for (const FAssetData& AssetData : HdriAssets)
+	// An empty catalog is filled in one bulk pass and announced as a whole
+	if (Catalog->Num() == 0)
 	{
-		ProcessMaterialAsset(AssetData);
+		TArray<FAssetData> HdriAssets;
+		QueryHdriAssets(HdriAssets);
+		LoadMaterialDatabase(HdriAssets);
+		return;
 	}
 	
-	// Build folder structure
-	BuildFolderStructure();
-	
-	// Broadcast refresh complete
-	OnRefreshRequested.Broadcast();
+	// Otherwise reconcile against the registry in one go, so existing items (and their thumbnails)
+	// survive and only the differences are announced
+	FHdriVaultReconcilePass Pass;
+	StepReconcile(Pass, TNumericLimits<double>::Max());
 }
 
-void UHdriVaultManager::BuildFolderStructure()
+FHdriVaultOperationRef UHdriVaultManager::RefreshMaterialDatabaseAsync()
 {
-	if (!RootFolderNode.IsValid())
+	FHdriVaultOperationRef Operation = BeginOperation();
+	if (!bIsInitialized)
 	{
-		return;
+		Operation->Complete(EHdriVaultOperationResult::Failed);
+		return Operation;
 	}
 	
-	// Clear existing structure
-	RootFolderNode->Children.Empty();
-	FolderMap.Empty();
-	FolderMap.Add(Settings.RootFolder, RootFolderNode);
-	
-	// Create main category folders
-	TSharedPtr<FHdriVaultFolderNode> ContentFolder = CreateFolderNode(TEXT("/Game"));
-	ContentFolder->FolderName = TEXT("Content");
-	TSharedPtr<FHdriVaultFolderNode> EngineFolder = CreateFolderNode(TEXT("/Engine"));
-	EngineFolder->FolderName = TEXT("Engine");
-	TSharedPtr<FHdriVaultFolderNode> PluginFolder = CreateFolderNode(TEXT("/Plugins"));
-	PluginFolder->FolderName = TEXT("Plugins");
-	
-	if (RootFolderNode.IsValid())
+	if (Catalog->Num() > 0)
 	{
-		ContentFolder->Parent = RootFolderNode;
-		EngineFolder->Parent = RootFolderNode;
-		PluginFolder->Parent = RootFolderNode;
-		RootFolderNode->Children.Add(ContentFolder);
-		RootFolderNode->Children.Add(EngineFolder);
-		RootFolderNode->Children.Add(PluginFolder);
+		StepReconcileAsync(Operation, MakeShared<FHdriVaultReconcilePass>());
+		return Operation;
 	}
 	
-	FolderMap.Add(TEXT("/Game"), ContentFolder);
-	FolderMap.Add(TEXT("/Engine"), EngineFolder);
-	FolderMap.Add(TEXT("/Plugins"), PluginFolder);
+	// Metadata files are read on a worker; the merge and announcement stay on the game thread
+	struct FBulkLoad
+	{
+		TArray<FAssetData> Assets;
+		TArray<TSharedPtr<FHdriVaultMaterialItem>> MaterialItems;
+		TArray<FDateTime> MetadataFileTimes;
+	};
+	TSharedRef<FBulkLoad, ESPMode::ThreadSafe> Load = MakeShared<FBulkLoad, ESPMode::ThreadSafe>();
+	QueryHdriAssets(Load->Assets);
+	Operation->SetProgress(0.05f, LOCTEXT("RefreshReadingMetadata", "Reading metadata"));
 	
-	// Build structure from materials
-	for (const auto& MaterialPair : MaterialMap)
+	// The pool waits for running work before the scheduler is released, so both outlive the task
+	FHdriVaultWorkScheduler* Scheduler = WorkScheduler.Get();
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
+	WorkerPool->Launch(EHdriVaultWorkerPriority::Bulk, [this, Scheduler, WeakThis, Operation, Load]()
 	{
-		const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem = MaterialPair.Value;
-		if (MaterialItem.IsValid())
+		if (!Operation->IsCancelRequested())
+		{
+			CreateMaterialItems(Load->Assets, Load->MaterialItems, Load->MetadataFileTimes);
+			Operation->SetProgress(0.8f, LOCTEXT("RefreshMerging", "Updating vault"));
+		}
+		
+		Scheduler->Enqueue(EHdriVaultWorkPriority::Visible, [WeakThis, Operation, Load]()
 		{
-			FString PackagePath = MaterialItem->AssetData.PackagePath.ToString();
-			FString OrganizedPath = OrganizePackagePath(PackagePath);
+			UHdriVaultManager* This = WeakThis.Get();
+			if (!This || Operation->IsComplete())
+			{
+				return;
+			}
 			
-			// Create folder nodes for this path
-			TSharedPtr<FHdriVaultFolderNode> FolderNode = GetOrCreateFolderNode(OrganizedPath);
-			if (FolderNode.IsValid())
+			if (Operation->IsCancelRequested())
 			{
-				FolderNode->Materials.Add(MaterialItem);
+				Operation->Complete(EHdriVaultOperationResult::Cancelled);
 			}
-		}
-	}
-}
-
-void UHdriVaultManager::LoadMaterialsFromFolder(const FString& FolderPath)
-{
-	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(FolderPath);
-	if (FolderNode.IsValid())
-	{
-		// Load thumbnails for materials in this folder
-		for (const auto& MaterialItem : FolderNode->Materials)
-		{
-			if (MaterialItem.IsValid() && ThumbnailManager.IsValid())
+			else if (This->Catalog->Num() > 0)
 			{
-				LoadMaterialThumbnail(MaterialItem);
+				// Another refresh filled the catalog meanwhile; only reconcile against it
+				This->StepReconcileAsync(Operation, MakeShared<FHdriVaultReconcilePass>());
 			}
-		}
-	}
-}
-
-TSharedPtr<FHdriVaultFolderNode> UHdriVaultManager::FindFolder(const FString& FolderPath) const
-{
-	return FolderMap.FindRef(FolderPath);
+			else
+			{
+				This->MergeMaterialDatabase(Load->Assets, Load->MaterialItems, Load->MetadataFileTimes);
+				Operation->Complete(EHdriVaultOperationResult::Succeeded);
+			}
+		});
+	});
+	
+	return Operation;
 }
 
-TArray<TSharedPtr<FHdriVaultFolderNode>> UHdriVaultManager::GetChildFolders(const FString& FolderPath) const
+void UHdriVaultManager::QueryHdriAssets(TArray<FAssetData>& OutAssets) const
 {
-	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(FolderPath);
-	if (FolderNode.IsValid())
+	if (!AssetRegistryModule)
 	{
-		return FolderNode->Children;
+		return;
 	}
-	return TArray<TSharedPtr<FHdriVaultFolderNode>>();
-}
-
-TArray<TSharedPtr<FHdriVaultMaterialItem>> UHdriVaultManager::GetMaterialsInFolder(const FString& FolderPath) const
-{
-	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(FolderPath);
-	if (FolderNode.IsValid())
+	
+	IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
+	
+	// Get TextureCube assets only, and only from the configured scan paths
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UTextureCube::StaticClass()->GetClassPathName());
+	Filter.bRecursivePaths = true;
+	for (const FString& IncludePath : ScanIncludePaths)
 	{
-		TArray<TSharedPtr<FHdriVaultMaterialItem>> CollectedMaterials;
-
-		TFunction<void(const TSharedPtr<FHdriVaultFolderNode>&)> GatherMaterialsRecursive;
-		GatherMaterialsRecursive = [&CollectedMaterials, &GatherMaterialsRecursive](const TSharedPtr<FHdriVaultFolderNode>& Node)
+		Filter.PackagePaths.Add(FName(*IncludePath));
+	}
+	AssetRegistry.GetAssets(Filter, OutAssets);
+	
+	// The registry filter has no exclusions; drop excluded subtrees before anything is ingested
+	if (ScanExcludePaths.Num() > 0)
+	{
+		OutAssets.RemoveAll([this](const FAssetData& AssetData)
 		{
-			if (!Node.IsValid())
-			{
-				return;
-			}
-
-			CollectedMaterials.Append(Node->Materials);
-
-			for (const TSharedPtr<FHdriVaultFolderNode>& Child : Node->Children)
-			{
-				GatherMaterialsRecursive(Child);
-			}
-		};
-
-		GatherMaterialsRecursive(FolderNode);
-
-		SortMaterials(CollectedMaterials);
-		return CollectedMaterials;
+			return !IsInScanScope(AssetData);
+		});
 	}
-	return TArray<TSharedPtr<FHdriVaultMaterialItem>>();
-}
-
-TSharedPtr<FHdriVaultMaterialItem> UHdriVaultManager::GetMaterialByPath(const FString& AssetPath) const
-{
-	return MaterialMap.FindRef(AssetPath);
 }
 
-void UHdriVaultManager::LoadMaterialThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+void UHdriVaultManager::GetScanRoots(TArray<FString>& OutPaths) const
 {
-	if (MaterialItem.IsValid() && ThumbnailManager.IsValid())
+	OutPaths = ScanIncludePaths;
+	if (OutPaths.Num() > 0)
 	{
-		ThumbnailManager->LoadThumbnailAsync(MaterialItem, (int32)Settings.ThumbnailSize);
+		return;
 	}
+	
+	// No include paths covers every mounted content root
+	FPackageName::QueryRootContentPaths(OutPaths, false, false, true);
+	OutPaths.RemoveAll([this](const FString& Path)
+	{
+		return Path.IsEmpty() || !IsPathInScanScope(Path);
+	});
 }
 
-void UHdriVaultManager::LoadMaterialDependencies(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+void UHdriVaultManager::QueryHdriAssetsInFolder(const FString& PackagePath, TArray<FAssetData>& OutAssets, TArray<FString>& OutSubPaths) const
 {
-	if (!MaterialItem.IsValid())
+	if (!AssetRegistryModule)
 	{
 		return;
 	}
 	
-	// Load the asset
-	UObject* Asset = MaterialItem->MaterialPtr.LoadSynchronous();
-	UMaterialInterface* Material = Cast<UMaterialInterface>(Asset);
-	
-	if (!Material)
-	{
-		// Not a material, likely an HDRI texture. No dependencies to load.
-		return;
-	}
+	IAssetRegistry& AssetRegistry = AssetRegistryModule->Get();
 	
-	// Get texture dependencies
-	TArray<UTexture*> ReferencedTextures;
-	Material->GetUsedTextures(ReferencedTextures, EMaterialQualityLevel::Num, true, ERHIFeatureLevel::Num, true);
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UTextureCube::StaticClass()->GetClassPathName());
+	Filter.PackagePaths.Add(FName(*PackagePath));
+	Filter.bRecursivePaths = false;
+	TArray<FAssetData> FolderAssets;
+	AssetRegistry.GetAssets(Filter, FolderAssets);
+	OutAssets.Append(MoveTemp(FolderAssets));
 	
-	MaterialItem->TextureDependencies.Empty();
-	for (UTexture* Texture : ReferencedTextures)
+	// Excluded subtrees are not descended into
+	TArray<FString> SubPaths;
+	AssetRegistry.GetSubPaths(PackagePath, SubPaths, false);
+	for (FString& SubPath : SubPaths)
 	{
-		if (UTexture2D* Texture2D = Cast<UTexture2D>(Texture))
+		if (IsPathInScanScope(SubPath))
 		{
-			MaterialItem->TextureDependencies.Add(Texture2D);
+			OutSubPaths.Add(MoveTemp(SubPath));
 		}
 	}
 }
 
-void UHdriVaultManager::ApplyMaterialToSelection(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+bool UHdriVaultManager::StepReconcile(FHdriVaultReconcilePass& Pass, double Deadline)
 {
-	if (!MaterialItem.IsValid())
-	{
-		return;
-	}
-	
-	// Try to load as TextureCube first
-	UTextureCube* HdriTexture = Cast<UTextureCube>(MaterialItem->MaterialPtr.LoadSynchronous());
-	
-	if (!HdriTexture)
+	// Time is only checked every few items; a single item is far below any sensible budget
+	constexpr int32 ItemsPerTimeCheck = 64;
+	auto IsOutOfTime = [Deadline](int32 Count)
 	{
-		// Show error notification
-		FNotificationInfo Info(LOCTEXT("HdriLoadFailed", "Failed to load HDRI asset for application"));
-		Info.ExpireDuration = 3.0f;
-		Info.bFireAndForget = true;
-		Info.Image = FAppStyle::GetBrush("Icons.ErrorWithColor");
-		FSlateNotificationManager::Get().AddNotification(Info);
-		return;
-	}
-	
-	// Start transaction for undo/redo
-	FScopedTransaction Transaction(LOCTEXT("ApplyHdri", "Apply HDRI to Skylight"));
+		return (Count % ItemsPerTimeCheck) == 0 && FPlatformTime::Seconds() >= Deadline;
+	};
 	
-	int32 ComponentsModified = 0;
-	int32 BackdropsModified = 0;
-	
-	// Find Skylight Actors in the world
-	if (GEditor && GEditor->GetEditorWorldContext().World())
+	while (Pass.Phase != FHdriVaultReconcilePass::EPhase::Done)
 	{
-		UWorld* World = GEditor->GetEditorWorldContext().World();
-		
-		// 1. Apply to Skylights
-		for (TActorIterator<ASkyLight> It(World); It; ++It)
+		switch (Pass.Phase)
 		{
-			ASkyLight* SkyLight = *It;
-			if (SkyLight && SkyLight->GetLightComponent())
+		case FHdriVaultReconcilePass::EPhase::QueryRegistry:
+		{
+			if (!Pass.bQueryStarted)
 			{
-				USkyLightComponent* Component = SkyLight->GetLightComponent();
-				Component->Modify();
-				
-				if (HdriTexture)
+				// Events deliver everything the registry discovers while it is still scanning
+				if (AssetRegistryModule && AssetRegistryModule->Get().IsLoadingAssets())
 				{
-					Component->SourceType = SLS_SpecifiedCubemap;
-					Component->Cubemap = HdriTexture;
+					Pass.Phase = Pass.bCheckMetadata ? FHdriVaultReconcilePass::EPhase::CheckMetadata : FHdriVaultReconcilePass::EPhase::Done;
+					Catalog->GetHandles(Pass.Handles);
+					break;
 				}
 				
-				// Recapture skylight
-				Component->SetCaptureIsDirty();
-				ComponentsModified++;
+				// Items added after this point are not part of the pass, so they can never be mistaken for removed ones
+				Catalog->GetHandles(Pass.Handles);
+				GetScanRoots(Pass.PendingPaths);
+				Pass.bQueryStarted = true;
 			}
-		}
-
-		// 2. Apply to HDRI Backdrop actors
-		// Try to load the specific HDRIBackdrop class
-		UClass* BackdropClass = nullptr;
-		FSoftClassPath BackdropClassPath(TEXT("/HDRIBackdrop/Blueprints/HDRIBackdrop.HDRIBackdrop_C"));
-		BackdropClass = BackdropClassPath.TryLoadClass<AActor>();
-
-		if (BackdropClass)
-		{
-			for (TActorIterator<AActor> It(World, BackdropClass); It; ++It)
+			
+			// The scope is walked a folder at a time, so a large project is queried across several frames
+			while (Pass.PendingPaths.Num() > 0)
 			{
-				AActor* Actor = *It;
-				if (!Actor) continue;
-
-				// Check for Cubemap property
-				FProperty* Property = Actor->GetClass()->FindPropertyByName(FName("Cubemap"));
-				FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
-				
-				if (ObjectProperty && ObjectProperty->PropertyClass && ObjectProperty->PropertyClass->IsChildOf(UTextureCube::StaticClass()))
+				const FString PackagePath = Pass.PendingPaths.Pop(EAllowShrinking::No);
+				QueryHdriAssetsInFolder(PackagePath, Pass.Assets, Pass.PendingPaths);
+				if (FPlatformTime::Seconds() >= Deadline)
 				{
-					Actor->Modify();
-					
-					if (HdriTexture)
+					return false;
+				}
+			}
+			
+			Pass.SeenHandles.Reserve(Pass.Assets.Num());
+			Pass.Phase = FHdriVaultReconcilePass::EPhase::DiffAssets;
+			break;
+		}
+		
+		case FHdriVaultReconcilePass::EPhase::DiffAssets:
+		{
+			// Unknown paths are new; known paths whose package was re-saved have changed
+			while (Pass.Cursor < Pass.Assets.Num())
+			{
+				const FAssetData& AssetData = Pass.Assets[Pass.Cursor++];
+				const FHdriVaultItemHandle Handle = Catalog->Find(AssetData.GetSoftObjectPath());
+				if (!Handle.IsValid())
+				{
+					Pass.AddedAssets.Add(AssetData);
+				}
+				else
+				{
+					Pass.SeenHandles.Add(Handle);
+					if (Catalog->GetPackageStamp(Handle) != GetPackageStamp(AssetData))
 					{
-						ObjectProperty->SetObjectPropertyValue_InContainer(Actor, HdriTexture);
+						Pass.ChangedAssets.Add(AssetData);
 					}
-					
-					// Notify of property change to trigger Construction Script
-					FPropertyChangedEvent PropertyEvent(Property, EPropertyChangeType::ValueSet);
-					Actor->PostEditChangeProperty(PropertyEvent);
-					
-					BackdropsModified++;
 				}
+				
+				if (IsOutOfTime(Pass.Cursor))
+				{
+					return false;
+				}
+			}
+			
+			Pass.Cursor = 0;
+			Pass.Phase = FHdriVaultReconcilePass::EPhase::FindRemoved;
+			break;
+		}
+		
+		case FHdriVaultReconcilePass::EPhase::FindRemoved:
+		{
+			// Catalogued paths the registry no longer reports are gone
+			while (Pass.Cursor < Pass.Handles.Num())
+			{
+				const FHdriVaultItemHandle Handle = Pass.Handles[Pass.Cursor++];
+				if (Catalog->IsValid(Handle) && !Pass.SeenHandles.Contains(Handle))
+				{
+					Pass.RemovedPaths.Add(Catalog->GetObjectPath(Handle));
+				}
+				
+				if (IsOutOfTime(Pass.Cursor))
+				{
+					return false;
+				}
+			}
+			
+			const int32 NumChanges = Pass.AddedAssets.Num() + Pass.ChangedAssets.Num() + Pass.RemovedPaths.Num();
+			if (NumChanges > 0)
+			{
+				UE_LOG(LogTemp, Log, TEXT("HdriVault: Refresh found %d new, %d changed and %d removed assets"), Pass.AddedAssets.Num(), Pass.ChangedAssets.Num(), Pass.RemovedPaths.Num());
 			}
+			
+			Pass.Assets.Empty();
+			Pass.SeenHandles.Empty();
+			Pass.Cursor = 0;
+			Pass.Phase = FHdriVaultReconcilePass::EPhase::ApplyChanges;
+			break;
 		}
-		else
+		
+		case FHdriVaultReconcilePass::EPhase::ApplyChanges:
 		{
-			// Fallback: Iterate all actors if class not found (e.g. if path changed or user made a copy)
-			// but only check actors with "HDRI" in name to be slightly more efficient than checking everything
-			for (TActorIterator<AActor> It(World); It; ++It)
+			// One cursor walks the removed, then changed, then added ranges
+			const int32 NumRemoved = Pass.RemovedPaths.Num();
+			const int32 NumChanged = Pass.ChangedAssets.Num();
+			const int32 NumAdded = Pass.AddedAssets.Num();
+			
+			while (Pass.Cursor < NumRemoved + NumChanged + NumAdded)
 			{
-				AActor* Actor = *It;
-				if (!Actor) continue;
-
-				if (Actor->GetName().Contains(TEXT("HDRI"), ESearchCase::IgnoreCase) || 
-					Actor->GetClass()->GetName().Contains(TEXT("HDRI"), ESearchCase::IgnoreCase))
+				// Registry events may have overtaken the diff; the catalog and registry are re-checked per item.
+				// Assets that still exist but left the scan scope are removed too.
+				if (Pass.Cursor < NumRemoved)
 				{
-					FProperty* Property = Actor->GetClass()->FindPropertyByName(FName("Cubemap"));
-					FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+					const FSoftObjectPath& ObjectPath = Pass.RemovedPaths[Pass.Cursor++];
+					const FAssetData AssetData = AssetRegistryModule ? AssetRegistryModule->Get().GetAssetByObjectPath(ObjectPath) : FAssetData();
+					if (!AssetData.IsValid() || !IsInScanScope(AssetData))
+					{
+						RemoveMaterialAsset(ObjectPath);
+					}
+				}
+				else if (Pass.Cursor < NumRemoved + NumChanged)
+				{
+					const FAssetData& AssetData = Pass.ChangedAssets[Pass.Cursor++ - NumRemoved];
+					if (Catalog->Find(AssetData.GetSoftObjectPath()).IsValid())
+					{
+						ProcessMaterialAsset(AssetData);
+					}
+				}
+				else
+				{
+					// New items read their metadata files in parallel, a chunk at a time. The first chunk is small;
+					// later ones are sized from the measured cost per item to fill what is left of the budget.
+					constexpr int32 FirstAddChunkSize = 8;
+					constexpr int32 MaxAddChunkSize = 256;
+					const int32 ChunkStart = Pass.Cursor - NumRemoved - NumChanged;
+					const double ChunkStartTime = FPlatformTime::Seconds();
+					int32 ChunkSize = FirstAddChunkSize;
+					if (Pass.AddSecondsPerItem > 0.0)
+					{
+						ChunkSize = static_cast<int32>(FMath::Clamp((Deadline - ChunkStartTime) / Pass.AddSecondsPerItem, 1.0, double(MaxAddChunkSize)));
+					}
+					ChunkSize = FMath::Min(ChunkSize, NumAdded - ChunkStart);
 					
-					if (ObjectProperty && ObjectProperty->PropertyClass && ObjectProperty->PropertyClass->IsChildOf(UTextureCube::StaticClass()))
+					TArray<TSharedPtr<FHdriVaultMaterialItem>> AddedItems;
+					TArray<FDateTime> MetadataFileTimes;
+					CreateMaterialItems(MakeArrayView(Pass.AddedAssets).Slice(ChunkStart, ChunkSize), AddedItems, MetadataFileTimes);
+					for (int32 Index = 0; Index < AddedItems.Num(); ++Index)
 					{
-						Actor->Modify();
-						
-						if (HdriTexture)
+						const FAssetData& AssetData = Pass.AddedAssets[ChunkStart + Index];
+						if (Catalog->Find(AssetData.GetSoftObjectPath()).IsValid())
 						{
-							ObjectProperty->SetObjectPropertyValue_InContainer(Actor, HdriTexture);
+							continue;
 						}
 						
-						FPropertyChangedEvent PropertyEvent(Property, EPropertyChangeType::ValueSet);
-						Actor->PostEditChangeProperty(PropertyEvent);
-						
-						BackdropsModified++;
+						AddMaterialItem(AddedItems[Index], AssetData, MetadataFileTimes[Index]);
+						if (RootFolderNode.IsValid())
+						{
+							AddMaterialToFolder(AddedItems[Index]->Handle);
+						}
+						PendingAddedItems.Add(AddedItems[Index]->Handle);
+					}
+					
+					Pass.Cursor += ChunkSize;
+					const double SecondsPerItem = (FPlatformTime::Seconds() - ChunkStartTime) / ChunkSize;
+					Pass.AddSecondsPerItem = Pass.AddSecondsPerItem > 0.0 ? 0.5 * (Pass.AddSecondsPerItem + SecondsPerItem) : SecondsPerItem;
+					if (FPlatformTime::Seconds() >= Deadline)
+					{
+						break;
 					}
+					continue;
+				}
+				
+				if (IsOutOfTime(Pass.Cursor))
+				{
+					break;
 				}
 			}
-		}
-	}
-	
-	if (ComponentsModified > 0 || BackdropsModified > 0)
-	{
-		// Mark level as modified
-		if (GEditor && GEditor->GetEditorWorldContext().World())
-		{
-			GEditor->GetEditorWorldContext().World()->MarkPackageDirty();
+			
+			if (Pass.Cursor < NumRemoved + NumChanged + NumAdded)
+			{
+				PublishPendingChanges();
+				return false;
+			}
+			
+			Pass.Cursor = 0;
+			Pass.Phase = Pass.bCheckMetadata ? FHdriVaultReconcilePass::EPhase::CheckMetadata : FHdriVaultReconcilePass::EPhase::Done;
+			break;
 		}
 		
-		// Show success notification
-		FText Message;
-		if (ComponentsModified > 0 && BackdropsModified > 0)
+		case FHdriVaultReconcilePass::EPhase::CheckMetadata:
 		{
-			Message = FText::Format(LOCTEXT("HdriAppliedBoth", "Applied HDRI '{0}' to {1} Skylight(s) and {2} Backdrop(s)"), 
-				FText::FromString(MaterialItem->DisplayName), FText::AsNumber(ComponentsModified), FText::AsNumber(BackdropsModified));
+			// Pick up metadata files edited outside the vault (source control, other editors)
+			while (Pass.Cursor < Pass.Handles.Num())
+			{
+				const FHdriVaultItemHandle Handle = Pass.Handles[Pass.Cursor++];
+				if (Catalog->IsValid(Handle))
+				{
+					ReloadChangedMetadata(Handle, Pass.FileContents);
+				}
+				
+				if (IsOutOfTime(Pass.Cursor))
+				{
+					PublishPendingChanges();
+					return false;
+				}
+			}
+			
+			Pass.Phase = FHdriVaultReconcilePass::EPhase::Done;
+			break;
 		}
-		else if (BackdropsModified > 0)
-		{
-			Message = FText::Format(LOCTEXT("HdriAppliedBackdrop", "Applied HDRI '{0}' to {1} Backdrop(s)"), 
-				FText::FromString(MaterialItem->DisplayName), FText::AsNumber(BackdropsModified));
+		
+		default:
+			Pass.Phase = FHdriVaultReconcilePass::EPhase::Done;
+			break;
 		}
-		else
+	}
+	
+	PublishPendingChanges();
+	return true;
+}
+
+void UHdriVaultManager::ReloadChangedMetadata(FHdriVaultItemHandle Handle, FString& Scratch)
+{
+	const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem = Catalog->GetItem(Handle);
+	const FString MetadataPath = GetMetadataFilePath(MaterialItem->GetObjectPath());
+	
+	const FDateTime FileTime = IFileManager::Get().GetTimeStamp(*MetadataPath);
+	if (FileTime == Catalog->GetMetadataFileTime(Handle))
+	{
+		return;
+	}
+	Catalog->SetMetadataFileTime(Handle, FileTime);
+	
+	// A deleted file keeps the in-memory metadata; queued writes are newer than whatever is on disk
+	FHdriVaultMetadata DiskMetadata = MaterialItem->Metadata;
+	if (FileTime == FDateTime::MinValue() || (MetadataWriter.IsValid() && MetadataWriter->FindPending(MetadataPath, DiskMetadata)))
+	{
+		return;
+	}
+	
+	if (!HdriVaultMetadataUtils::ReadMetadataFile(MetadataPath, Scratch, DiskMetadata))
+	{
+		return;
+	}
+	
+	// Our own writes land here too once flushed; they match what is already in memory
+	if (FHdriVaultMetadataWriter::SerializeMetadata(DiskMetadata) == FHdriVaultMetadataWriter::SerializeMetadata(MaterialItem->Metadata))
+	{
+		return;
+	}
+	
+	MaterialItem->Metadata = MoveTemp(DiskMetadata);
+	QueueItemChanged(Handle, EHdriVaultItemChange::Metadata | ReindexMaterial(MaterialItem));
+}
+
+void UHdriVaultManager::PublishPendingChanges()
+{
+	if (PendingAddedItems.Num() > 0 || PendingRemovedItems.Num() > 0 || PendingChangedItems.Num() > 0)
+	{
+		PublishSnapshot();
+		BroadcastPendingChanges();
+	}
+}
+
+void UHdriVaultManager::BeginBackgroundReconcile()
+{
+	ReconcilePass = MakeShared<FHdriVaultReconcilePass>();
+	ReconcilePass->bCheckMetadata = true;
+}
+
+bool UHdriVaultManager::StepBackgroundReconcile(double Deadline)
+{
+	// An empty catalog has not been loaded yet; that is the full refresh's job
+	if (!ReconcilePass.IsValid() || !bIsInitialized || Catalog->Num() == 0)
+	{
+		ReconcilePass.Reset();
+		return true;
+	}
+	
+	if (!StepReconcile(*ReconcilePass, Deadline))
+	{
+		return false;
+	}
+	
+	ReconcilePass.Reset();
+	return true;
+}
+
+void UHdriVaultManager::LoadMaterialDatabase(const TArray<FAssetData>& HdriAssets)
+{
+	TArray<TSharedPtr<FHdriVaultMaterialItem>> MaterialItems;
+	TArray<FDateTime> MetadataFileTimes;
+	CreateMaterialItems(HdriAssets, MaterialItems, MetadataFileTimes);
+	
+	MergeMaterialDatabase(HdriAssets, MaterialItems, MetadataFileTimes);
+}
+
+void UHdriVaultManager::MergeMaterialDatabase(const TArray<FAssetData>& HdriAssets, const TArray<TSharedPtr<FHdriVaultMaterialItem>>& MaterialItems, const TArray<FDateTime>& MetadataFileTimes)
+{
+	Catalog->Reset();
+	TagIndex.Empty();
+	SearchIndex->Reset();
+	bResolutionIndexDirty = true;
+	
+	// The load is announced as a whole through OnRefreshRequested
+	PendingAddedItems.Reset();
+	PendingRemovedItems.Reset();
+	PendingChangedItems.Reset();
+	
+	// Merge phase: publish items on the game thread
+	Catalog->Reserve(MaterialItems.Num());
+	Catalog->BeginBulkUpdate();
+	for (int32 Index = 0; Index < MaterialItems.Num(); ++Index)
+	{
+		AddMaterialItem(MaterialItems[Index], HdriAssets[Index], MetadataFileTimes[Index]);
+	}
+	Catalog->EndBulkUpdate();
+	PublishSnapshot();
+	
+	// Build folder structure
+	BuildFolderStructure();
+	
+	// Broadcast refresh complete
+	OnRefreshRequested.Broadcast();
+}
+
+void UHdriVaultManager::CreateMaterialItems(TConstArrayView<FAssetData> Assets, TArray<TSharedPtr<FHdriVaultMaterialItem>>& OutItems, TArray<FDateTime>& OutMetadataFileTimes) const
+{
+	// Parallel phase: read and parse metadata files across workers.
+	// Only reads the asset data - nothing is published until the caller adds the items.
+	OutItems.SetNum(Assets.Num());
+	OutMetadataFileTimes.SetNum(Assets.Num());
+	
+	TArray<HdriVaultMetadataUtils::FIngestContext> IngestContexts;
+	ParallelForWithTaskContext(IngestContexts, Assets.Num(),
+		[this, &Assets, &OutItems, &OutMetadataFileTimes](HdriVaultMetadataUtils::FIngestContext& Context, int32 Index)
 		{
-			Message = FText::Format(LOCTEXT("HdriApplied", "Applied HDRI '{0}' to {1} Skylight(s)"), 
-				FText::FromString(MaterialItem->DisplayName), FText::AsNumber(ComponentsModified));
+			const FAssetData& AssetData = Assets[Index];
+			TSharedPtr<FHdriVaultMaterialItem> MaterialItem = MakeShared<FHdriVaultMaterialItem>(AssetData);
+			
+			// Stamped before reading so an edit racing the read is picked up by the next reconcile
+			const FString MetadataPath = GetMetadataFilePath(AssetData.GetSoftObjectPath());
+			OutMetadataFileTimes[Index] = IFileManager::Get().GetTimeStamp(*MetadataPath);
+			
+			FHdriVaultMetadata Metadata = MaterialItem->Metadata;
+			if (HdriVaultMetadataUtils::ReadMetadataFile(MetadataPath, Context.FileContents, Metadata))
+			{
+				MaterialItem->Metadata = MoveTemp(Metadata);
+			}
+			
+			OutItems[Index] = MoveTemp(MaterialItem);
+		});
+}
+
+void UHdriVaultManager::AddMaterialItem(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, const FAssetData& AssetData, const FDateTime& MetadataFileTime)
+{
+	const FHdriVaultItemHandle Handle = Catalog->Add(MaterialItem, AssetData);
+	Catalog->SetPackageStamp(Handle, GetPackageStamp(AssetData));
+	Catalog->SetMetadataFileTime(Handle, MetadataFileTime);
+	AddTagsToIndex(Handle, MaterialItem->Metadata.Tags);
+	SearchIndex->IndexItem(Handle, *MaterialItem);
+	bResolutionIndexDirty = true;
+}
+
+FIoHash UHdriVaultManager::GetPackageStamp(const FAssetData& AssetData) const
+{
+	if (!AssetRegistryModule)
+	{
+		return FIoHash();
+	}
+	
+	// The saved hash changes whenever the package is re-saved or re-imported
+	const TOptional<FAssetPackageData> PackageData = AssetRegistryModule->Get().GetAssetPackageDataCopy(AssetData.PackageName);
+	return PackageData.IsSet() ? PackageData->GetPackageSavedHash() : FIoHash();
+}
+
+void UHdriVaultManager::BuildFolderStructure()
+{
+	if (!RootFolderNode.IsValid())
+	{
+		return;
+	}
+	
+	// Views reload everything after a rebuild, so individual folders are not announced
+	TGuardValue<bool> RebuildGuard(bRebuildingFolders, true);
+	
+	// Clear existing structure
+	RootFolderNode->Children.Empty();
+	FolderMap.Empty();
+	FolderViewCache.Empty();
+	FolderMap.Add(Settings.RootFolder, RootFolderNode);
+	
+	// Create main category folders
+	TSharedPtr<FHdriVaultFolderNode> ContentFolder = CreateFolderNode(TEXT("/Game"));
+	ContentFolder->FolderName = TEXT("Content");
+	TSharedPtr<FHdriVaultFolderNode> EngineFolder = CreateFolderNode(TEXT("/Engine"));
+	EngineFolder->FolderName = TEXT("Engine");
+	TSharedPtr<FHdriVaultFolderNode> PluginFolder = CreateFolderNode(TEXT("/Plugins"));
+	PluginFolder->FolderName = TEXT("Plugins");
+	
+	if (RootFolderNode.IsValid())
+	{
+		ContentFolder->Parent = RootFolderNode;
+		EngineFolder->Parent = RootFolderNode;
+		PluginFolder->Parent = RootFolderNode;
+		RootFolderNode->Children.Add(ContentFolder);
+		RootFolderNode->Children.Add(EngineFolder);
+		RootFolderNode->Children.Add(PluginFolder);
+	}
+	
+	FolderMap.Add(TEXT("/Game"), ContentFolder);
+	FolderMap.Add(TEXT("/Engine"), EngineFolder);
+	FolderMap.Add(TEXT("/Plugins"), PluginFolder);
+	
+	// Build structure from materials
+	Catalog->ForEach([this](FHdriVaultItemHandle Handle)
+	{
+		AddMaterialToFolder(Handle);
+	});
+}
+
+void UHdriVaultManager::AddMaterialToFolder(FHdriVaultItemHandle Handle)
+{
+	FString OrganizedPath = OrganizePackagePath(Catalog->GetPackagePath(Handle).ToString());
+	
+	// Create folder nodes for this path
+	TSharedPtr<FHdriVaultFolderNode> FolderNode = GetOrCreateFolderNode(OrganizedPath);
+	if (FolderNode.IsValid())
+	{
+		FolderNode->Materials.Add(Handle);
+		InvalidateFolderViews(FolderNode);
+	}
+}
+
+void UHdriVaultManager::RemoveMaterialFromFolder(FHdriVaultItemHandle Handle)
+{
+	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(OrganizePackagePath(Catalog->GetPackagePath(Handle).ToString()));
+	if (!FolderNode.IsValid())
+	{
+		return;
+	}
+	
+	FolderNode->Materials.RemoveSingleSwap(Handle);
+	InvalidateFolderViews(FolderNode);
+	
+	// Prune folders left empty, but keep the fixed top-level nodes
+	while (FolderNode.IsValid() && FolderNode->Parent.IsValid() && FolderNode->Parent != RootFolderNode
+		&& FolderNode->Materials.Num() == 0 && FolderNode->Children.Num() == 0)
+	{
+		TSharedPtr<FHdriVaultFolderNode> ParentNode = FolderNode->Parent;
+		ParentNode->Children.Remove(FolderNode);
+		FolderMap.Remove(FolderNode->FolderPath);
+		FolderViewCache.Remove(FolderNode->FolderPath);
+		OnFolderRemoved.Broadcast(FolderNode);
+		FolderNode = ParentNode;
+	}
+}
+
+void UHdriVaultManager::InvalidateFolderViews(TSharedPtr<FHdriVaultFolderNode> FolderNode)
+{
+	// A folder's view aggregates its subtree, so only it and its ancestors go stale
+	for (; FolderNode.IsValid(); FolderNode = FolderNode->Parent)
+	{
+		FolderViewCache.Remove(FolderNode->FolderPath);
+	}
+}
+
+void UHdriVaultManager::LoadMaterialsFromFolder(const FString& FolderPath)
+{
+	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(FolderPath);
+	if (FolderNode.IsValid())
+	{
+		// Load thumbnails for materials in this folder
+		for (FHdriVaultItemHandle Handle : FolderNode->Materials)
+		{
+			if (Catalog->IsValid(Handle) && ThumbnailManager.IsValid())
+			{
+				LoadMaterialThumbnail(Catalog->GetItem(Handle));
+			}
+		}
+	}
+}
+
+TSharedPtr<FHdriVaultFolderNode> UHdriVaultManager::FindFolder(const FString& FolderPath) const
+{
+	return FolderMap.FindRef(FolderPath);
+}
+
+TArray<TSharedPtr<FHdriVaultFolderNode>> UHdriVaultManager::GetChildFolders(const FString& FolderPath) const
+{
+	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(FolderPath);
+	if (FolderNode.IsValid())
+	{
+		return FolderNode->Children;
+	}
+	return TArray<TSharedPtr<FHdriVaultFolderNode>>();
+}
+
+TSharedRef<const TArray<FHdriVaultItemHandle>> UHdriVaultManager::GetMaterialsInFolderView(const FString& FolderPath) const
+{
+	TSharedPtr<FHdriVaultFolderNode> FolderNode = FindFolder(FolderPath);
+	if (!FolderNode.IsValid())
+	{
+		return MakeShared<TArray<FHdriVaultItemHandle>>();
+	}
+	
+	const uint16 SortModes = (uint16(Settings.SecondarySortMode) << 8) | uint16(Settings.SortMode);
+	TMap<uint16, TSharedRef<const TArray<FHdriVaultItemHandle>>>& FolderViews = FolderViewCache.FindOrAdd(FolderPath);
+	if (const TSharedRef<const TArray<FHdriVaultItemHandle>>* CachedView = FolderViews.Find(SortModes))
+	{
+		return *CachedView;
+	}
+	
+	// Build from the children's views so sibling subtrees that are still cached are reused
+	TSharedRef<TArray<FHdriVaultItemHandle>> View = MakeShared<TArray<FHdriVaultItemHandle>>();
+	View->Append(FolderNode->Materials);
+	for (const TSharedPtr<FHdriVaultFolderNode>& Child : FolderNode->Children)
+	{
+		if (Child.IsValid())
+		{
+			View->Append(*GetMaterialsInFolderView(Child->FolderPath));
+		}
+	}
+	SortMaterials(*View);
+	
+	// Children may have added their own entries, so look the folder up again before inserting
+	FolderViewCache.FindOrAdd(FolderPath).Add(SortModes, View);
+	return View;
+}
+
+TSharedPtr<FHdriVaultMaterialItem> UHdriVaultManager::GetMaterialByPath(const FString& AssetPath) const
+{
+	return Catalog.IsValid() ? GetMaterial(Catalog->Find(FSoftObjectPath(AssetPath))) : nullptr;
+}
+
+TSharedPtr<FHdriVaultMaterialItem> UHdriVaultManager::GetMaterial(FHdriVaultItemHandle Handle) const
+{
+	if (Catalog.IsValid() && Catalog->IsValid(Handle))
+	{
+		return Catalog->GetItem(Handle);
+	}
+	return nullptr;
+}
+
+int32 UHdriVaultManager::GetNumMaterials() const
+{
+	return Catalog.IsValid() ? Catalog->Num() : 0;
+}
+
+void UHdriVaultManager::ForEachMaterial(TFunctionRef<void(FHdriVaultItemHandle)> Visitor) const
+{
+	if (Catalog.IsValid())
+	{
+		Catalog->ForEach([&Visitor](FHdriVaultItemHandle Handle)
+		{
+			Visitor(Handle);
+		});
+	}
+}
+
+FString UHdriVaultManager::GetMaterialFolderPath(FHdriVaultItemHandle Handle) const
+{
+	return Catalog.IsValid() && Catalog->IsValid(Handle) ? OrganizePackagePath(Catalog->GetPackagePath(Handle).ToString()) : FString();
+}
+
+void UHdriVaultManager::LoadMaterialThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	if (MaterialItem.IsValid() && ThumbnailManager.IsValid())
+	{
+		ThumbnailManager->LoadThumbnailAsync(MaterialItem, (int32)Settings.ThumbnailSize);
+	}
+}
+
+void UHdriVaultManager::LoadMaterialDependencies(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	if (!MaterialItem.IsValid())
+	{
+		return;
+	}
+	
+	// Load the asset
+	GatherMaterialDependencies(MaterialItem, MaterialItem->MaterialPtr.LoadSynchronous());
+}
+
+FHdriVaultOperationRef UHdriVaultManager::LoadMaterialDependenciesAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	FHdriVaultOperationRef Operation = BeginOperation();
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
+	LoadAssetForOperation(Operation, MaterialItem, EHdriVaultWorkPriority::Visible, [WeakThis, MaterialItem](UObject* Asset)
+	{
+		return WeakThis.IsValid() && WeakThis->GatherMaterialDependencies(MaterialItem, Asset);
+	});
+	return Operation;
+}
+
+bool UHdriVaultManager::GatherMaterialDependencies(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, UObject* Asset)
+{
+	if (!Asset)
+	{
+		return false;
+	}
+	
+	UMaterialInterface* Material = Cast<UMaterialInterface>(Asset);
+	if (!Material)
+	{
+		// Not a material, likely an HDRI texture. No dependencies to load.
+		return true;
+	}
+	
+	// Get texture dependencies
+	TArray<UTexture*> ReferencedTextures;
+	Material->GetUsedTextures(ReferencedTextures, EMaterialQualityLevel::Num, true, ERHIFeatureLevel::Num, true);
+	
+	MaterialItem->TextureDependencies.Empty();
+	for (UTexture* Texture : ReferencedTextures)
+	{
+		if (UTexture2D* Texture2D = Cast<UTexture2D>(Texture))
+		{
+			MaterialItem->TextureDependencies.Add(Texture2D);
+		}
+	}
+	
+	return true;
+}
+
+void UHdriVaultManager::ApplyMaterialToSelection(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	if (!MaterialItem.IsValid())
+	{
+		return;
+	}
+	
+	ApplyHdriToLevel(MaterialItem, MaterialItem->MaterialPtr.LoadSynchronous());
+}
+
+FHdriVaultOperationRef UHdriVaultManager::ApplyMaterialToSelectionAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	FHdriVaultOperationRef Operation = BeginOperation();
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
+	LoadAssetForOperation(Operation, MaterialItem, EHdriVaultWorkPriority::Interactive, [WeakThis, MaterialItem](UObject* Asset)
+	{
+		return WeakThis.IsValid() && WeakThis->ApplyHdriToLevel(MaterialItem, Asset);
+	});
+	return Operation;
+}
+
+bool UHdriVaultManager::ApplyHdriToLevel(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, UObject* Asset)
+{
+	UTextureCube* HdriTexture = Cast<UTextureCube>(Asset);
+	
+	if (!HdriTexture)
+	{
+		// Show error notification
+		FNotificationInfo Info(LOCTEXT("HdriLoadFailed", "Failed to load HDRI asset for application"));
+		Info.ExpireDuration = 3.0f;
+		Info.bFireAndForget = true;
+		Info.Image = FAppStyle::GetBrush("Icons.ErrorWithColor");
+		FSlateNotificationManager::Get().AddNotification(Info);
+		return false;
+	}
+	
+	// Start transaction for undo/redo
+	FScopedTransaction Transaction(LOCTEXT("ApplyHdri", "Apply HDRI to Skylight"));
+	
+	int32 ComponentsModified = 0;
+	int32 BackdropsModified = 0;
+	
+	// Find Skylight Actors in the world
+	if (GEditor && GEditor->GetEditorWorldContext().World())
+	{
+		UWorld* World = GEditor->GetEditorWorldContext().World();
+		
+		// 1. Apply to Skylights
+		for (TActorIterator<ASkyLight> It(World); It; ++It)
+		{
+			ASkyLight* SkyLight = *It;
+			if (SkyLight && SkyLight->GetLightComponent())
+			{
+				USkyLightComponent* Component = SkyLight->GetLightComponent();
+				Component->Modify();
+				
+				if (HdriTexture)
+				{
+					Component->SourceType = SLS_SpecifiedCubemap;
+					Component->Cubemap = HdriTexture;
+				}
+				
+				// Recapture skylight
+				Component->SetCaptureIsDirty();
+				ComponentsModified++;
+			}
+		}
+
+		// 2. Apply to HDRI Backdrop actors
+		// Try to load the specific HDRIBackdrop class
+		UClass* BackdropClass = nullptr;
+		FSoftClassPath BackdropClassPath(TEXT("/HDRIBackdrop/Blueprints/HDRIBackdrop.HDRIBackdrop_C"));
+		BackdropClass = BackdropClassPath.TryLoadClass<AActor>();
+
+		if (BackdropClass)
+		{
+			for (TActorIterator<AActor> It(World, BackdropClass); It; ++It)
+			{
+				AActor* Actor = *It;
+				if (!Actor) continue;
+
+				// Check for Cubemap property
+				FProperty* Property = Actor->GetClass()->FindPropertyByName(FName("Cubemap"));
+				FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+				
+				if (ObjectProperty && ObjectProperty->PropertyClass && ObjectProperty->PropertyClass->IsChildOf(UTextureCube::StaticClass()))
+				{
+					Actor->Modify();
+					
+					if (HdriTexture)
+					{
+						ObjectProperty->SetObjectPropertyValue_InContainer(Actor, HdriTexture);
+					}
+					
+					// Notify of property change to trigger Construction Script
+					FPropertyChangedEvent PropertyEvent(Property, EPropertyChangeType::ValueSet);
+					Actor->PostEditChangeProperty(PropertyEvent);
+					
+					BackdropsModified++;
+				}
+			}
+		}
+		else
+		{
+			// Fallback: Iterate all actors if class not found (e.g. if path changed or user made a copy)
+			// but only check actors with "HDRI" in name to be slightly more efficient than checking everything
+			for (TActorIterator<AActor> It(World); It; ++It)
+			{
+				AActor* Actor = *It;
+				if (!Actor) continue;
+
+				if (Actor->GetName().Contains(TEXT("HDRI"), ESearchCase::IgnoreCase) || 
+					Actor->GetClass()->GetName().Contains(TEXT("HDRI"), ESearchCase::IgnoreCase))
+				{
+					FProperty* Property = Actor->GetClass()->FindPropertyByName(FName("Cubemap"));
+					FObjectProperty* ObjectProperty = CastField<FObjectProperty>(Property);
+					
+					if (ObjectProperty && ObjectProperty->PropertyClass && ObjectProperty->PropertyClass->IsChildOf(UTextureCube::StaticClass()))
+					{
+						Actor->Modify();
+						
+						if (HdriTexture)
+						{
+							ObjectProperty->SetObjectPropertyValue_InContainer(Actor, HdriTexture);
+						}
+						
+						FPropertyChangedEvent PropertyEvent(Property, EPropertyChangeType::ValueSet);
+						Actor->PostEditChangeProperty(PropertyEvent);
+						
+						BackdropsModified++;
+					}
+				}
+			}
+		}
+	}
+	
+	if (ComponentsModified > 0 || BackdropsModified > 0)
+	{
+		// Mark level as modified
+		if (GEditor && GEditor->GetEditorWorldContext().World())
+		{
+			GEditor->GetEditorWorldContext().World()->MarkPackageDirty();
+		}
+		
+		// Show success notification
+		FText Message;
+		if (ComponentsModified > 0 && BackdropsModified > 0)
+		{
+			Message = FText::Format(LOCTEXT("HdriAppliedBoth", "Applied HDRI '{0}' to {1} Skylight(s) and {2} Backdrop(s)"), 
+				FText::FromString(MaterialItem->GetDisplayName()), FText::AsNumber(ComponentsModified), FText::AsNumber(BackdropsModified));
+		}
+		else if (BackdropsModified > 0)
+		{
+			Message = FText::Format(LOCTEXT("HdriAppliedBackdrop", "Applied HDRI '{0}' to {1} Backdrop(s)"), 
+				FText::FromString(MaterialItem->GetDisplayName()), FText::AsNumber(BackdropsModified));
+		}
+		else
+		{
+			Message = FText::Format(LOCTEXT("HdriApplied", "Applied HDRI '{0}' to {1} Skylight(s)"), 
+				FText::FromString(MaterialItem->GetDisplayName()), FText::AsNumber(ComponentsModified));
+		}
+
+		FNotificationInfo Info(Message);
+		Info.ExpireDuration = 3.0f;
+		Info.bFireAndForget = true;
+		Info.Image = FAppStyle::GetBrush("Icons.SuccessWithColor");
+		FSlateNotificationManager::Get().AddNotification(Info);
+		return true;
+	}
+	
+	// Show warning notification
+	FNotificationInfo Info(LOCTEXT("NoTargetFound", "No Skylight or HDRI Backdrop found in the current level"));
+	Info.ExpireDuration = 3.0f;
+	Info.bFireAndForget = true;
+	Info.Image = FAppStyle::GetBrush("Icons.Warning");
+	FSlateNotificationManager::Get().AddNotification(Info);
+	return false;
+}
+
+void UHdriVaultManager::RegenerateMaterialThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, int32 ThumbnailSize)
+{
+	if (!MaterialItem.IsValid() || !ThumbnailManager.IsValid())
+	{
+		return;
+	}
+
+	RegenerateThumbnailForAsset(MaterialItem, MaterialItem->MaterialPtr.LoadSynchronous(), ThumbnailSize);
+}
+
+FHdriVaultOperationRef UHdriVaultManager::RegenerateMaterialThumbnailAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, int32 ThumbnailSize)
+{
+	FHdriVaultOperationRef Operation = BeginOperation();
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
+	LoadAssetForOperation(Operation, MaterialItem, EHdriVaultWorkPriority::Visible, [WeakThis, MaterialItem, ThumbnailSize](UObject* Asset)
+	{
+		return WeakThis.IsValid() && WeakThis->RegenerateThumbnailForAsset(MaterialItem, Asset, ThumbnailSize);
+	});
+	return Operation;
+}
+
+bool UHdriVaultManager::RegenerateThumbnailForAsset(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, UObject* Asset, int32 ThumbnailSize)
+{
+	if (!Asset || !ThumbnailManager.IsValid())
+	{
+		return false;
+	}
+
+	const FString MaterialPath = MaterialItem->GetObjectPath().ToString();
+	ThumbnailManager->ClearThumbnailForMaterial(MaterialPath);
+
+	UTexture2D* GeneratedThumbnail = ThumbnailManager->GenerateMaterialThumbnail(Asset, ThumbnailSize, true);
+	if (!GeneratedThumbnail)
+	{
+		return false;
+	}
+
+	ThumbnailManager->UpdateCacheWithThumbnail(MaterialPath, GeneratedThumbnail, ThumbnailSize);
+	QueueItemChanged(MaterialItem->Handle, EHdriVaultItemChange::Thumbnail);
+	BroadcastPendingChanges();
+	return true;
+}
+
+UTexture2D* UHdriVaultManager::ImportCustomThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, const FString& SourceFile, int32 ThumbnailSize)
+{
+	if (!MaterialItem.IsValid() || !ThumbnailManager.IsValid() || SourceFile.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	UObject* Asset = MaterialItem->MaterialPtr.LoadSynchronous();
+	if (!Asset)
+	{
+		return nullptr;
+	}
+
+	if (UTexture2D* ImportedThumbnail = ThumbnailManager->ImportThumbnailFromImage(Asset, SourceFile, ThumbnailSize))
+	{
+		const FString MaterialPath = MaterialItem->GetObjectPath().ToString();
+		ThumbnailManager->UpdateCacheWithThumbnail(MaterialPath, ImportedThumbnail, ThumbnailSize);
+		QueueItemChanged(MaterialItem->Handle, EHdriVaultItemChange::Thumbnail);
+		BroadcastPendingChanges();
+		return ImportedThumbnail;
+	}
+
+	return nullptr;
+}
+
+void UHdriVaultManager::SaveMaterialMetadata(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	if (!MaterialItem.IsValid())
+	{
+		return;
+	}
+	
+	if (Catalog.IsValid() && Catalog->IsValid(MaterialItem->Handle) && Catalog->GetItem(MaterialItem->Handle) == MaterialItem)
+	{
+		SaveMaterialMetadata(TArray<FHdriVaultItemHandle>{ MaterialItem->Handle });
+	}
+	else if (MetadataWriter.IsValid())
+	{
+		// Items outside the catalog only need their file written
+		MetadataWriter->Enqueue(GetMetadataFilePath(MaterialItem->GetObjectPath()), MaterialItem->Metadata);
+	}
+}
+
+void UHdriVaultManager::SaveMaterialMetadata(const TArray<FHdriVaultItemHandle>& Handles)
+{
+	for (FHdriVaultItemHandle Handle : Handles)
+	{
+		if (!Catalog.IsValid() || !Catalog->IsValid(Handle))
+		{
+			continue;
+		}
+		
+		const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem = Catalog->GetItem(Handle);
+		QueueItemChanged(Handle, EHdriVaultItemChange::Metadata | ReindexMaterial(MaterialItem));
+		
+		// Queue the write; repeated edits to the same asset are merged and flushed in the background
+		if (MetadataWriter.IsValid())
+		{
+			MetadataWriter->Enqueue(GetMetadataFilePath(Catalog->GetObjectPath(Handle)), MaterialItem->Metadata);
+		}
+	}
+	
+	PublishSnapshot();
+	BroadcastPendingChanges();
+}
+
+void UHdriVaultManager::LoadMaterialMetadata(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+{
+	if (!MaterialItem.IsValid())
+	{
+		return;
+	}
+	
+	// Catalogued items already hold their latest metadata
+	if (Catalog.IsValid() && Catalog->IsValid(MaterialItem->Handle) && Catalog->GetItem(MaterialItem->Handle) == MaterialItem)
+	{
+		return;
+	}
+	
+	// Writes that are still queued are newer than the file on disk
+	FString MetadataPath = GetMetadataFilePath(MaterialItem->GetObjectPath());
+	if (MetadataWriter.IsValid() && MetadataWriter->FindPending(MetadataPath, MaterialItem->Metadata))
+	{
+		return;
+	}
+	
+	// Load from file
+	FString FileContents;
+	HdriVaultMetadataUtils::ReadMetadataFile(MetadataPath, FileContents, MaterialItem->Metadata);
+}
+
+void UHdriVaultManager::CancelQueuedWork()
+{
+	// The scheduler also carries import steps, so it is left running; the view-driven work queued on it
+	// turns into no-ops once its pass, thumbnails or operations below are cancelled
+	
+	// The reconcile pass restarts from scratch after the next interval
+	if (RefreshScheduler.IsValid())
+	{
+		RefreshScheduler->CancelPass();
+	}
+	ReconcilePass.Reset();
+	
+	if (ThumbnailManager.IsValid())
+	{
+		ThumbnailManager->CancelPendingThumbnails();
+	}
+	
+	// Imports are not tracked here; they keep running until cancelled from their notification or shutdown
+	CancelActiveOperations();
+}
+
+FHdriVaultOperationRef UHdriVaultManager::BeginOperation()
+{
+	ActiveOperations.RemoveAllSwap([](const TWeakPtr<FHdriVaultOperation, ESPMode::ThreadSafe>& Operation)
+	{
+		const TSharedPtr<FHdriVaultOperation, ESPMode::ThreadSafe> Pinned = Operation.Pin();
+		return !Pinned.IsValid() || Pinned->IsComplete();
+	});
+	
+	FHdriVaultOperationRef Operation = MakeShared<FHdriVaultOperation, ESPMode::ThreadSafe>();
+	ActiveOperations.Add(Operation);
+	return Operation;
+}
+
+void UHdriVaultManager::CancelActiveOperations()
+{
+	TArray<TWeakPtr<FHdriVaultOperation, ESPMode::ThreadSafe>> Operations = MoveTemp(ActiveOperations);
+	for (const TWeakPtr<FHdriVaultOperation, ESPMode::ThreadSafe>& Operation : Operations)
+	{
+		if (const TSharedPtr<FHdriVaultOperation, ESPMode::ThreadSafe> Pinned = Operation.Pin())
+		{
+			Pinned->Cancel();
+			Pinned->Complete(EHdriVaultOperationResult::Cancelled);
+		}
+	}
+}
+
+void UHdriVaultManager::LoadAssetForOperation(const FHdriVaultOperationRef& Operation, const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem,
+	EHdriVaultWorkPriority Priority, TFunction<bool(UObject*)>&& OnLoaded)
+{
+	if (!bIsInitialized || !MaterialItem.IsValid())
+	{
+		Operation->Complete(EHdriVaultOperationResult::Failed);
+		return;
+	}
+	
+	Operation->SetProgress(0.0f, FText::Format(LOCTEXT("OperationLoading", "Loading {0}"), FText::FromString(MaterialItem->GetDisplayName())));
+	
+	// The loaded asset is handled as scheduled work rather than straight from the loader callback
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
+	MaterialItem->MaterialPtr.ToSoftObjectPath().LoadAsync(FLoadSoftObjectPathAsyncDelegate::CreateLambda(
+		[WeakThis, Operation, Priority, OnLoaded = MoveTemp(OnLoaded)](const FSoftObjectPath&, UObject* LoadedAsset)
+		{
+			UHdriVaultManager* This = WeakThis.Get();
+			if (!This || !This->WorkScheduler.IsValid() || Operation->IsComplete())
+			{
+				return;
+			}
+			
+			Operation->SetProgress(0.5f);
+			TWeakObjectPtr<UObject> WeakAsset(LoadedAsset);
+			This->WorkScheduler->Enqueue(Priority, [Operation, OnLoaded, WeakAsset]()
+			{
+				if (Operation->IsComplete())
+				{
+					return;
+				}
+				
+				if (Operation->IsCancelRequested())
+				{
+					Operation->Complete(EHdriVaultOperationResult::Cancelled);
+					return;
+				}
+				
+				const bool bSucceeded = OnLoaded(WeakAsset.Get());
+				Operation->Complete(bSucceeded ? EHdriVaultOperationResult::Succeeded : EHdriVaultOperationResult::Failed);
+			});
+		}));
+}
+
+void UHdriVaultManager::StepReconcileAsync(const FHdriVaultOperationRef& Operation, const TSharedRef<FHdriVaultReconcilePass>& Pass)
+{
+	// One slice per queued item, within the frame budget, until the pass is done
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
+	WorkScheduler->Enqueue(EHdriVaultWorkPriority::Visible, [WeakThis, Operation, Pass]()
+	{
+		UHdriVaultManager* This = WeakThis.Get();
+		if (!This || !This->bIsInitialized || Operation->IsComplete())
+		{
+			return;
+		}
+		
+		if (Operation->IsCancelRequested())
+		{
+			This->PublishPendingChanges();
+			Operation->Complete(EHdriVaultOperationResult::Cancelled);
+			return;
+		}
+		
+		if (This->StepReconcile(*Pass, This->WorkScheduler->GetFrameDeadline()))
+		{
+			Operation->Complete(EHdriVaultOperationResult::Succeeded);
+			return;
+		}
+		
+		Operation->SetProgress(Pass->GetProgress(), LOCTEXT("RefreshReconciling", "Checking for changes"));
+		This->StepReconcileAsync(Operation, Pass);
+	});
+}
+
+void UHdriVaultManager::SetSettings(const FHdriVaultSettings& NewSettings)
+{
+	const bool bScanScopeChanged = Settings.RootFolder != NewSettings.RootFolder
+		|| Settings.ScanIncludePaths != NewSettings.ScanIncludePaths
+		|| Settings.ScanExcludePaths != NewSettings.ScanExcludePaths;
+	
+	Settings = NewSettings;
+	OnSettingsChanged.Broadcast(Settings);
+	
+	if (RefreshScheduler.IsValid())
+	{
+		RefreshScheduler->SetAutoRefresh(Settings.bAutoRefresh, Settings.RefreshInterval);
+	}
+	
+	// Items that left the scope are dropped and newly covered ones ingested
+	if (bScanScopeChanged)
+	{
+		UpdateScanScope();
+		RefreshMaterialDatabase();
+	}
+}
+
+void UHdriVaultManager::UpdateScanScope()
+{
+	// Normalized to "/Mount/Path" with no trailing slash so prefix checks stop at folder boundaries.
+	// Returns false if the list names the registry root.
+	auto NormalizePaths = [](const TArray<FString>& InPaths, TArray<FString>& OutPaths)
+	{
+		OutPaths.Reset();
+		for (FString Path : InPaths)
+		{
+			Path.TrimStartAndEndInline();
+			if (Path.IsEmpty())
+			{
+				continue;
+			}
+			
+			while (Path.RemoveFromEnd(TEXT("/")))
+			{
+			}
+			
+			if (Path.IsEmpty())
+			{
+				return false;
+			}
+			
+			if (!Path.StartsWith(TEXT("/")))
+			{
+				Path.InsertAt(0, TEXT('/'));
+			}
+			OutPaths.AddUnique(Path);
+		}
+		return true;
+	};
+	
+	const TArray<FString> IncludePaths = Settings.ScanIncludePaths.Num() > 0 ? Settings.ScanIncludePaths : TArray<FString>{ Settings.RootFolder };
+	if (!NormalizePaths(IncludePaths, ScanIncludePaths))
+	{
+		ScanIncludePaths.Reset();
+	}
+	
+	NormalizePaths(Settings.ScanExcludePaths, ScanExcludePaths);
+}
+
+bool UHdriVaultManager::IsInScanScope(const FAssetData& AssetData) const
+{
+	return IsPathInScanScope(AssetData.PackagePath.ToString());
+}
+
+bool UHdriVaultManager::IsPathInScanScope(const FString& PackagePath) const
+{
+	auto IsUnder = [&PackagePath](const FString& ScopePath)
+	{
+		return PackagePath.StartsWith(ScopePath) && (PackagePath.Len() == ScopePath.Len() || PackagePath[ScopePath.Len()] == TEXT('/'));
+	};
+	
+	if (ScanIncludePaths.Num() > 0 && !ScanIncludePaths.ContainsByPredicate(IsUnder))
+	{
+		return false;
+	}
+	
+	return !ScanExcludePaths.ContainsByPredicate(IsUnder);
+}
+
+void UHdriVaultManager::SearchMaterials(const FString& SearchTerm, TArray<FHdriVaultItemHandle>& OutHandles) const
+{
+	OutHandles.Reset();
+	if (SearchTerm.IsEmpty())
+	{
+		return;
+	}
+	
+	ExecuteQuery(FHdriVaultQuery::Parse(SearchTerm), OutHandles);
+	SortMaterials(OutHandles);
+}
+
+void UHdriVaultManager::SearchMaterialHandles(const FString& SearchTerm, TSet<FHdriVaultItemHandle>& OutHandles) const
+{
+	if (SearchTerm.IsEmpty())
+	{
+		return;
+	}
+	
+	TArray<FHdriVaultItemHandle> MatchingHandles;
+	ExecuteQuery(FHdriVaultQuery::Parse(SearchTerm), MatchingHandles);
+	OutHandles.Append(MatchingHandles);
+}
+
+bool UHdriVaultManager::GetSearchCandidates(const FString& SearchTerm, TArray<FHdriVaultItemHandle>& OutHandles) const
+{
+	OutHandles.Reset();
+	if (!Catalog.IsValid())
+	{
+		return false;
+	}
+	
+	bool bSeedIsExact = false;
+	return SeedQueryCandidates(FHdriVaultQuery::Parse(SearchTerm), OutHandles, bSeedIsExact) != INDEX_NONE;
+}
+
+void UHdriVaultManager::ExecuteQuery(const FHdriVaultQuery& Query, TArray<FHdriVaultItemHandle>& OutHandles) const
+{
+	for (const FString& Warning : Query.GetWarnings())
+	{
+		UE_LOG(LogHdriVault, Verbose, TEXT("HdriVault: %s"), *Warning);
+	}
+	
+	if (!Catalog.IsValid())
+	{
+		return;
+	}
+	
+	const FHdriVaultCatalog& Items = *Catalog;
+	const TArray<FHdriVaultQueryTerm>& Terms = Query.GetTerms();
+	
+	TArray<FHdriVaultItemHandle> Candidates;
+	bool bSeedIsExact = false;
+	const int32 SeedTerm = SeedQueryCandidates(Query, Candidates, bSeedIsExact);
+	if (SeedTerm == INDEX_NONE)
+	{
+		Items.GetHandles(Candidates);
+	}
+	else if (Candidates.Num() == 0)
+	{
+		return;
+	}
+	
+	// Compile the remaining terms into predicates over catalog columns
+	TArray<TFunction<bool(FHdriVaultItemHandle)>> Predicates;
+	for (int32 TermIndex = 0; TermIndex < Terms.Num(); ++TermIndex)
+	{
+		const FHdriVaultQueryTerm& Term = Terms[TermIndex];
+		if (TermIndex == SeedTerm && bSeedIsExact)
+		{
+			continue;
+		}
+		
+		TFunction<bool(FHdriVaultItemHandle)> Predicate;
+		switch (Term.Field)
+		{
+		case EHdriVaultQueryField::Text:
+			{
+				TArray<FHdriVaultItemHandle> TextMatches;
+				if (SearchIndex.IsValid())
+				{
+					SearchIndex->Search(Term.Value, TextMatches);
+				}
+				Predicate = [TextSet = TSet<FHdriVaultItemHandle>(MoveTemp(TextMatches))](FHdriVaultItemHandle Handle)
+				{
+					return TextSet.Contains(Handle);
+				};
+			}
+			break;
+		case EHdriVaultQueryField::Tag:
+			Predicate = [&Items, TagBit = Items.FindTagBit(Term.Value)](FHdriVaultItemHandle Handle) { return Items.HasTag(Handle, TagBit); };
+			break;
+		case EHdriVaultQueryField::Author:
+			Predicate = [&Items, &Term](FHdriVaultItemHandle Handle) { return Items.GetItem(Handle)->Metadata.Author.Contains(Term.Value); };
+			break;
+		case EHdriVaultQueryField::Category:
+			Predicate = [&Items, &Term](FHdriVaultItemHandle Handle) { return Items.GetItem(Handle)->Metadata.Category.Contains(Term.Value); };
+			break;
+		case EHdriVaultQueryField::Resolution:
+			Predicate = [&Items, &Term](FHdriVaultItemHandle Handle) { return Term.MatchesNumber(Items.GetMaxDimension(Handle)); };
+			break;
+		case EHdriVaultQueryField::Exposure:
+			// Dropped with a warning when parsed
+			continue;
+		}
+		
+		if (Term.bNegated)
+		{
+			Predicate = [Inner = MoveTemp(Predicate)](FHdriVaultItemHandle Handle) { return !Inner(Handle); };
+		}
+		Predicates.Add(MoveTemp(Predicate));
+	}
+	
+	OutHandles.Reserve(OutHandles.Num() + Candidates.Num());
+	for (FHdriVaultItemHandle Handle : Candidates)
+	{
+		if (!Items.IsValid(Handle))
+		{
+			continue;
+		}
+		
+		bool bPasses = true;
+		for (const TFunction<bool(FHdriVaultItemHandle)>& Predicate : Predicates)
+		{
+			if (!Predicate(Handle))
+			{
+				bPasses = false;
+				break;
+			}
+		}
+		
+		if (bPasses)
+		{
+			OutHandles.Add(Handle);
+		}
+	}
+}
+
+int32 UHdriVaultManager::SeedQueryCandidates(const FHdriVaultQuery& Query, TArray<FHdriVaultItemHandle>& OutCandidates, bool& bOutSeedIsExact) const
+{
+	OutCandidates.Reset();
+	bOutSeedIsExact = false;
+	
+	const FHdriVaultCatalog& Items = *Catalog;
+	const TArray<FHdriVaultQueryTerm>& Terms = Query.GetTerms();
+	
+	// Plan: seed candidates from the most selective indexed term, then check the rest per item
+	int32 SeedTerm = INDEX_NONE;
+	int32 SeedEstimate = MAX_int32;
+	for (int32 TermIndex = 0; TermIndex < Terms.Num(); ++TermIndex)
+	{
+		const FHdriVaultQueryTerm& Term = Terms[TermIndex];
+		if (Term.bNegated)
+		{
+			continue;
+		}
+		
+		int32 Estimate = MAX_int32;
+		switch (Term.Field)
+		{
+		case EHdriVaultQueryField::Tag:
+			{
+				const TSet<FHdriVaultItemHandle>* TaggedHandles = TagIndex.Find(Term.Value);
+				Estimate = TaggedHandles ? TaggedHandles->Num() : 0;
+			}
+			break;
+		case EHdriVaultQueryField::Resolution:
+			{
+				int32 Begin = 0;
+				int32 End = 0;
+				GetResolutionRange(Term, Begin, End);
+				Estimate = End - Begin;
+			}
+			break;
+		case EHdriVaultQueryField::Text:
+		case EHdriVaultQueryField::Author:
+		case EHdriVaultQueryField::Category:
+			// Cheap to resolve through the text index, but the size is unknown up front
+			Estimate = SearchIndex.IsValid() ? Items.Num() : MAX_int32;
+			break;
+		default:
+			break;
+		}
+		
+		if (Estimate < SeedEstimate)
+		{
+			SeedTerm = TermIndex;
+			SeedEstimate = Estimate;
 		}
-
-		FNotificationInfo Info(Message);
-		Info.ExpireDuration = 3.0f;
-		Info.bFireAndForget = true;
-		Info.Image = FAppStyle::GetBrush("Icons.SuccessWithColor");
-		FSlateNotificationManager::Get().AddNotification(Info);
 	}
-	else
+	
+	if (SeedTerm == INDEX_NONE || SeedEstimate == 0)
 	{
-		// Show warning notification
-		FNotificationInfo Info(LOCTEXT("NoTargetFound", "No Skylight or HDRI Backdrop found in the current level"));
-		Info.ExpireDuration = 3.0f;
-		Info.bFireAndForget = true;
-		Info.Image = FAppStyle::GetBrush("Icons.Warning");
-		FSlateNotificationManager::Get().AddNotification(Info);
+		return SeedTerm;
+	}
+	
+	// Candidates from the seed; Tag, Resolution and Text seeds are exact, the others need checking
+	const FHdriVaultQueryTerm& Seed = Terms[SeedTerm];
+	switch (Seed.Field)
+	{
+	case EHdriVaultQueryField::Tag:
+		OutCandidates = TagIndex.FindChecked(Seed.Value).Array();
+		bOutSeedIsExact = true;
+		break;
+	case EHdriVaultQueryField::Resolution:
+		{
+			int32 Begin = 0;
+			int32 End = 0;
+			GetResolutionRange(Seed, Begin, End);
+			OutCandidates.Reserve(End - Begin);
+			for (int32 Index = Begin; Index < End; ++Index)
+			{
+				OutCandidates.Add(ResolutionIndex[Index].Value);
+			}
+			bOutSeedIsExact = true;
+		}
+		break;
+	default:
+		SearchIndex->Search(Seed.Value, OutCandidates);
+		bOutSeedIsExact = Seed.Field == EHdriVaultQueryField::Text;
+		break;
 	}
+	return SeedTerm;
 }
 
-void UHdriVaultManager::RegenerateMaterialThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, int32 ThumbnailSize)
+void UHdriVaultManager::GetResolutionRange(const FHdriVaultQueryTerm& Term, int32& OutBegin, int32& OutEnd) const
 {
-	if (!MaterialItem.IsValid() || !ThumbnailManager.IsValid())
+	if (bResolutionIndexDirty)
 	{
-		return;
+		ResolutionIndex.Reset(Catalog->Num());
+		Catalog->ForEach([this](FHdriVaultItemHandle Handle)
+		{
+			ResolutionIndex.Emplace(Catalog->GetMaxDimension(Handle), Handle);
+		});
+		ResolutionIndex.Sort([](const TPair<int32, FHdriVaultItemHandle>& A, const TPair<int32, FHdriVaultItemHandle>& B) { return A.Key < B.Key; });
+		bResolutionIndexDirty = false;
 	}
-
-	UObject* Asset = MaterialItem->MaterialPtr.LoadSynchronous();
-	if (!Asset)
+	
+	auto GetResolution = [](const TPair<int32, FHdriVaultItemHandle>& Entry) { return double(Entry.Key); };
+	const int32 Lower = Algo::LowerBoundBy(ResolutionIndex, Term.Number, GetResolution);
+	const int32 Upper = Algo::UpperBoundBy(ResolutionIndex, Term.Number, GetResolution);
+	
+	switch (Term.Op)
 	{
-		return;
+	case EHdriVaultQueryOp::Less:
+		OutBegin = 0;
+		OutEnd = Lower;
+		break;
+	case EHdriVaultQueryOp::LessEqual:
+		OutBegin = 0;
+		OutEnd = Upper;
+		break;
+	case EHdriVaultQueryOp::Greater:
+		OutBegin = Upper;
+		OutEnd = ResolutionIndex.Num();
+		break;
+	case EHdriVaultQueryOp::GreaterEqual:
+		OutBegin = Lower;
+		OutEnd = ResolutionIndex.Num();
+		break;
+	default:
+		OutBegin = Lower;
+		OutEnd = Upper;
+		break;
 	}
+}
 
-	const FString MaterialPath = MaterialItem->AssetData.GetObjectPathString();
-	ThumbnailManager->ClearThumbnailForMaterial(MaterialPath);
-
-	if (UTexture2D* GeneratedThumbnail = ThumbnailManager->GenerateMaterialThumbnail(Asset, ThumbnailSize, true))
+void UHdriVaultManager::FilterMaterialsByTag(const FString& Tag, TArray<FHdriVaultItemHandle>& OutHandles) const
+{
+	OutHandles.Reset();
+	if (const TSet<FHdriVaultItemHandle>* TaggedHandles = TagIndex.Find(Tag))
 	{
-		ThumbnailManager->UpdateCacheWithThumbnail(MaterialPath, GeneratedThumbnail, ThumbnailSize);
-		OnRefreshRequested.Broadcast();
+		OutHandles = TaggedHandles->Array();
+		SortMaterials(OutHandles);
 	}
 }
 
-UTexture2D* UHdriVaultManager::ImportCustomThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, const FString& SourceFile, int32 ThumbnailSize)
+TArray<FString> UHdriVaultManager::GetAllTags() const
 {
-	if (!MaterialItem.IsValid() || !ThumbnailManager.IsValid() || SourceFile.IsEmpty())
-	{
-		return nullptr;
-	}
+	TArray<FString> Tags;
+	TagIndex.GetKeys(Tags);
+	return Tags;
+}
 
-	UObject* Asset = MaterialItem->MaterialPtr.LoadSynchronous();
-	if (!Asset)
+int32 UHdriVaultManager::GetTagCount(const FString& Tag) const
+{
+	const TSet<FHdriVaultItemHandle>* TaggedHandles = TagIndex.Find(Tag);
+	return TaggedHandles ? TaggedHandles->Num() : 0;
+}
+
+void UHdriVaultManager::AddTagsToIndex(FHdriVaultItemHandle Handle, const TArray<FString>& Tags)
+{
+	for (const FString& Tag : Tags)
 	{
-		return nullptr;
+		if (!Tag.IsEmpty())
+		{
+			TagIndex.FindOrAdd(Tag).Add(Handle);
+		}
 	}
+}
 
-	if (UTexture2D* ImportedThumbnail = ThumbnailManager->ImportThumbnailFromImage(Asset, SourceFile, ThumbnailSize))
+void UHdriVaultManager::RemoveTagsFromIndex(FHdriVaultItemHandle Handle, const TArray<FString>& Tags)
+{
+	for (const FString& Tag : Tags)
 	{
-		const FString MaterialPath = MaterialItem->AssetData.GetObjectPathString();
-		ThumbnailManager->UpdateCacheWithThumbnail(MaterialPath, ImportedThumbnail, ThumbnailSize);
-		OnRefreshRequested.Broadcast();
-		return ImportedThumbnail;
+		if (TSet<FHdriVaultItemHandle>* TaggedHandles = TagIndex.Find(Tag))
+		{
+			TaggedHandles->Remove(Handle);
+			if (TaggedHandles->Num() == 0)
+			{
+				// Drop tags nobody uses anymore so the Tags panel stays live
+				TagIndex.Remove(Tag);
+			}
+		}
 	}
-
-	return nullptr;
 }
 
-void UHdriVaultManager::SaveMaterialMetadata(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
+EHdriVaultItemChange UHdriVaultManager::ReindexMaterial(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem)
 {
-	if (!MaterialItem.IsValid())
+	const FHdriVaultItemHandle Handle = MaterialItem->Handle;
+	if (!Catalog.IsValid() || !Catalog->IsValid(Handle) || Catalog->GetItem(Handle) != MaterialItem)
 	{
-		return;
+		return EHdriVaultItemChange::None;
 	}
 	
-	// Update cache
-	MetadataCache.Add(MaterialItem->AssetData.GetObjectPathString(), MaterialItem->Metadata);
-	
-	// Save to file
-	FString MetadataPath = GetMetadataFilePath(MaterialItem->AssetData);
+	// The catalog still holds the tags and category from the last indexing, so diff against them
+	TArray<FString> PreviousTags;
+	Catalog->GetTags(Handle, PreviousTags);
+	RemoveTagsFromIndex(Handle, PreviousTags);
+	const FString PreviousCategoryKey = Catalog->GetCategoryKey(Handle);
 	
-	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-	JsonObject->SetStringField(TEXT("MaterialName"), MaterialItem->Metadata.MaterialName);
-	JsonObject->SetStringField(TEXT("Location"), MaterialItem->Metadata.Location);
-	JsonObject->SetStringField(TEXT("Author"), MaterialItem->Metadata.Author);
-	JsonObject->SetStringField(TEXT("LastModified"), MaterialItem->Metadata.LastModified.ToString());
-	JsonObject->SetStringField(TEXT("Notes"), MaterialItem->Metadata.Notes);
-	JsonObject->SetStringField(TEXT("Category"), MaterialItem->Metadata.Category);
-	JsonObject->SetStringField(TEXT("CustomThumbnailPath"), MaterialItem->Metadata.CustomThumbnailPath);
+	Catalog->UpdateColumns(Handle);
 	
-	TArray<TSharedPtr<FJsonValue>> TagsArray;
-	for (const FString& Tag : MaterialItem->Metadata.Tags)
+	EHdriVaultItemChange Change = EHdriVaultItemChange::None;
+	if (!Catalog->GetCategoryKey(Handle).Equals(PreviousCategoryKey))
 	{
-		TagsArray.Add(MakeShareable(new FJsonValueString(Tag)));
+		Change |= EHdriVaultItemChange::Category;
 	}
-	JsonObject->SetArrayField(TEXT("Tags"), TagsArray);
 	
-	FString OutputString;
-	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-	
-	FFileHelper::SaveStringToFile(OutputString, *MetadataPath);
-}
-
-void UHdriVaultManager::LoadMaterialMetadata(TSharedPtr<FHdriVaultMaterialItem> MaterialItem)
-{
-	if (!MaterialItem.IsValid())
+	TArray<FString> CurrentTags;
+	Catalog->GetTags(Handle, CurrentTags);
+	if (CurrentTags.Num() != PreviousTags.Num() || CurrentTags.ContainsByPredicate([&PreviousTags](const FString& Tag) { return !PreviousTags.Contains(Tag); }))
 	{
-		return;
+		Change |= EHdriVaultItemChange::Tags;
 	}
 	
-	// Check cache first
-	FString ObjectPath = MaterialItem->AssetData.GetObjectPathString();
-	if (MetadataCache.Contains(ObjectPath))
-	{
-		MaterialItem->Metadata = MetadataCache[ObjectPath];
-		return;
-	}
+	AddTagsToIndex(Handle, MaterialItem->Metadata.Tags);
+	SearchIndex->IndexItem(Handle, *MaterialItem);
+	bResolutionIndexDirty = true;
 	
-	// Load from file
-	FString MetadataPath = GetMetadataFilePath(MaterialItem->AssetData);
+	// Sort keys may have changed
+	InvalidateFolderViews(FindFolder(OrganizePackagePath(Catalog->GetPackagePath(Handle).ToString())));
 	
-	FString FileContents;
-	if (FFileHelper::LoadFileToString(FileContents, *MetadataPath))
-	{
-		TSharedPtr<FJsonObject> JsonObject;
-		TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(FileContents);
-		
-		if (FJsonSerializer::Deserialize(Reader, JsonObject) && JsonObject.IsValid())
-		{
-			MaterialItem->Metadata.MaterialName = JsonObject->GetStringField(TEXT("MaterialName"));
-			MaterialItem->Metadata.Location = JsonObject->GetStringField(TEXT("Location"));
-			MaterialItem->Metadata.Author = JsonObject->GetStringField(TEXT("Author"));
-			MaterialItem->Metadata.Notes = JsonObject->GetStringField(TEXT("Notes"));
-			MaterialItem->Metadata.Category = JsonObject->GetStringField(TEXT("Category"));
-			
-			FString DateString = JsonObject->GetStringField(TEXT("LastModified"));
-			FDateTime::Parse(DateString, MaterialItem->Metadata.LastModified);
-			
-			const TArray<TSharedPtr<FJsonValue>>* TagsArray;
-			if (JsonObject->TryGetArrayField(TEXT("Tags"), TagsArray))
-			{
-				MaterialItem->Metadata.Tags.Empty();
-				for (const auto& TagValue : *TagsArray)
-				{
-					MaterialItem->Metadata.Tags.Add(TagValue->AsString());
-				}
-			}
+	return Change;
+}
 
-			if (JsonObject->HasTypedField<EJson::String>(TEXT("CustomThumbnailPath")))
-			{
-				MaterialItem->Metadata.CustomThumbnailPath = JsonObject->GetStringField(TEXT("CustomThumbnailPath"));
-			}
-			else
-			{
-				MaterialItem->Metadata.CustomThumbnailPath.Empty();
-			}
-			
-			// Cache the loaded metadata
-			MetadataCache.Add(ObjectPath, MaterialItem->Metadata);
-		}
+void UHdriVaultManager::OnAssetAdded(const FAssetData& AssetData)
+{
+	if (AssetData.AssetClassPath == UTextureCube::StaticClass()->GetClassPathName() && IsInScanScope(AssetData))
+	{
+		ProcessMaterialAsset(AssetData);
+		PublishSnapshot();
+		BroadcastPendingChanges();
 	}
 }
 
-void UHdriVaultManager::SetSettings(const FHdriVaultSettings& NewSettings)
+void UHdriVaultManager::OnAssetRemoved(const FAssetData& AssetData)
 {
-	Settings = NewSettings;
-	OnSettingsChanged.Broadcast(Settings);
+	RemoveMaterialAsset(AssetData.GetSoftObjectPath());
+	PublishSnapshot();
+	BroadcastPendingChanges();
 }
 
-TArray<TSharedPtr<FHdriVaultMaterialItem>> UHdriVaultManager::SearchMaterials(const FString& SearchTerm) const
+void UHdriVaultManager::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
 {
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> Results;
-	
-	if (SearchTerm.IsEmpty())
-	{
-		return Results;
-	}
+	RemoveMaterialAsset(FSoftObjectPath(OldObjectPath));
 	
-	FString LowerSearchTerm = SearchTerm.ToLower();
-	
-	for (const auto& MaterialPair : MaterialMap)
+	// A move can take an asset out of the scanned paths
+	if (AssetData.AssetClassPath == UTextureCube::StaticClass()->GetClassPathName() && IsInScanScope(AssetData))
 	{
-		const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem = MaterialPair.Value;
-		if (MaterialItem.IsValid())
-		{
-			FString MaterialName = MaterialItem->DisplayName.ToLower();
-			FString MaterialPath = MaterialItem->AssetData.PackagePath.ToString().ToLower();
-			
-			if (MaterialName.Contains(LowerSearchTerm) || MaterialPath.Contains(LowerSearchTerm))
-			{
-				Results.Add(MaterialItem);
-			}
-		}
+		ProcessMaterialAsset(AssetData);
 	}
-	
-	SortMaterials(Results);
-	return Results;
+	PublishSnapshot();
+	BroadcastPendingChanges();
 }
 
-TArray<TSharedPtr<FHdriVaultMaterialItem>> UHdriVaultManager::FilterMaterialsByTag(const FString& Tag) const
+void UHdriVaultManager::OnAssetUpdated(const FAssetData& AssetData)
 {
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> Results;
-	
-	for (const auto& MaterialPair : MaterialMap)
+	if (AssetData.AssetClassPath == UTextureCube::StaticClass()->GetClassPathName() && IsInScanScope(AssetData))
 	{
-		const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem = MaterialPair.Value;
-		if (MaterialItem.IsValid() && MaterialItem->Metadata.Tags.Contains(Tag))
-		{
-			Results.Add(MaterialItem);
-		}
+		ProcessMaterialAsset(AssetData);
+		PublishSnapshot();
+		BroadcastPendingChanges();
 	}
-	
-	SortMaterials(Results);
-	return Results;
 }
 
-void UHdriVaultManager::OnAssetAdded(const FAssetData& AssetData)
+void UHdriVaultManager::PublishSnapshot()
 {
-	if (AssetData.AssetClassPath == UTextureCube::StaticClass()->GetClassPathName())
+	if (!Catalog.IsValid())
 	{
-		ProcessMaterialAsset(AssetData);
-		BuildFolderStructure();
+		return;
 	}
+	
+	// Build outside the lock; readers only ever wait for the pointer swap
+	TSharedPtr<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> NewSnapshot = Catalog->BuildSnapshot(++SnapshotVersion);
+	
+	FWriteScopeLock Lock(SnapshotLock);
+	Swap(CurrentSnapshot, NewSnapshot);
 }
 
-void UHdriVaultManager::OnAssetRemoved(const FAssetData& AssetData)
+TSharedPtr<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> UHdriVaultManager::GetSnapshot() const
 {
-	RemoveMaterialAsset(AssetData);
-	BuildFolderStructure();
+	FReadScopeLock Lock(SnapshotLock);
+	return CurrentSnapshot;
 }
 
-void UHdriVaultManager::OnAssetRenamed(const FAssetData& AssetData, const FString& OldObjectPath)
+void UHdriVaultManager::QueueItemChanged(FHdriVaultItemHandle Handle, EHdriVaultItemChange Change)
 {
-	RemoveMaterialAsset(AssetData);
-	ProcessMaterialAsset(AssetData);
-	BuildFolderStructure();
+	if (Handle.IsValid() && Change != EHdriVaultItemChange::None)
+	{
+		PendingChangedItems.Emplace(Handle, Change);
+	}
 }
 
-void UHdriVaultManager::OnAssetUpdated(const FAssetData& AssetData)
+void UHdriVaultManager::BroadcastPendingChanges()
 {
-	if (AssetData.AssetClassPath == UTextureCube::StaticClass()->GetClassPathName())
+	// Take the queues first; handlers may edit items and queue more
+	TArray<FHdriVaultItemHandle> RemovedItems = MoveTemp(PendingRemovedItems);
+	TArray<FHdriVaultItemHandle> AddedItems = MoveTemp(PendingAddedItems);
+	TArray<TPair<FHdriVaultItemHandle, EHdriVaultItemChange>> ChangedItems = MoveTemp(PendingChangedItems);
+	
+	if (RemovedItems.Num() > 0)
 	{
-		ProcessMaterialAsset(AssetData);
+		OnItemsRemoved.Broadcast(RemovedItems);
+	}
+	
+	if (AddedItems.Num() > 0)
+	{
+		OnItemsAdded.Broadcast(AddedItems);
+	}
+	
+	// One notification per distinct set of changed fields
+	TMap<EHdriVaultItemChange, TArray<FHdriVaultItemHandle>> ItemsByChange;
+	for (const TPair<FHdriVaultItemHandle, EHdriVaultItemChange>& ChangedItem : ChangedItems)
+	{
+		ItemsByChange.FindOrAdd(ChangedItem.Value).AddUnique(ChangedItem.Key);
+	}
+	
+	for (const TPair<EHdriVaultItemChange, TArray<FHdriVaultItemHandle>>& Group : ItemsByChange)
+	{
+		OnItemsChanged.Broadcast(Group.Value, Group.Key);
 	}
 }
 
 void UHdriVaultManager::ProcessMaterialAsset(const FAssetData& AssetData)
 {
-	FString ObjectPath = AssetData.GetObjectPathString();
-	
-	// Create or update material item
-	TSharedPtr<FHdriVaultMaterialItem> MaterialItem = MaterialMap.FindRef(ObjectPath);
-	if (!MaterialItem.IsValid())
+	if (!Catalog.IsValid())
 	{
-		MaterialItem = MakeShared<FHdriVaultMaterialItem>(AssetData);
-		MaterialMap.Add(ObjectPath, MaterialItem);
+		return;
 	}
-	else
+	
+	// Update existing item
+	const FHdriVaultItemHandle ExistingHandle = Catalog->Find(AssetData.GetSoftObjectPath());
+	if (ExistingHandle.IsValid())
 	{
-		// Update existing item
-		MaterialItem->AssetData = AssetData;
+		const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem = Catalog->GetItem(ExistingHandle);
 		MaterialItem->MaterialPtr = AssetData.ToSoftObjectPath();
-		MaterialItem->DisplayName = AssetData.AssetName.ToString();
+		Catalog->UpdateAssetColumns(ExistingHandle, AssetData);
+		EHdriVaultItemChange Change = EHdriVaultItemChange::Asset | ReindexMaterial(MaterialItem);
+		
+		// A re-saved or re-imported package makes any cached thumbnail stale
+		const FIoHash PackageStamp = GetPackageStamp(AssetData);
+		if (PackageStamp != Catalog->GetPackageStamp(ExistingHandle))
+		{
+			Catalog->SetPackageStamp(ExistingHandle, PackageStamp);
+			if (ThumbnailManager.IsValid())
+			{
+				ThumbnailManager->ClearThumbnailForMaterial(AssetData.GetObjectPathString());
+			}
+			Change |= EHdriVaultItemChange::Thumbnail;
+		}
+		
+		QueueItemChanged(ExistingHandle, Change);
+		return;
 	}
 	
-	// Load metadata
+	// Create material item, loading metadata before it is published to the indexes
+	TSharedPtr<FHdriVaultMaterialItem> MaterialItem = MakeShared<FHdriVaultMaterialItem>(AssetData);
+	const FDateTime MetadataFileTime = IFileManager::Get().GetTimeStamp(*GetMetadataFilePath(AssetData.GetSoftObjectPath()));
 	LoadMaterialMetadata(MaterialItem);
+	AddMaterialItem(MaterialItem, AssetData, MetadataFileTime);
+	
+	if (RootFolderNode.IsValid())
+	{
+		AddMaterialToFolder(MaterialItem->Handle);
+	}
+	
+	PendingAddedItems.Add(MaterialItem->Handle);
 }
 
-void UHdriVaultManager::RemoveMaterialAsset(const FAssetData& AssetData)
+void UHdriVaultManager::RemoveMaterialAsset(const FSoftObjectPath& ObjectPath)
 {
-	FString ObjectPath = AssetData.GetObjectPathString();
-	MaterialMap.Remove(ObjectPath);
-	MetadataCache.Remove(ObjectPath);
+	if (!Catalog.IsValid())
+	{
+		return;
+	}
+	
+	const FHdriVaultItemHandle Handle = Catalog->Find(ObjectPath);
+	if (!Handle.IsValid())
+	{
+		return;
+	}
+	
+	TArray<FString> Tags;
+	Catalog->GetTags(Handle, Tags);
+	RemoveTagsFromIndex(Handle, Tags);
+	SearchIndex->RemoveItem(Handle);
+	RemoveMaterialFromFolder(Handle);
+	
+	// Listeners only compare the handle; it is not resolvable any more by the time they hear of it
+	Catalog->Remove(Handle);
+	PendingRemovedItems.Add(Handle);
+	bResolutionIndexDirty = true;
 }
 
 TSharedPtr<FHdriVaultFolderNode> UHdriVaultManager::CreateFolderNode(const FString& FolderPath)
@@ -775,46 +2224,37 @@ TSharedPtr<FHdriVaultFolderNode> UHdriVaultManager::GetOrCreateFolderNode(const
 		}
 	}
 	
+	if (!bRebuildingFolders)
+	{
+		OnFolderAdded.Broadcast(NewFolder);
+	}
+	
 	return NewFolder;
 }
 
-void UHdriVaultManager::SortMaterials(TArray<TSharedPtr<FHdriVaultMaterialItem>>& Materials) const
+void UHdriVaultManager::SortMaterials(TArray<FHdriVaultItemHandle>& Handles) const
 {
-	switch (Settings.SortMode)
+	if (!Catalog.IsValid())
 	{
-		case EHdriVaultSortMode::Name:
-			Materials.Sort([](const TSharedPtr<FHdriVaultMaterialItem>& A, const TSharedPtr<FHdriVaultMaterialItem>& B)
-			{
-				return A->DisplayName < B->DisplayName;
-			});
-			break;
-		case EHdriVaultSortMode::DateModified:
-			Materials.Sort([](const TSharedPtr<FHdriVaultMaterialItem>& A, const TSharedPtr<FHdriVaultMaterialItem>& B)
-			{
-				return A->Metadata.LastModified > B->Metadata.LastModified;
-			});
-			break;
-		case EHdriVaultSortMode::Type:
-			Materials.Sort([](const TSharedPtr<FHdriVaultMaterialItem>& A, const TSharedPtr<FHdriVaultMaterialItem>& B)
-			{
-				return A->AssetData.AssetClassPath.ToString() < B->AssetData.AssetClassPath.ToString();
-			});
-			break;
-		default:
-			break;
+		Handles.Reset();
+		return;
 	}
+	
+	// The catalog keeps every item in sort order, so views take their order from it instead of sorting
+	Handles.RemoveAll([this](FHdriVaultItemHandle Handle) { return !Catalog->IsValid(Handle); });
+	Catalog->SortHandles(Handles, Settings.SortMode, Settings.SecondarySortMode);
 }
 
-FString UHdriVaultManager::GetMetadataFilePath(const FAssetData& AssetData) const
+FString UHdriVaultManager::GetMetadataFilePath(const FSoftObjectPath& ObjectPath) const
 {
 	FString ProjectDir = FPaths::ProjectDir();
 	FString MetadataDir = FPaths::Combine(ProjectDir, TEXT("Saved"), TEXT("HdriVault"), TEXT("Metadata"));
 	
-	FString AssetPath = AssetData.PackageName.ToString();
+	FString AssetPath = ObjectPath.GetLongPackageName();
 	AssetPath.RemoveFromStart(TEXT("/Game/"));
 	AssetPath.ReplaceInline(TEXT("/"), TEXT("_"));
 	
-	FString MetadataFileName = FString::Printf(TEXT("%s_%s.json"), *AssetPath, *AssetData.AssetName.ToString());
+	FString MetadataFileName = FString::Printf(TEXT("%s_%s.json"), *AssetPath, *ObjectPath.GetAssetName());
 	
 	return FPaths::Combine(MetadataDir, MetadataFileName);
 }
@@ -872,7 +2312,7 @@ void UHdriVaultManager::ImportHdriFiles(const TArray<FString>& Files)
 {
 	if (Files.Num() == 0) return;
 
-	// Create and show dialog
+	// Create and show dialog; confirming it queues the import and the editor stays responsive
 	TSharedPtr<SWindow> ParentWindow = FSlateApplication::Get().GetActiveTopLevelWindow();
 	TSharedPtr<SWindow> ImportWindow = SNew(SWindow)
 		.Title(LOCTEXT("ImportHdriTitle", "Import HDRIs"))
@@ -881,137 +2321,129 @@ void UHdriVaultManager::ImportHdriFiles(const TArray<FString>& Files)
 		.SupportsMinimize(false)
 		.IsTopmostWindow(true);
 
-	TSharedPtr<SHdriVaultImportDialog> ImportDialog;
+	// Start reading the files while the user is still looking at the options
+	TSharedPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe> Prefetch;
+	if (FHdriVaultImportPrefetch::IsEnabled() && WorkScheduler.IsValid() && WorkerPool.IsValid())
+	{
+		Prefetch = MakeShared<FHdriVaultImportPrefetch, ESPMode::ThreadSafe>(Files);
+		Prefetch->Start(WorkScheduler.ToSharedRef(), WorkerPool.ToSharedRef());
+	}
+
+	TWeakObjectPtr<UHdriVaultManager> WeakThis(this);
 	ImportWindow->SetContent(
-		SAssignNew(ImportDialog, SHdriVaultImportDialog)
+		SNew(SHdriVaultImportDialog)
 		.Files(Files)
+		.Prefetch(Prefetch)
 		.ParentWindow(ImportWindow)
-	);
-
-	FSlateApplication::Get().AddModalWindow(ImportWindow.ToSharedRef(), ParentWindow);
-
-	if (ImportDialog->ShouldImport())
-	{
-		const FHdriVaultImportOptions& Options = ImportDialog->GetImportOptions();
-		
-		TArray<FString> FilesToImport;
-		int32 ConversionCount = 0;
-
-		// Pre-process files: Convert EXR to HDR
-		for (const FString& File : Files)
+		.OnImport_Lambda([WeakThis](const FHdriVaultImportOptions& Options)
 		{
-			FString Ext = FPaths::GetExtension(File).ToLower();
-			if (Ext == TEXT("exr"))
-			{
-				FString HdrFile = FPaths::ChangeExtension(File, TEXT("hdr"));
-				FString Error;
-
-				if (FHdriVaultImageUtils::ConvertExrToHdr(File, HdrFile, Error))
-				{
-					FilesToImport.Add(HdrFile);
-					ConversionCount++;
-				}
-				else
-				{
-					UE_LOG(LogTemp, Error, TEXT("HdriVault: Failed to convert %s: %s"), *File, *Error);
-					// Fallback to original file if conversion fails
-					FilesToImport.Add(File);
-				}
-			}
-			else
+			if (WeakThis.IsValid())
 			{
-				FilesToImport.Add(File);
+				WeakThis->ImportHdriFilesAsync(Options);
 			}
-		}
+		})
+	);
 
-		if (ConversionCount > 0)
-		{
-			FNotificationInfo Info(FText::Format(LOCTEXT("ConversionComplete", "Converted {0} EXR files to HDR"), FText::AsNumber(ConversionCount)));
-			Info.ExpireDuration = 3.0f;
-			FSlateNotificationManager::Get().AddNotification(Info);
-		}
-		
-		// Perform import using AssetTools
-		FAssetToolsModule& AssetToolsModule = FModuleManager::Get().LoadModuleChecked<FAssetToolsModule>("AssetTools");
-		
-		// Create a TextureFactory and set import options for HDRIs
-		UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
-		TextureFactory->HDRImportShouldBeLongLatCubeMap = EAppReturnType::YesAll; // Hint to import as cubemap
-		TextureFactory->AddToRoot(); // Prevent GC
+	if (ParentWindow.IsValid())
+	{
+		FSlateApplication::Get().AddWindowAsNativeChild(ImportWindow.ToSharedRef(), ParentWindow.ToSharedRef());
+	}
+	else
+	{
+		FSlateApplication::Get().AddWindow(ImportWindow.ToSharedRef());
+	}
+}
+
+FHdriVaultOperationRef UHdriVaultManager::ImportHdriFilesAsync(const FHdriVaultImportOptions& Options)
+{
+	// Not an active operation: imports outlive the vault tab, and the import queue cancels them on shutdown
+	FHdriVaultOperationRef Operation = MakeShared<FHdriVaultOperation, ESPMode::ThreadSafe>();
+	if (!bIsInitialized || !ImportQueue.IsValid())
+	{
+		Operation->Complete(EHdriVaultOperationResult::Failed);
+		return Operation;
+	}
+	
+	if (!IsPathInScanScope(Options.DestinationPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("HdriVault: %s is outside the vault's scan paths; imported HDRIs will not be listed"), *Options.DestinationPath);
+	}
+	
+	ImportQueue->Enqueue(Options, Operation);
+	return Operation;
+}
 
-		// Add automated import data to try and suppress dialogs
-		UAutomatedAssetImportData* ImportData = NewObject<UAutomatedAssetImportData>();
-		ImportData->bReplaceExisting = true;
-		TextureFactory->AutomatedImportData = ImportData;
+FHdriVaultImportFileResult UHdriVaultManager::ImportPreparedFile(const FString& File, const FHdriVaultImportOptions& Options)
+{
+	FHdriVaultImportFileResult Result;
+	
+	// Perform import using AssetTools
+	FAssetToolsModule& AssetToolsModule = FModuleManager::Get().LoadModuleChecked<FAssetToolsModule>("AssetTools");
+	
+	// Create a TextureFactory and set import options for HDRIs
+	UTextureFactory* TextureFactory = NewObject<UTextureFactory>();
+	TextureFactory->HDRImportShouldBeLongLatCubeMap = EAppReturnType::YesAll; // Hint to import as cubemap
+	TextureFactory->AddToRoot(); // Prevent GC
 
-		TArray<UObject*> ImportedAssets = AssetToolsModule.Get().ImportAssets(FilesToImport, Options.DestinationPath, TextureFactory);
+	// Add automated import data to try and suppress dialogs
+	UAutomatedAssetImportData* ImportData = NewObject<UAutomatedAssetImportData>();
+	ImportData->bReplaceExisting = true;
+	TextureFactory->AutomatedImportData = ImportData;
 
-		TextureFactory->RemoveFromRoot(); // Clean up factory
+	TArray<UObject*> ImportedAssets = AssetToolsModule.Get().ImportAssets({ File }, Options.DestinationPath, TextureFactory);
 
-		int32 CubemapCount = 0;
-		int32 Texture2DCount = 0;
+	TextureFactory->RemoveFromRoot(); // Clean up factory
 
-		if (ImportedAssets.Num() > 0)
+	// Apply metadata, saved and announced as one batch
+	TArray<FHdriVaultItemHandle> ImportedItems;
+	for (UObject* Asset : ImportedAssets)
+	{
+		if (UTextureCube* Texture = Cast<UTextureCube>(Asset))
 		{
-			// Ensure Asset Registry is up to date before we scan
-			if (AssetRegistryModule)
+			Result.NumCubemaps++;
+			
+			// Created assets normally reach the catalog through OnAssetAdded already
+			const FAssetData AssetData(Texture);
+			TSharedPtr<FHdriVaultMaterialItem> MaterialItem = GetMaterialByPath(Asset->GetPathName());
+			if (!MaterialItem.IsValid() && IsInScanScope(AssetData))
 			{
-				AssetRegistryModule->Get().ScanPathsSynchronous({ Options.DestinationPath }, true);
+				ProcessMaterialAsset(AssetData);
+				MaterialItem = GetMaterialByPath(Asset->GetPathName());
 			}
-
-			// Force refresh to ensure we have the new assets in our system
-			RefreshMaterialDatabase();
-
-			// Apply metadata
-			for (UObject* Asset : ImportedAssets)
+			
+			if (MaterialItem.IsValid())
 			{
-				if (UTextureCube* Texture = Cast<UTextureCube>(Asset))
-				{
-					CubemapCount++;
-					TSharedPtr<FHdriVaultMaterialItem> MaterialItem = GetMaterialByPath(Asset->GetPathName());
-					if (MaterialItem.IsValid())
-					{
-						// Apply common metadata
-						if (!Options.Category.IsEmpty()) MaterialItem->Metadata.Category = Options.Category;
-						if (!Options.Author.IsEmpty()) MaterialItem->Metadata.Author = Options.Author;
-						if (!Options.Notes.IsEmpty()) MaterialItem->Metadata.Notes = Options.Notes;
-						
-						// Merge tags
-						for (const FString& Tag : Options.Tags)
-						{
-							MaterialItem->Metadata.Tags.AddUnique(Tag);
-						}
-
-						SaveMaterialMetadata(MaterialItem);
-					}
-				}
-				else if (Asset->IsA(UTexture2D::StaticClass()))
+				// Apply common metadata
+				if (!Options.Category.IsEmpty()) MaterialItem->Metadata.Category = Options.Category;
+				if (!Options.Author.IsEmpty()) MaterialItem->Metadata.Author = Options.Author;
+				if (!Options.Notes.IsEmpty()) MaterialItem->Metadata.Notes = Options.Notes;
+				
+				// The cube only keeps its face size, so remember the long-lat resolution for res: queries
+				MaterialItem->Metadata.SourceWidth = Texture->Source.GetSizeX();
+				MaterialItem->Metadata.SourceHeight = Texture->Source.GetSizeY();
+				
+				// Merge tags
+				for (const FString& Tag : Options.Tags)
 				{
-					Texture2DCount++;
+					MaterialItem->Metadata.Tags.AddUnique(Tag);
 				}
-			}
 
-			// Final refresh to show metadata
-			RefreshMaterialDatabase();
-			
-			FNotificationInfo Info(FText::Format(LOCTEXT("ImportSuccess", "Successfully imported {0} HDRIs"), FText::AsNumber(CubemapCount)));
-			
-			if (Texture2DCount > 0)
-			{
-				Info.Text = FText::Format(LOCTEXT("ImportPartialSuccess", "Imported {0} Cubemaps and {1} Texture2Ds.\nTexture2Ds must be converted to Cubemaps to appear in the Vault."), 
-					FText::AsNumber(CubemapCount), FText::AsNumber(Texture2DCount));
-				Info.Image = FAppStyle::GetBrush("Icons.Warning");
-			}
-			else
-			{
-				Info.Image = FAppStyle::GetBrush("Icons.SuccessWithColor");
+				ImportedItems.Add(MaterialItem->Handle);
 			}
-			
-			Info.ExpireDuration = 5.0f;
-			Info.bFireAndForget = true;
-			FSlateNotificationManager::Get().AddNotification(Info);
+		}
+		else if (Asset->IsA(UTexture2D::StaticClass()))
+		{
+			Result.NumTexture2Ds++;
 		}
 	}
+
+	if (ImportedItems.Num() > 0)
+	{
+		SaveMaterialMetadata(ImportedItems);
+	}
+	PublishPendingChanges();
+	
+	return Result;
 }
 
 #undef LOCTEXT_NAMESPACE 
\ No newline at end of file
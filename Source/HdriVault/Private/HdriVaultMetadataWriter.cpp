@@ -0,0 +1,252 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultMetadataWriter.h"
+#include "HdriVaultWorkerPool.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+#if PLATFORM_WINDOWS
+	#include "Windows/AllowWindowsPlatformTypes.h"
+	#include "Windows/WindowsHWrapper.h"
+	#include "Windows/HideWindowsPlatformTypes.h"
+#elif PLATFORM_UNIX || PLATFORM_MAC
+	#include <stdio.h>
+#endif
+
+namespace HdriVaultMetadataWriterUtils
+{
+	// How often queued writes are handed to the background thread
+	static constexpr float FlushInterval = 0.5f;
+
+	// Renames SourcePath over DestPath in one step, so readers see either the old or the new file.
+	// IFileManager::Move deletes the destination first instead.
+	static bool ReplaceFileAtomic(const FString& DestPath, const FString& SourcePath)
+	{
+		const FString FullDestPath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*DestPath);
+		const FString FullSourcePath = IFileManager::Get().ConvertToAbsolutePathForExternalAppForWrite(*SourcePath);
+#if PLATFORM_WINDOWS
+		return ::MoveFileExW(*FullSourcePath, *FullDestPath, MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH) != 0;
+#elif PLATFORM_UNIX || PLATFORM_MAC
+		return ::rename(TCHAR_TO_UTF8(*FullSourcePath), TCHAR_TO_UTF8(*FullDestPath)) == 0;
+#else
+		return false;
+#endif
+	}
+}
+
+FHdriVaultMetadataWriter::FHdriVaultMetadataWriter()
+	: bIsInitialized(false)
+{
+}
+
+FHdriVaultMetadataWriter::~FHdriVaultMetadataWriter()
+{
+	if (bIsInitialized)
+	{
+		Shutdown();
+	}
+}
+
+void FHdriVaultMetadataWriter::Initialize()
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FHdriVaultMetadataWriter::Tick),
+		HdriVaultMetadataWriterUtils::FlushInterval);
+
+	bIsInitialized = true;
+}
+
+void FHdriVaultMetadataWriter::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	// Nothing queued may be lost on shutdown
+	Flush();
+
+	bIsInitialized = false;
+}
+
+void FHdriVaultMetadataWriter::Enqueue(const FString& MetadataPath, const FHdriVaultMetadata& Metadata)
+{
+	FScopeLock Lock(&PendingLock);
+	PendingWrites.Add(MetadataPath, Metadata);
+}
+
+void FHdriVaultMetadataWriter::Flush()
+{
+	// Let the background batch finish first so writes to the same file stay ordered
+	if (InFlightFlush.IsValid())
+	{
+		InFlightFlush.Wait();
+		InFlightFlush.Reset();
+		InFlightBatch.Reset();
+	}
+
+	TMap<FString, FHdriVaultMetadata> Batch;
+	{
+		FScopeLock Lock(&PendingLock);
+		Batch = MoveTemp(PendingWrites);
+		PendingWrites.Reset();
+	}
+
+	WriteBatch(Batch);
+}
+
+int32 FHdriVaultMetadataWriter::GetNumPending() const
+{
+	FScopeLock Lock(&PendingLock);
+	return PendingWrites.Num();
+}
+
+bool FHdriVaultMetadataWriter::FindPending(const FString& MetadataPath, FHdriVaultMetadata& OutMetadata) const
+{
+	{
+		FScopeLock Lock(&PendingLock);
+		if (const FHdriVaultMetadata* Pending = PendingWrites.Find(MetadataPath))
+		{
+			OutMetadata = *Pending;
+			return true;
+		}
+	}
+
+	// The in-flight batch is only swapped on the game thread, which is also where this is called
+	if (InFlightBatch.IsValid() && !InFlightFlush.IsReady())
+	{
+		if (const FHdriVaultMetadata* InFlight = InFlightBatch->Find(MetadataPath))
+		{
+			OutMetadata = *InFlight;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool FHdriVaultMetadataWriter::Tick(float DeltaTime)
+{
+	KickBackgroundFlush();
+	return true;
+}
+
+void FHdriVaultMetadataWriter::KickBackgroundFlush()
+{
+	// Only one batch in flight at a time; anything queued meanwhile goes out with the next tick
+	if (InFlightFlush.IsValid())
+	{
+		if (!InFlightFlush.IsReady())
+		{
+			return;
+		}
+		InFlightFlush.Reset();
+		InFlightBatch.Reset();
+	}
+
+	TMap<FString, FHdriVaultMetadata> Batch;
+	{
+		FScopeLock Lock(&PendingLock);
+		if (PendingWrites.Num() == 0)
+		{
+			return;
+		}
+		Batch = MoveTemp(PendingWrites);
+		PendingWrites.Reset();
+	}
+
+	InFlightBatch = MakeShared<TMap<FString, FHdriVaultMetadata>, ESPMode::ThreadSafe>(MoveTemp(Batch));
+	TUniqueFunction<void()> Work = [Batch = InFlightBatch]()
+	{
+		WriteBatch(*Batch);
+	};
+
+	if (TSharedPtr<FHdriVaultWorkerPool> PinnedWorkerPool = WorkerPool.Pin())
+	{
+		InFlightFlush = PinnedWorkerPool->Launch(EHdriVaultWorkerPriority::Bulk, MoveTemp(Work));
+	}
+	else
+	{
+		InFlightFlush = Async(EAsyncExecution::ThreadPool, MoveTemp(Work));
+	}
+}
+
+void FHdriVaultMetadataWriter::WriteBatch(const TMap<FString, FHdriVaultMetadata>& Batch)
+{
+	for (const auto& Pair : Batch)
+	{
+		if (!WriteFileAtomic(Pair.Key, SerializeMetadata(Pair.Value)))
+		{
+			UE_LOG(LogTemp, Error, TEXT("HdriVault: Failed to write metadata file %s"), *Pair.Key);
+		}
+	}
+}
+
+bool FHdriVaultMetadataWriter::WriteFileAtomic(const FString& FilePath, const FString& Contents)
+{
+	// Write next to the destination and rename over it, so a crash never leaves a half-written file
+	const FString TempPath = GetTempFilePath(FilePath);
+
+	if (!FFileHelper::SaveStringToFile(Contents, *TempPath))
+	{
+		return false;
+	}
+
+	// Read-only destinations (files under source control) need the file manager's delete and rename. If
+	// that is interrupted, readers fall back to the staged copy.
+	if (!HdriVaultMetadataWriterUtils::ReplaceFileAtomic(FilePath, TempPath)
+		&& !IFileManager::Get().Move(*FilePath, *TempPath, /*bReplace*/ true, /*bEvenIfReadOnly*/ true))
+	{
+		IFileManager::Get().Delete(*TempPath, false, true, true);
+		return false;
+	}
+
+	return true;
+}
+
+FString FHdriVaultMetadataWriter::GetTempFilePath(const FString& MetadataPath)
+{
+	return MetadataPath + TEXT(".tmp");
+}
+
+FString FHdriVaultMetadataWriter::SerializeMetadata(const FHdriVaultMetadata& Metadata)
+{
+	TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+	JsonObject->SetStringField(TEXT("MaterialName"), Metadata.MaterialName);
+	JsonObject->SetStringField(TEXT("Author"), Metadata.Author);
+	JsonObject->SetStringField(TEXT("LastModified"), Metadata.LastModified.ToString());
+	JsonObject->SetStringField(TEXT("Notes"), Metadata.Notes);
+	JsonObject->SetStringField(TEXT("Category"), Metadata.Category);
+	JsonObject->SetStringField(TEXT("CustomThumbnailPath"), Metadata.CustomThumbnailPath);
+	if (Metadata.SourceWidth > 0 && Metadata.SourceHeight > 0)
+	{
+		JsonObject->SetNumberField(TEXT("SourceWidth"), Metadata.SourceWidth);
+		JsonObject->SetNumberField(TEXT("SourceHeight"), Metadata.SourceHeight);
+	}
+
+	TArray<TSharedPtr<FJsonValue>> TagsArray;
+	for (const FString& Tag : Metadata.Tags)
+	{
+		TagsArray.Add(MakeShareable(new FJsonValueString(Tag)));
+	}
+	JsonObject->SetArrayField(TEXT("Tags"), TagsArray);
+
+	FString OutputString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+	FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+	return OutputString;
+}
@@ -0,0 +1,63 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Async/Future.h"
+#include "HdriVaultTypes.h"
+
+/**
+ * Write-behind queue for metadata files.
+ * Repeated edits to the same file are merged and written in batches on a background thread.
+ */
+class FHdriVaultMetadataWriter
+{
+public:
+	FHdriVaultMetadataWriter();
+	~FHdriVaultMetadataWriter();
+
+	// Initialize/cleanup. Shutdown flushes everything still queued.
+	void Initialize();
+	void Shutdown();
+
+	// Queue metadata to be written to MetadataPath. Replaces any pending write for the same file.
+	void Enqueue(const FString& MetadataPath, const FHdriVaultMetadata& Metadata);
+
+	// Blocks until every queued write has reached disk
+	void Flush();
+
+	int32 GetNumPending() const;
+
+	// Latest metadata queued for MetadataPath that may not have reached disk yet
+	bool FindPending(const FString& MetadataPath, FHdriVaultMetadata& OutMetadata) const;
+
+	static FString SerializeMetadata(const FHdriVaultMetadata& Metadata);
+
+	// Where a write is staged before it replaces MetadataPath. Only a crash in the middle of a
+	// non-atomic replace leaves it behind with MetadataPath missing, and then it holds the latest write.
+	static FString GetTempFilePath(const FString& MetadataPath);
+
+	// Batches are written as bulk work on this pool when set
+	void SetWorkerPool(const TSharedPtr<class FHdriVaultWorkerPool>& InWorkerPool) { WorkerPool = InWorkerPool; }
+
+private:
+	bool Tick(float DeltaTime);
+	void KickBackgroundFlush();
+	static void WriteBatch(const TMap<FString, FHdriVaultMetadata>& Batch);
+	static bool WriteFileAtomic(const FString& FilePath, const FString& Contents);
+
+	// Pending writes keyed by metadata file path
+	mutable FCriticalSection PendingLock;
+	TMap<FString, FHdriVaultMetadata> PendingWrites;
+
+	// Batch currently being written in the background
+	TFuture<void> InFlightFlush;
+	TSharedPtr<const TMap<FString, FHdriVaultMetadata>, ESPMode::ThreadSafe> InFlightBatch;
+
+	TWeakPtr<class FHdriVaultWorkerPool> WorkerPool;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	bool bIsInitialized = false;
+};
@@ -0,0 +1,77 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultOperation.h"
+#include "Misc/ScopeLock.h"
+
+FHdriVaultOperation::FHdriVaultOperation()
+	: CompletionEvent(TEXT("HdriVaultOperation"))
+{
+}
+
+FHdriVaultOperation::~FHdriVaultOperation()
+{
+	// Anything waiting on the event must not wait forever on an operation that was dropped
+	if (!CompletionEvent.IsCompleted())
+	{
+		CompletionEvent.Trigger();
+	}
+}
+
+FText FHdriVaultOperation::GetStatusText() const
+{
+	FScopeLock Lock(&StatusLock);
+	return StatusText;
+}
+
+void FHdriVaultOperation::Then(TUniqueFunction<void(EHdriVaultOperationResult)>&& Continuation)
+{
+	check(IsInGameThread());
+
+	if (IsComplete())
+	{
+		Continuation(GetResult());
+		return;
+	}
+
+	Continuations.Add(MoveTemp(Continuation));
+}
+
+void FHdriVaultOperation::SetProgress(float InProgress)
+{
+	Progress.store(FMath::Clamp(InProgress, 0.0f, 1.0f), std::memory_order_relaxed);
+}
+
+void FHdriVaultOperation::SetProgress(float InProgress, const FText& InStatusText)
+{
+	SetProgress(InProgress);
+
+	FScopeLock Lock(&StatusLock);
+	StatusText = InStatusText;
+}
+
+bool FHdriVaultOperation::Complete(EHdriVaultOperationResult InResult)
+{
+	check(IsInGameThread());
+	check(InResult != EHdriVaultOperationResult::Pending);
+
+	if (IsComplete())
+	{
+		return false;
+	}
+
+	if (InResult == EHdriVaultOperationResult::Succeeded)
+	{
+		SetProgress(1.0f);
+	}
+	Result.store(InResult, std::memory_order_release);
+	CompletionEvent.Trigger();
+
+	// A continuation may chain another Then on this operation; it runs right away since we are complete
+	TArray<TUniqueFunction<void(EHdriVaultOperationResult)>> PendingContinuations = MoveTemp(Continuations);
+	for (TUniqueFunction<void(EHdriVaultOperationResult)>& Continuation : PendingContinuations)
+	{
+		Continuation(InResult);
+	}
+
+	return true;
+}
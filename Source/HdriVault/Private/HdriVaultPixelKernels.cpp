@@ -0,0 +1,520 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultPixelKernels.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include <type_traits>
+
+#if PLATFORM_CPU_X86_FAMILY
+	#include <immintrin.h>
+	#define HDRIVAULT_KERNELS_F16C (PLATFORM_ALWAYS_HAS_F16C && PLATFORM_ALWAYS_HAS_AVX_2)
+	#define HDRIVAULT_KERNELS_SSE 1
+	#define HDRIVAULT_KERNELS_NEON 0
+#elif PLATFORM_CPU_ARM_FAMILY && PLATFORM_64BITS
+	#include <arm_neon.h>
+	#define HDRIVAULT_KERNELS_F16C 0
+	#define HDRIVAULT_KERNELS_SSE 0
+	#define HDRIVAULT_KERNELS_NEON 1
+#else
+	#define HDRIVAULT_KERNELS_F16C 0
+	#define HDRIVAULT_KERNELS_SSE 0
+	#define HDRIVAULT_KERNELS_NEON 0
+#endif
+
+namespace HdriVaultPixelKernelsUtils
+{
+	static uint32 ToBits(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	static float FromBits(uint32 Bits)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	template<typename SourceType>
+	static FORCEINLINE float LoadSample(const SourceType* Source)
+	{
+		if constexpr (std::is_same_v<SourceType, uint16>)
+		{
+			return FHdriVaultPixelKernels::HalfToFloatScalar(*Source);
+		}
+		else
+		{
+			return *Source;
+		}
+	}
+
+#if HDRIVAULT_KERNELS_SSE
+	typedef __m128 FKernelVec4;
+
+	// Four halves to floats. Without F16C this is the usual integer rebias: shift the exponent and
+	// mantissa into place and scale by 2^112, which also normalizes denormals, then patch Inf and NaN.
+	static FORCEINLINE __m128 HalfToFloat4(__m128i Halves)
+	{
+		const __m128i ExpMantissa = _mm_and_si128(Halves, _mm_set1_epi32(0x7fff));
+		const __m128i Sign = _mm_slli_epi32(_mm_xor_si128(Halves, ExpMantissa), 16);
+		const __m128 Scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(ExpMantissa, 13)), _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+		const __m128i WasInfNan = _mm_cmpgt_epi32(ExpMantissa, _mm_set1_epi32(0x7bff));
+		const __m128 InfNanExponent = _mm_and_ps(_mm_castsi128_ps(WasInfNan), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+		return _mm_or_ps(Scaled, _mm_or_ps(_mm_castsi128_ps(Sign), InfNanExponent));
+	}
+
+	// Four floats to halves in the low 16 bits of each lane, rounding to nearest even. Mirrors
+	// FloatToHalfScalar lane by lane.
+	static FORCEINLINE __m128i FloatToHalf4(__m128 Floats)
+	{
+		const __m128i Bits = _mm_castps_si128(Floats);
+		const __m128i Sign = _mm_and_si128(Bits, _mm_set1_epi32(int32(0x80000000u)));
+		const __m128i Abs = _mm_xor_si128(Bits, Sign);
+
+		const __m128i IsInfNan = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(((127 + 16) << 23) - 1));
+		const __m128i IsNan = _mm_cmpgt_epi32(Abs, _mm_set1_epi32(255 << 23));
+		const __m128i InfNan = _mm_or_si128(_mm_and_si128(IsNan, _mm_set1_epi32(0x7e00)), _mm_andnot_si128(IsNan, _mm_set1_epi32(0x7c00)));
+
+		const __m128i IsDenormal = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), Abs);
+		const __m128i DenormalMagic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+		const __m128i Denormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(_mm_castsi128_ps(Abs), _mm_castsi128_ps(DenormalMagic))), DenormalMagic);
+
+		const __m128i MantissaOdd = _mm_and_si128(_mm_srli_epi32(Abs, 13), _mm_set1_epi32(1));
+		__m128i Normal = _mm_add_epi32(Abs, _mm_set1_epi32(int32(uint32(15 - 127) << 23) + 0xfff));
+		Normal = _mm_srli_epi32(_mm_add_epi32(Normal, MantissaOdd), 13);
+
+		__m128i Result = _mm_or_si128(_mm_and_si128(IsDenormal, Denormal), _mm_andnot_si128(IsDenormal, Normal));
+		Result = _mm_or_si128(_mm_and_si128(IsInfNan, InfNan), _mm_andnot_si128(IsInfNan, Result));
+		return _mm_or_si128(Result, _mm_srli_epi32(Sign, 16));
+	}
+
+	// Packs two vectors of lane-wide halves into eight halves
+	static FORCEINLINE __m128i PackHalves(__m128i Low, __m128i High)
+	{
+		// packs saturates as signed, so sign-extend the halves first to keep their bits
+		return _mm_packs_epi32(_mm_srai_epi32(_mm_slli_epi32(Low, 16), 16), _mm_srai_epi32(_mm_slli_epi32(High, 16), 16));
+	}
+
+	static FORCEINLINE FKernelVec4 Load4(const float* Source)
+	{
+		return _mm_loadu_ps(Source);
+	}
+
+	static FORCEINLINE FKernelVec4 Load4(const uint16* Source)
+	{
+#if HDRIVAULT_KERNELS_F16C
+		return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Source)));
+#else
+		return HalfToFloat4(_mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(Source)), _mm_setzero_si128()));
+#endif
+	}
+
+	static FORCEINLINE FKernelVec4 Splat(float Value)
+	{
+		return _mm_set1_ps(Value);
+	}
+
+	// Writes four RGBA pixels from one vector per channel
+	static FORCEINLINE void StoreRgba4(float* Dest, FKernelVec4 R, FKernelVec4 G, FKernelVec4 B, FKernelVec4 A)
+	{
+		_MM_TRANSPOSE4_PS(R, G, B, A);
+		_mm_storeu_ps(Dest, R);
+		_mm_storeu_ps(Dest + 4, G);
+		_mm_storeu_ps(Dest + 8, B);
+		_mm_storeu_ps(Dest + 12, A);
+	}
+#elif HDRIVAULT_KERNELS_NEON
+	typedef float32x4_t FKernelVec4;
+
+	static FORCEINLINE FKernelVec4 Load4(const float* Source)
+	{
+		return vld1q_f32(Source);
+	}
+
+	static FORCEINLINE FKernelVec4 Load4(const uint16* Source)
+	{
+		return vcvt_f32_f16(vreinterpret_f16_u16(vld1_u16(Source)));
+	}
+
+	static FORCEINLINE FKernelVec4 Splat(float Value)
+	{
+		return vdupq_n_f32(Value);
+	}
+
+	static FORCEINLINE void StoreRgba4(float* Dest, FKernelVec4 R, FKernelVec4 G, FKernelVec4 B, FKernelVec4 A)
+	{
+		float32x4x4_t Pixels;
+		Pixels.val[0] = R;
+		Pixels.val[1] = G;
+		Pixels.val[2] = B;
+		Pixels.val[3] = A;
+		vst4q_f32(Dest, Pixels);
+	}
+#endif
+
+	static bool IsHalfNan(uint16 Half)
+	{
+		return (Half & 0x7c00) == 0x7c00 && (Half & 0x03ff) != 0;
+	}
+
+	static bool SameFloat(float A, float B)
+	{
+		return FMath::IsNaN(A) ? FMath::IsNaN(B) : ToBits(A) == ToBits(B);
+	}
+
+	struct FKernelMismatches
+	{
+		int32 HalfToFloat = 0;
+		int32 FloatToHalf = 0;
+		int32 PlanarToRgba = 0;
+
+		int32 Total() const { return HalfToFloat + FloatToHalf + PlanarToRgba; }
+	};
+
+	// Runs every vector kernel against the scalar reference; sizes are odd so the scalar tails run too
+	static FKernelMismatches CompareKernels()
+	{
+		FKernelMismatches Mismatches;
+		FRandomStream Random(0x48445249);
+
+		// Every half value
+		TArray<uint16> Halves;
+		for (uint32 Half = 0; Half <= 0xffff; ++Half)
+		{
+			Halves.Add(static_cast<uint16>(Half));
+		}
+		TArray<float> Floats;
+		Floats.SetNumUninitialized(Halves.Num());
+		FHdriVaultPixelKernels::HalfToFloat(Halves.GetData(), Floats.GetData(), Halves.Num());
+		for (int32 Index = 0; Index < Halves.Num(); ++Index)
+		{
+			Mismatches.HalfToFloat += SameFloat(Floats[Index], FHdriVaultPixelKernels::HalfToFloatScalar(Halves[Index])) ? 0 : 1;
+		}
+
+		// Every half value back again, then values halfway between neighbouring halves of either sign,
+		// where rounding decides (subnormal halves included), then float denormals, the overflow edge
+		// and arbitrary bit patterns
+		for (int32 Index = 0; Index < 0x7bff; ++Index)
+		{
+			const float Low = FHdriVaultPixelKernels::HalfToFloatScalar(static_cast<uint16>(Index));
+			const float High = FHdriVaultPixelKernels::HalfToFloatScalar(static_cast<uint16>(Index + 1));
+			const uint32 Halfway = (ToBits(Low) >> 1) + (ToBits(High) >> 1) + (ToBits(Low) & ToBits(High) & 1);
+			Floats.Add(FromBits(Halfway));
+			Floats.Add(FromBits(Halfway | 0x80000000u));
+		}
+		for (const uint32 Bits : { 0x00000001u, 0x00000002u, 0x00400000u, 0x007fffffu, 0x33000000u, 0x33000001u, 0x337fffffu, 0x38800000u, 0x477fe000u, 0x477fefffu, 0x477ff000u })
+		{
+			Floats.Add(FromBits(Bits));
+			Floats.Add(FromBits(Bits | 0x80000000u));
+		}
+		for (int32 Index = 0; Index < 100001; ++Index)
+		{
+			Floats.Add(FromBits(Random.GetUnsignedInt()));
+		}
+		TArray<uint16> Converted;
+		Converted.SetNumUninitialized(Floats.Num());
+		FHdriVaultPixelKernels::FloatToHalf(Floats.GetData(), Converted.GetData(), Floats.Num());
+		for (int32 Index = 0; Index < Floats.Num(); ++Index)
+		{
+			const uint16 Expected = FHdriVaultPixelKernels::FloatToHalfScalar(Floats[Index]);
+			Mismatches.FloatToHalf += (Converted[Index] == Expected || (IsHalfNan(Converted[Index]) && IsHalfNan(Expected))) ? 0 : 1;
+		}
+
+		// Every pixel type and layout
+		const int32 NumPixels = 1027;
+		TArray<uint16> HalfPlanes[4];
+		TArray<float> FloatPlanes[4];
+		for (int32 Plane = 0; Plane < 4; ++Plane)
+		{
+			for (int32 Index = 0; Index < NumPixels; ++Index)
+			{
+				HalfPlanes[Plane].Add(static_cast<uint16>(Random.RandHelper(0x7c00) | (Random.RandHelper(2) << 15)));
+				FloatPlanes[Plane].Add(Random.FRandRange(-1000.0f, 1000.0f));
+			}
+		}
+
+		TArray<float> Vector;
+		TArray<float> Reference;
+		Vector.SetNumUninitialized(NumPixels * 4);
+		Reference.SetNumUninitialized(NumPixels * 4);
+		for (EHdriVaultPixelType PixelType : { EHdriVaultPixelType::Half, EHdriVaultPixelType::Float })
+		{
+			for (EHdriVaultChannelLayout Layout : { EHdriVaultChannelLayout::Y, EHdriVaultChannelLayout::RGB, EHdriVaultChannelLayout::RGBA })
+			{
+				const void* Planes[4];
+				for (int32 Plane = 0; Plane < 4; ++Plane)
+				{
+					Planes[Plane] = PixelType == EHdriVaultPixelType::Half ? static_cast<const void*>(HalfPlanes[Plane].GetData()) : FloatPlanes[Plane].GetData();
+				}
+
+				FHdriVaultPixelKernels::PlanarToRgba(Planes, PixelType, Layout, Vector.GetData(), NumPixels);
+				FHdriVaultPixelKernels::PlanarToRgbaScalar(Planes, PixelType, Layout, Reference.GetData(), NumPixels);
+				for (int32 Index = 0; Index < Vector.Num(); ++Index)
+				{
+					Mismatches.PlanarToRgba += SameFloat(Vector[Index], Reference[Index]) ? 0 : 1;
+				}
+			}
+		}
+
+		return Mismatches;
+	}
+
+	static void VerifyKernels()
+	{
+		const int32 NumMismatches = CompareKernels().Total();
+		if (NumMismatches > 0)
+		{
+			UE_LOG(LogTemp, Error, TEXT("HdriVault: %d pixel kernel results (%s) differ from the scalar reference"), NumMismatches, FHdriVaultPixelKernels::GetVectorPathName());
+		}
+		else
+		{
+			UE_LOG(LogTemp, Display, TEXT("HdriVault: Pixel kernels (%s) match the scalar reference"), FHdriVaultPixelKernels::GetVectorPathName());
+		}
+	}
+
+	static FAutoConsoleCommand VerifyKernelsCommand(
+		TEXT("HdriVault.VerifyPixelKernels"),
+		TEXT("Checks the vectorized EXR pixel conversions against their scalar reference and logs the result."),
+		FConsoleCommandDelegate::CreateStatic(&VerifyKernels));
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FHdriVaultPixelKernelsTest, "HdriVault.PixelKernels.MatchScalarReference",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FHdriVaultPixelKernelsTest::RunTest(const FString& Parameters)
+{
+	AddInfo(FString::Printf(TEXT("Vector path: %s"), FHdriVaultPixelKernels::GetVectorPathName()));
+
+	const HdriVaultPixelKernelsUtils::FKernelMismatches Mismatches = HdriVaultPixelKernelsUtils::CompareKernels();
+	TestEqual(TEXT("HalfToFloat results differing from the scalar reference"), Mismatches.HalfToFloat, 0);
+	TestEqual(TEXT("FloatToHalf results differing from the scalar reference, rounding and denormals included"), Mismatches.FloatToHalf, 0);
+	TestEqual(TEXT("PlanarToRgba results differing from the scalar reference"), Mismatches.PlanarToRgba, 0);
+	return true;
+}
+
+#endif
+
+float FHdriVaultPixelKernels::HalfToFloatScalar(uint16 Half)
+{
+	// Rebias the exponent, then fix up Inf/NaN and renormalize denormals
+	const uint32 ShiftedExponent = 0x7c00 << 13;
+	uint32 Bits = (Half & 0x7fff) << 13;
+	const uint32 Exponent = Bits & ShiftedExponent;
+	Bits += (127 - 15) << 23;
+
+	if (Exponent == ShiftedExponent)
+	{
+		Bits += (128 - 16) << 23;
+	}
+	else if (Exponent == 0)
+	{
+		Bits += 1 << 23;
+		Bits = HdriVaultPixelKernelsUtils::ToBits(HdriVaultPixelKernelsUtils::FromBits(Bits) - HdriVaultPixelKernelsUtils::FromBits(113 << 23));
+	}
+
+	return HdriVaultPixelKernelsUtils::FromBits(Bits | (uint32(Half & 0x8000) << 16));
+}
+
+uint16 FHdriVaultPixelKernels::FloatToHalfScalar(float Value)
+{
+	const uint32 Bits = HdriVaultPixelKernelsUtils::ToBits(Value);
+	const uint32 Sign = Bits & 0x80000000u;
+	uint32 Abs = Bits ^ Sign;
+	uint32 Result = 0;
+
+	if (Abs >= (127 + 16) << 23)
+	{
+		// Too large for a half: Inf, or a quiet NaN
+		Result = Abs > (255u << 23) ? 0x7e00 : 0x7c00;
+	}
+	else if (Abs < 113 << 23)
+	{
+		// Denormal or zero: adding a magic value lines the mantissa up at the bottom and lets the FPU round
+		const uint32 DenormalMagic = ((127 - 15) + (23 - 10) + 1) << 23;
+		Result = HdriVaultPixelKernelsUtils::ToBits(HdriVaultPixelKernelsUtils::FromBits(Abs) + HdriVaultPixelKernelsUtils::FromBits(DenormalMagic)) - DenormalMagic;
+	}
+	else
+	{
+		// Rebias and round to nearest even
+		const uint32 MantissaOdd = (Abs >> 13) & 1;
+		Abs += (uint32(15 - 127) << 23) + 0xfff;
+		Result = (Abs + MantissaOdd) >> 13;
+	}
+
+	return static_cast<uint16>(Result | (Sign >> 16));
+}
+
+void FHdriVaultPixelKernels::HalfToFloat(const uint16* Source, float* Dest, int32 Count)
+{
+	int32 Index = 0;
+#if HDRIVAULT_KERNELS_F16C
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		_mm256_storeu_ps(Dest + Index, _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index))));
+	}
+#elif HDRIVAULT_KERNELS_SSE
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const __m128i Halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Index));
+		_mm_storeu_ps(Dest + Index, HdriVaultPixelKernelsUtils::HalfToFloat4(_mm_unpacklo_epi16(Halves, _mm_setzero_si128())));
+		_mm_storeu_ps(Dest + Index + 4, HdriVaultPixelKernelsUtils::HalfToFloat4(_mm_unpackhi_epi16(Halves, _mm_setzero_si128())));
+	}
+#elif HDRIVAULT_KERNELS_NEON
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const uint16x8_t Halves = vld1q_u16(Source + Index);
+		vst1q_f32(Dest + Index, vcvt_f32_f16(vreinterpret_f16_u16(vget_low_u16(Halves))));
+		vst1q_f32(Dest + Index + 4, vcvt_f32_f16(vreinterpret_f16_u16(vget_high_u16(Halves))));
+	}
+#endif
+	for (; Index < Count; ++Index)
+	{
+		Dest[Index] = HalfToFloatScalar(Source[Index]);
+	}
+}
+
+void FHdriVaultPixelKernels::FloatToHalf(const float* Source, uint16* Dest, int32 Count)
+{
+	int32 Index = 0;
+#if HDRIVAULT_KERNELS_F16C
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), _mm256_cvtps_ph(_mm256_loadu_ps(Source + Index), _MM_FROUND_TO_NEAREST_INT));
+	}
+#elif HDRIVAULT_KERNELS_SSE
+	for (; Index + 8 <= Count; Index += 8)
+	{
+		const __m128i Low = HdriVaultPixelKernelsUtils::FloatToHalf4(_mm_loadu_ps(Source + Index));
+		const __m128i High = HdriVaultPixelKernelsUtils::FloatToHalf4(_mm_loadu_ps(Source + Index + 4));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Dest + Index), HdriVaultPixelKernelsUtils::PackHalves(Low, High));
+	}
+#elif HDRIVAULT_KERNELS_NEON
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		vst1_u16(Dest + Index, vreinterpret_u16_f16(vcvt_f16_f32(vld1q_f32(Source + Index))));
+	}
+#endif
+	for (; Index < Count; ++Index)
+	{
+		Dest[Index] = FloatToHalfScalar(Source[Index]);
+	}
+}
+
+template<typename SourceType, EHdriVaultChannelLayout Layout>
+void FHdriVaultPixelKernels::PlanarToRgba(const SourceType* const* Planes, float* Dest, int32 Count)
+{
+	static_assert(std::is_same_v<SourceType, uint16> || std::is_same_v<SourceType, float>, "Planes must be half (uint16) or float");
+
+	const SourceType* R = Planes[0];
+	const SourceType* G = Layout == EHdriVaultChannelLayout::Y ? Planes[0] : Planes[1];
+	const SourceType* B = Layout == EHdriVaultChannelLayout::Y ? Planes[0] : Planes[2];
+	const SourceType* A = Layout == EHdriVaultChannelLayout::RGBA ? Planes[3] : nullptr;
+
+	int32 Index = 0;
+#if HDRIVAULT_KERNELS_SSE || HDRIVAULT_KERNELS_NEON
+	const HdriVaultPixelKernelsUtils::FKernelVec4 One = HdriVaultPixelKernelsUtils::Splat(1.0f);
+	for (; Index + 4 <= Count; Index += 4)
+	{
+		const HdriVaultPixelKernelsUtils::FKernelVec4 RedValues = HdriVaultPixelKernelsUtils::Load4(R + Index);
+		if constexpr (Layout == EHdriVaultChannelLayout::Y)
+		{
+			HdriVaultPixelKernelsUtils::StoreRgba4(Dest + Index * 4, RedValues, RedValues, RedValues, One);
+		}
+		else if constexpr (Layout == EHdriVaultChannelLayout::RGB)
+		{
+			HdriVaultPixelKernelsUtils::StoreRgba4(Dest + Index * 4, RedValues, HdriVaultPixelKernelsUtils::Load4(G + Index), HdriVaultPixelKernelsUtils::Load4(B + Index), One);
+		}
+		else
+		{
+			HdriVaultPixelKernelsUtils::StoreRgba4(Dest + Index * 4, RedValues, HdriVaultPixelKernelsUtils::Load4(G + Index), HdriVaultPixelKernelsUtils::Load4(B + Index), HdriVaultPixelKernelsUtils::Load4(A + Index));
+		}
+	}
+#endif
+	for (; Index < Count; ++Index)
+	{
+		float* Pixel = Dest + Index * 4;
+		Pixel[0] = HdriVaultPixelKernelsUtils::LoadSample(R + Index);
+		Pixel[1] = Layout == EHdriVaultChannelLayout::Y ? Pixel[0] : HdriVaultPixelKernelsUtils::LoadSample(G + Index);
+		Pixel[2] = Layout == EHdriVaultChannelLayout::Y ? Pixel[0] : HdriVaultPixelKernelsUtils::LoadSample(B + Index);
+		Pixel[3] = A ? HdriVaultPixelKernelsUtils::LoadSample(A + Index) : 1.0f;
+	}
+}
+
+template void FHdriVaultPixelKernels::PlanarToRgba<uint16, EHdriVaultChannelLayout::Y>(const uint16* const*, float*, int32);
+template void FHdriVaultPixelKernels::PlanarToRgba<uint16, EHdriVaultChannelLayout::RGB>(const uint16* const*, float*, int32);
+template void FHdriVaultPixelKernels::PlanarToRgba<uint16, EHdriVaultChannelLayout::RGBA>(const uint16* const*, float*, int32);
+template void FHdriVaultPixelKernels::PlanarToRgba<float, EHdriVaultChannelLayout::Y>(const float* const*, float*, int32);
+template void FHdriVaultPixelKernels::PlanarToRgba<float, EHdriVaultChannelLayout::RGB>(const float* const*, float*, int32);
+template void FHdriVaultPixelKernels::PlanarToRgba<float, EHdriVaultChannelLayout::RGBA>(const float* const*, float*, int32);
+
+void FHdriVaultPixelKernels::PlanarToRgba(const void* const* Planes, EHdriVaultPixelType PixelType, EHdriVaultChannelLayout Layout, float* Dest, int32 Count)
+{
+	if (PixelType == EHdriVaultPixelType::Half)
+	{
+		const uint16* const* HalfPlanes = reinterpret_cast<const uint16* const*>(Planes);
+		switch (Layout)
+		{
+		case EHdriVaultChannelLayout::Y:	PlanarToRgba<uint16, EHdriVaultChannelLayout::Y>(HalfPlanes, Dest, Count); break;
+		case EHdriVaultChannelLayout::RGB:	PlanarToRgba<uint16, EHdriVaultChannelLayout::RGB>(HalfPlanes, Dest, Count); break;
+		default:							PlanarToRgba<uint16, EHdriVaultChannelLayout::RGBA>(HalfPlanes, Dest, Count); break;
+		}
+	}
+	else
+	{
+		const float* const* FloatPlanes = reinterpret_cast<const float* const*>(Planes);
+		switch (Layout)
+		{
+		case EHdriVaultChannelLayout::Y:	PlanarToRgba<float, EHdriVaultChannelLayout::Y>(FloatPlanes, Dest, Count); break;
+		case EHdriVaultChannelLayout::RGB:	PlanarToRgba<float, EHdriVaultChannelLayout::RGB>(FloatPlanes, Dest, Count); break;
+		default:							PlanarToRgba<float, EHdriVaultChannelLayout::RGBA>(FloatPlanes, Dest, Count); break;
+		}
+	}
+}
+
+void FHdriVaultPixelKernels::PlanarToRgbaScalar(const void* const* Planes, EHdriVaultPixelType PixelType, EHdriVaultChannelLayout Layout, float* Dest, int32 Count)
+{
+	const int32 NumPlanes = GetNumPlanes(Layout);
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		float Samples[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+		for (int32 Plane = 0; Plane < NumPlanes; ++Plane)
+		{
+			Samples[Plane] = PixelType == EHdriVaultPixelType::Half
+				? HalfToFloatScalar(static_cast<const uint16*>(Planes[Plane])[Index])
+				: static_cast<const float*>(Planes[Plane])[Index];
+		}
+		if (Layout == EHdriVaultChannelLayout::Y)
+		{
+			Samples[1] = Samples[2] = Samples[0];
+		}
+		FMemory::Memcpy(Dest + Index * 4, Samples, sizeof(Samples));
+	}
+}
+
+int32 FHdriVaultPixelKernels::GetNumPlanes(EHdriVaultChannelLayout Layout)
+{
+	switch (Layout)
+	{
+	case EHdriVaultChannelLayout::Y:	return 1;
+	case EHdriVaultChannelLayout::RGB:	return 3;
+	default:							return 4;
+	}
+}
+
+const TCHAR* FHdriVaultPixelKernels::GetVectorPathName()
+{
+#if HDRIVAULT_KERNELS_F16C
+	return TEXT("F16C/AVX2");
+#elif HDRIVAULT_KERNELS_SSE
+	return TEXT("SSE2");
+#elif HDRIVAULT_KERNELS_NEON
+	return TEXT("NEON");
+#else
+	return TEXT("scalar");
+#endif
+}
@@ -0,0 +1,56 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Sample type of a decoded EXR channel
+enum class EHdriVaultPixelType : uint8
+{
+	Half,
+	Float
+};
+
+// Which planes a conversion to RGBA reads
+enum class EHdriVaultChannelLayout : uint8
+{
+	Y,		// One luminance plane, copied to R, G and B
+	RGB,	// Alpha reads as one
+	RGBA
+};
+
+/**
+ * Pixel format conversions for decoded EXR data.
+ *
+ * Every kernel has a vector path picked at compile time: F16C and AVX2 when the build targets them,
+ * SSE2 on other x86 builds, and NEON on 64-bit ARM. The scalar versions are the reference and also
+ * handle the pixels left over at the end of a row. The two must give the same bits for everything
+ * except NaN payloads; the HdriVault.PixelKernels automation test and the HdriVault.VerifyPixelKernels
+ * console command check them against each other.
+ */
+class FHdriVaultPixelKernels
+{
+public:
+	static void HalfToFloat(const uint16* Source, float* Dest, int32 Count);
+	static void FloatToHalf(const float* Source, uint16* Dest, int32 Count);
+
+	/**
+	 * Interleaves planar channels into RGBA floats.
+	 * @param Planes - One pointer per plane of Layout, each Count samples of SourceType (uint16 for half)
+	 */
+	template<typename SourceType, EHdriVaultChannelLayout Layout>
+	static void PlanarToRgba(const SourceType* const* Planes, float* Dest, int32 Count);
+
+	// Picks the PlanarToRgba specialization for a pixel type and layout known only at runtime
+	static void PlanarToRgba(const void* const* Planes, EHdriVaultPixelType PixelType, EHdriVaultChannelLayout Layout, float* Dest, int32 Count);
+
+	// Scalar reference versions
+	static float HalfToFloatScalar(uint16 Half);
+	static uint16 FloatToHalfScalar(float Value);
+	static void PlanarToRgbaScalar(const void* const* Planes, EHdriVaultPixelType PixelType, EHdriVaultChannelLayout Layout, float* Dest, int32 Count);
+
+	static int32 GetNumPlanes(EHdriVaultChannelLayout Layout);
+
+	// Name of the vector path compiled in, for logs
+	static const TCHAR* GetVectorPathName();
+};
@@ -0,0 +1,287 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultQuery.h"
+#include "HdriVaultCatalogSnapshot.h"
+
+bool FHdriVaultQueryTerm::MatchesNumber(double InValue) const
+{
+	switch (Op)
+	{
+	case EHdriVaultQueryOp::Less:
+		return InValue < Number;
+	case EHdriVaultQueryOp::LessEqual:
+		return InValue <= Number;
+	case EHdriVaultQueryOp::Greater:
+		return InValue > Number;
+	case EHdriVaultQueryOp::GreaterEqual:
+		return InValue >= Number;
+	default:
+		return InValue == Number;
+	}
+}
+
+bool FHdriVaultQueryTerm::Implies(const FHdriVaultQueryTerm& Other) const
+{
+	if (Field != Other.Field || bNegated != Other.bNegated)
+	{
+		return false;
+	}
+
+	switch (Field)
+	{
+	case EHdriVaultQueryField::Text:
+	case EHdriVaultQueryField::Author:
+	case EHdriVaultQueryField::Category:
+		// Containing a longer string implies containing its substrings; exclusion works the other way round
+		return bNegated ? Other.Value.Contains(Value) : Value.Contains(Other.Value);
+	case EHdriVaultQueryField::Tag:
+		return Value == Other.Value;
+	default:
+		break;
+	}
+
+	if (bNegated || Op != Other.Op)
+	{
+		return Op == Other.Op && Number == Other.Number;
+	}
+
+	// A tighter bound in the same direction narrows the range
+	switch (Op)
+	{
+	case EHdriVaultQueryOp::Less:
+	case EHdriVaultQueryOp::LessEqual:
+		return Number <= Other.Number;
+	case EHdriVaultQueryOp::Greater:
+	case EHdriVaultQueryOp::GreaterEqual:
+		return Number >= Other.Number;
+	default:
+		return Number == Other.Number;
+	}
+}
+
+FHdriVaultQuery FHdriVaultQuery::Parse(const FString& QueryText)
+{
+	FHdriVaultQuery Query;
+
+	TArray<FString> Tokens;
+	Tokenize(QueryText, Tokens);
+
+	for (const FString& Token : Tokens)
+	{
+		FHdriVaultQueryTerm Term;
+		if (Query.ParseToken(Token, Term))
+		{
+			Query.Terms.Add(MoveTemp(Term));
+		}
+		else
+		{
+			Query.bAllTokensParsed = false;
+		}
+	}
+
+	return Query;
+}
+
+void FHdriVaultQuery::Tokenize(const FString& QueryText, TArray<FString>& OutTokens)
+{
+	FString Current;
+	bool bInQuotes = false;
+
+	for (TCHAR Char : QueryText)
+	{
+		if (Char == TEXT('"'))
+		{
+			bInQuotes = !bInQuotes;
+		}
+		else if (FChar::IsWhitespace(Char) && !bInQuotes)
+		{
+			if (!Current.IsEmpty())
+			{
+				OutTokens.Add(MoveTemp(Current));
+				Current.Reset();
+			}
+		}
+		else
+		{
+			Current.AppendChar(Char);
+		}
+	}
+
+	if (!Current.IsEmpty())
+	{
+		OutTokens.Add(MoveTemp(Current));
+	}
+}
+
+bool FHdriVaultQuery::ParseToken(const FString& Token, FHdriVaultQueryTerm& OutTerm)
+{
+	FString Body = Token;
+	if (Body.Len() > 1 && Body[0] == TEXT('-'))
+	{
+		OutTerm.bNegated = true;
+		Body.RightChopInline(1);
+	}
+
+	FString Key;
+	FString Value;
+	if (!Body.Split(TEXT(":"), &Key, &Value) || Key.IsEmpty())
+	{
+		OutTerm.Value = Body.ToLower();
+		return true;
+	}
+
+	static const TMap<FString, EHdriVaultQueryField> FieldNames = {
+		{ TEXT("tag"), EHdriVaultQueryField::Tag },
+		{ TEXT("author"), EHdriVaultQueryField::Author },
+		{ TEXT("category"), EHdriVaultQueryField::Category },
+		{ TEXT("cat"), EHdriVaultQueryField::Category },
+		{ TEXT("res"), EHdriVaultQueryField::Resolution },
+		{ TEXT("ev"), EHdriVaultQueryField::Exposure }
+	};
+
+	const EHdriVaultQueryField* Field = FieldNames.Find(Key);
+	if (!Field)
+	{
+		// Not a known field, so search for the text as typed
+		OutTerm.Value = Body.ToLower();
+		return true;
+	}
+
+	OutTerm.Field = *Field;
+	if (Value.IsEmpty())
+	{
+		return false;
+	}
+
+	if (OutTerm.Field == EHdriVaultQueryField::Exposure)
+	{
+		// Exposure statistics are not collected yet, so the filter cannot be applied
+		Warnings.Add(FString::Printf(TEXT("Ignoring '%s': exposure filters are not supported yet"), *Token));
+		return false;
+	}
+
+	if (!OutTerm.IsNumeric())
+	{
+		OutTerm.Value = Value.ToLower();
+		return true;
+	}
+
+	if (Value.RemoveFromStart(TEXT(">=")))
+	{
+		OutTerm.Op = EHdriVaultQueryOp::GreaterEqual;
+	}
+	else if (Value.RemoveFromStart(TEXT("<=")))
+	{
+		OutTerm.Op = EHdriVaultQueryOp::LessEqual;
+	}
+	else if (Value.RemoveFromStart(TEXT(">")))
+	{
+		OutTerm.Op = EHdriVaultQueryOp::Greater;
+	}
+	else if (Value.RemoveFromStart(TEXT("<")))
+	{
+		OutTerm.Op = EHdriVaultQueryOp::Less;
+	}
+	else
+	{
+		Value.RemoveFromStart(TEXT("="));
+	}
+
+	if (!ParseNumber(Value, OutTerm.Number))
+	{
+		Warnings.Add(FString::Printf(TEXT("Ignoring '%s': '%s' is not a number"), *Token, *Value));
+		return false;
+	}
+
+	return true;
+}
+
+bool FHdriVaultQuery::ParseNumber(const FString& Text, double& OutNumber)
+{
+	FString Digits = Text.ToLower();
+
+	// Resolutions are usually written as 2k, 4k, 8k...
+	double Scale = 1.0;
+	if (Digits.RemoveFromEnd(TEXT("k")))
+	{
+		Scale = 1024.0;
+	}
+
+	if (Digits.IsEmpty() || !Digits.IsNumeric())
+	{
+		return false;
+	}
+
+	OutNumber = FCString::Atod(*Digits) * Scale;
+	return true;
+}
+
+bool FHdriVaultQuery::Matches(const FHdriVaultSnapshotEntry& Entry) const
+{
+	for (const FHdriVaultQueryTerm& Term : Terms)
+	{
+		if (TermMatches(Term, Entry) == Term.bNegated)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool FHdriVaultQuery::TermMatches(const FHdriVaultQueryTerm& Term, const FHdriVaultSnapshotEntry& Entry)
+{
+	switch (Term.Field)
+	{
+	case EHdriVaultQueryField::Text:
+		if (Entry.DisplayName.Contains(Term.Value) || Entry.Notes.Contains(Term.Value)
+			|| Entry.Author.Contains(Term.Value) || Entry.Category.Contains(Term.Value)
+			|| Entry.PackagePath.ToString().Contains(Term.Value))
+		{
+			return true;
+		}
+		for (const FString& Tag : Entry.Tags)
+		{
+			if (Tag.Contains(Term.Value))
+			{
+				return true;
+			}
+		}
+		return false;
+	case EHdriVaultQueryField::Tag:
+		return Entry.Tags.Contains(Term.Value);
+	case EHdriVaultQueryField::Author:
+		return Entry.Author.Contains(Term.Value);
+	case EHdriVaultQueryField::Category:
+		return Entry.Category.Contains(Term.Value);
+	case EHdriVaultQueryField::Resolution:
+		return Term.MatchesNumber(Entry.MaxDimension);
+	default:
+		// Exposure terms are dropped with a warning when parsed
+		return !Term.bNegated;
+	}
+}
+
+bool FHdriVaultQuery::IsRefinementOf(const FString& Previous, const FString& Next)
+{
+	// A dropped token means Previous' results were computed for less than the user typed, e.g. `author:`
+	// before the value arrives; without terms there is nothing to narrow from
+	const FHdriVaultQuery PreviousQuery = Parse(Previous);
+	if (PreviousQuery.Terms.Num() == 0 || !PreviousQuery.bAllTokensParsed)
+	{
+		return false;
+	}
+
+	const FHdriVaultQuery NextQuery = Parse(Next);
+	for (const FHdriVaultQueryTerm& PreviousTerm : PreviousQuery.Terms)
+	{
+		const bool bImplied = NextQuery.Terms.ContainsByPredicate([&PreviousTerm](const FHdriVaultQueryTerm& NextTerm)
+		{
+			return NextTerm.Implies(PreviousTerm);
+		});
+		if (!bImplied)
+		{
+			return false;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,80 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FHdriVaultSnapshotEntry;
+
+enum class EHdriVaultQueryField : uint8
+{
+	Text,
+	Tag,
+	Author,
+	Category,
+	Resolution,
+	Exposure
+};
+
+enum class EHdriVaultQueryOp : uint8
+{
+	Match,
+	Less,
+	LessEqual,
+	Greater,
+	GreaterEqual
+};
+
+struct FHdriVaultQueryTerm
+{
+	EHdriVaultQueryField Field = EHdriVaultQueryField::Text;
+	EHdriVaultQueryOp Op = EHdriVaultQueryOp::Match;
+
+	// Lower-case value for text fields
+	FString Value;
+
+	// Parsed value for numeric fields
+	double Number = 0.0;
+
+	bool bNegated = false;
+
+	bool IsNumeric() const { return Field == EHdriVaultQueryField::Resolution || Field == EHdriVaultQueryField::Exposure; }
+	bool MatchesNumber(double InValue) const;
+
+	// True when every entry matching this term also matches Other
+	bool Implies(const FHdriVaultQueryTerm& Other) const;
+};
+
+/**
+ * Parsed vault search expression, e.g. `tag:overcast author:jdoe res:>=8k category:Studio sunset`.
+ * Bare words are free text, `-` negates a term and double quotes group words with spaces.
+ * `res:` compares the long-lat width of the source image, not the size of a cube face.
+ */
+class FHdriVaultQuery
+{
+public:
+	static FHdriVaultQuery Parse(const FString& QueryText);
+
+	const TArray<FHdriVaultQueryTerm>& GetTerms() const { return Terms; }
+	const TArray<FString>& GetWarnings() const { return Warnings; }
+	bool IsEmpty() const { return Terms.Num() == 0; }
+
+	// Evaluates every term against a snapshot entry; safe to call from worker threads
+	bool Matches(const FHdriVaultSnapshotEntry& Entry) const;
+
+	// True when every item matching Next also matches Previous, so Next can be answered from Previous' results.
+	// Both are parsed, and every term of Previous must be implied by a term of Next.
+	static bool IsRefinementOf(const FString& Previous, const FString& Next);
+
+private:
+	static void Tokenize(const FString& QueryText, TArray<FString>& OutTokens);
+	bool ParseToken(const FString& Token, FHdriVaultQueryTerm& OutTerm);
+	static bool ParseNumber(const FString& Text, double& OutNumber);
+	static bool TermMatches(const FHdriVaultQueryTerm& Term, const FHdriVaultSnapshotEntry& Entry);
+
+	TArray<FHdriVaultQueryTerm> Terms;
+	TArray<FString> Warnings;
+
+	// False when a token was dropped, e.g. a field with no value yet
+	bool bAllTokensParsed = true;
+};
@@ -0,0 +1,163 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultRefreshScheduler.h"
+#include "HdriVaultWorkScheduler.h"
+#include "Editor.h"
+#include "ShaderCompiler.h"
+#include "AssetCompilingManager.h"
+#include "HAL/PlatformTime.h"
+
+namespace HdriVaultRefreshSchedulerUtils
+{
+	// Shortest interval honoured, so a zero setting cannot turn into back-to-back passes
+	static constexpr float MinIntervalSeconds = 1.0f;
+}
+
+FHdriVaultRefreshScheduler::FHdriVaultRefreshScheduler()
+	: bIsInitialized(false)
+{
+}
+
+FHdriVaultRefreshScheduler::~FHdriVaultRefreshScheduler()
+{
+	if (bIsInitialized)
+	{
+		Shutdown();
+	}
+}
+
+void FHdriVaultRefreshScheduler::Initialize(const TSharedRef<FHdriVaultWorkScheduler>& InWorkScheduler)
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	WorkScheduler = InWorkScheduler;
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FHdriVaultRefreshScheduler::Tick));
+
+	NextPassTime = FPlatformTime::Seconds() + IntervalSeconds;
+	bIsInitialized = true;
+}
+
+void FHdriVaultRefreshScheduler::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	CancelPass();
+	bPassRequested = false;
+	WorkScheduler.Reset();
+	bIsInitialized = false;
+}
+
+void FHdriVaultRefreshScheduler::SetAutoRefresh(bool bInEnabled, float InIntervalSeconds)
+{
+	const float NewInterval = FMath::Max(InIntervalSeconds, HdriVaultRefreshSchedulerUtils::MinIntervalSeconds);
+	if (bInEnabled == bEnabled && NewInterval == IntervalSeconds)
+	{
+		return;
+	}
+
+	bEnabled = bInEnabled;
+	IntervalSeconds = NewInterval;
+	NextPassTime = FPlatformTime::Seconds() + IntervalSeconds;
+}
+
+void FHdriVaultRefreshScheduler::RequestPass()
+{
+	bPassRequested = true;
+}
+
+void FHdriVaultRefreshScheduler::CancelPass()
+{
+	bPassRunning = false;
+	bStepQueued = false;
+	++PassSerial;
+	NextPassTime = FPlatformTime::Seconds() + IntervalSeconds;
+}
+
+bool FHdriVaultRefreshScheduler::IsEditorBusy()
+{
+	if (GIsSlowTask || IsGarbageCollecting())
+	{
+		return true;
+	}
+
+	if (GEditor && (GEditor->PlayWorld != nullptr || GEditor->bIsSimulatingInEditor))
+	{
+		return true;
+	}
+
+	if (GShaderCompilingManager && GShaderCompilingManager->IsCompiling())
+	{
+		return true;
+	}
+
+	return FAssetCompilingManager::Get().GetNumRemainingAssets() > 0;
+}
+
+bool FHdriVaultRefreshScheduler::Tick(float DeltaTime)
+{
+	if (bStepQueued || IsEditorBusy())
+	{
+		return true;
+	}
+
+	if (!bPassRunning)
+	{
+		const bool bIntervalElapsed = bEnabled && FPlatformTime::Seconds() >= NextPassTime;
+		if (!bPassRequested && !bIntervalElapsed)
+		{
+			return true;
+		}
+
+		bPassRequested = false;
+		bPassRunning = true;
+		++PassSerial;
+		OnBeginPass.ExecuteIfBound();
+	}
+
+	// One step in flight at a time; it shares the frame budget with the rest of the vault's work
+	if (TSharedPtr<FHdriVaultWorkScheduler> PinnedWorkScheduler = WorkScheduler.Pin())
+	{
+		bStepQueued = true;
+		PinnedWorkScheduler->Enqueue(EHdriVaultWorkPriority::Background, [WeakThis = AsWeak(), StepPassSerial = PassSerial]()
+		{
+			if (TSharedPtr<FHdriVaultRefreshScheduler> This = WeakThis.Pin())
+			{
+				This->RunStep(StepPassSerial);
+			}
+		});
+	}
+
+	return true;
+}
+
+void FHdriVaultRefreshScheduler::RunStep(uint32 StepPassSerial)
+{
+	if (StepPassSerial != PassSerial || !bPassRunning)
+	{
+		return;
+	}
+	bStepQueued = false;
+
+	TSharedPtr<FHdriVaultWorkScheduler> PinnedWorkScheduler = WorkScheduler.Pin();
+	const double Deadline = PinnedWorkScheduler.IsValid() ? PinnedWorkScheduler->GetFrameDeadline() : FPlatformTime::Seconds();
+
+	const bool bPassComplete = !OnStep.IsBound() || OnStep.Execute(Deadline);
+	if (bPassComplete)
+	{
+		bPassRunning = false;
+
+		// The interval counts from the end of a pass so a slow pass never queues up behind itself
+		NextPassTime = FPlatformTime::Seconds() + IntervalSeconds;
+	}
+}
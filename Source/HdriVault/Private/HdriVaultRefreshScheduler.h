@@ -0,0 +1,66 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+
+class FHdriVaultWorkScheduler;
+
+/**
+ * Drives the vault's background reconciliation.
+ *
+ * A pass is started every RefreshInterval seconds while auto refresh is enabled, then advanced a
+ * slice at a time as background work on the vault's work scheduler, within its frame budget.
+ * Nothing is queued while the editor is busy (PIE, shader or asset compilation, slow tasks); a
+ * pass in progress resumes once it is idle again.
+ */
+class FHdriVaultRefreshScheduler : public TSharedFromThis<FHdriVaultRefreshScheduler>
+{
+public:
+	// Does work until the platform time passes Deadline. Returns true once the pass is complete.
+	DECLARE_DELEGATE_RetVal_OneParam(bool, FOnStep, double /*Deadline*/);
+	DECLARE_DELEGATE(FOnBeginPass);
+
+	FHdriVaultRefreshScheduler();
+	~FHdriVaultRefreshScheduler();
+
+	// Initialize/cleanup. Shutdown abandons any pass in progress.
+	void Initialize(const TSharedRef<FHdriVaultWorkScheduler>& InWorkScheduler);
+	void Shutdown();
+
+	void SetAutoRefresh(bool bInEnabled, float InIntervalSeconds);
+
+	// Starts a pass on the next idle frame instead of waiting for the interval
+	void RequestPass();
+
+	// Abandons the pass in progress; the next one starts after a full interval
+	void CancelPass();
+
+	bool IsPassRunning() const { return bPassRunning; }
+
+	// Fired before the first step of each pass, then repeatedly until a step reports completion
+	FOnBeginPass OnBeginPass;
+	FOnStep OnStep;
+
+	static bool IsEditorBusy();
+
+private:
+	bool Tick(float DeltaTime);
+	void RunStep(uint32 StepPassSerial);
+
+	TWeakPtr<FHdriVaultWorkScheduler> WorkScheduler;
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	bool bEnabled = false;
+	float IntervalSeconds = 5.0f;
+	double NextPassTime = 0.0;
+	bool bPassRunning = false;
+	bool bPassRequested = false;
+	bool bStepQueued = false;
+
+	// Identifies the running pass, so steps queued for an abandoned pass do nothing
+	uint32 PassSerial = 0;
+
+	bool bIsInitialized = false;
+};
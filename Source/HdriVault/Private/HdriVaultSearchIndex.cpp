@@ -0,0 +1,287 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultSearchIndex.h"
+#include "Algo/BinarySearch.h"
+
+void FHdriVaultSearchIndex::Reset()
+{
+	Documents.Empty();
+	DocumentIds.Empty();
+	TrigramPostings.Empty();
+	TokenPostings.Empty();
+	SortedTokens.Empty();
+	bSortedTokensDirty = true;
+}
+
+void FHdriVaultSearchIndex::IndexItem(FHdriVaultItemHandle Handle, const FHdriVaultMaterialItem& Item)
+{
+	RemoveItem(Handle);
+
+	FDocument Document;
+	Document.Handle = Handle;
+	Document.Fields.Add(Item.GetDisplayName().ToLower());
+	Document.Fields.Add(Item.GetPackagePath().ToLower());
+	Document.Fields.Add(Item.Metadata.Notes.ToLower());
+	Document.Fields.Add(Item.Metadata.Author.ToLower());
+	Document.Fields.Add(Item.Metadata.Category.ToLower());
+	for (const FString& Tag : Item.Metadata.Tags)
+	{
+		Document.Fields.Add(Tag.ToLower());
+	}
+
+	// Grams never span two fields, so a match always lies inside one of them
+	TSet<FTrigram> UniqueTrigrams;
+	TSet<FString> UniqueTokens;
+	TArray<FString> FieldTokens;
+	for (const FString& Field : Document.Fields)
+	{
+		for (int32 Index = 0; Index < Field.Len(); ++Index)
+		{
+			UniqueTrigrams.Add(MakeTrigram(0, 0, Field[Index]));
+			if (Index + 1 < Field.Len())
+			{
+				UniqueTrigrams.Add(MakeTrigram(0, Field[Index], Field[Index + 1]));
+			}
+			if (Index + 2 < Field.Len())
+			{
+				UniqueTrigrams.Add(MakeTrigram(Field[Index], Field[Index + 1], Field[Index + 2]));
+			}
+		}
+
+		FieldTokens.Reset();
+		Tokenize(Field, FieldTokens);
+		UniqueTokens.Append(FieldTokens);
+	}
+
+	Document.Trigrams = UniqueTrigrams.Array();
+	Document.Tokens = UniqueTokens.Array();
+
+	const int32 DocumentId = Documents.Add(MoveTemp(Document));
+	DocumentIds.Add(Handle, DocumentId);
+
+	const FDocument& Added = Documents[DocumentId];
+	for (FTrigram Trigram : Added.Trigrams)
+	{
+		AddPosting(TrigramPostings.FindOrAdd(Trigram), DocumentId);
+	}
+	for (const FString& Token : Added.Tokens)
+	{
+		TArray<int32>& Postings = TokenPostings.FindOrAdd(Token);
+		bSortedTokensDirty |= Postings.Num() == 0;
+		AddPosting(Postings, DocumentId);
+	}
+}
+
+void FHdriVaultSearchIndex::RemoveItem(FHdriVaultItemHandle Handle)
+{
+	int32 DocumentId = INDEX_NONE;
+	if (!DocumentIds.RemoveAndCopyValue(Handle, DocumentId))
+	{
+		return;
+	}
+
+	const FDocument& Document = Documents[DocumentId];
+	for (FTrigram Trigram : Document.Trigrams)
+	{
+		if (TArray<int32>* Postings = TrigramPostings.Find(Trigram))
+		{
+			RemovePosting(*Postings, DocumentId);
+			if (Postings->Num() == 0)
+			{
+				TrigramPostings.Remove(Trigram);
+			}
+		}
+	}
+	for (const FString& Token : Document.Tokens)
+	{
+		if (TArray<int32>* Postings = TokenPostings.Find(Token))
+		{
+			RemovePosting(*Postings, DocumentId);
+			if (Postings->Num() == 0)
+			{
+				TokenPostings.Remove(Token);
+				bSortedTokensDirty = true;
+			}
+		}
+	}
+
+	Documents.RemoveAt(DocumentId);
+}
+
+void FHdriVaultSearchIndex::Search(const FString& Term, TArray<FHdriVaultItemHandle>& OutHandles, bool bPrefixOnly) const
+{
+	const FString LowerTerm = Term.ToLower();
+	if (LowerTerm.IsEmpty())
+	{
+		return;
+	}
+
+	TArray<int32> Candidates;
+	bool bNeedsVerification = true;
+
+	bool bSingleToken = true;
+	for (TCHAR Char : LowerTerm)
+	{
+		bSingleToken &= FChar::IsAlnum(Char);
+	}
+
+	if (LowerTerm.Len() >= 3)
+	{
+		SearchTrigrams(LowerTerm, Candidates);
+	}
+	else if (bPrefixOnly && bSingleToken)
+	{
+		// Tokens starting with the term form one run in the sorted dictionary
+		SearchTokenPrefix(LowerTerm, Candidates);
+		bNeedsVerification = false;
+	}
+	else
+	{
+		// Every one- and two-character substring has its own postings, so only word starts need checking
+		const FTrigram Gram = LowerTerm.Len() == 1 ? MakeTrigram(0, 0, LowerTerm[0]) : MakeTrigram(0, LowerTerm[0], LowerTerm[1]);
+		if (const TArray<int32>* Postings = TrigramPostings.Find(Gram))
+		{
+			Candidates = *Postings;
+		}
+		bNeedsVerification = bPrefixOnly;
+	}
+
+	OutHandles.Reserve(OutHandles.Num() + Candidates.Num());
+	for (int32 DocumentId : Candidates)
+	{
+		const FDocument& Document = Documents[DocumentId];
+		if (!bNeedsVerification || DocumentContains(Document, LowerTerm, bPrefixOnly))
+		{
+			OutHandles.Add(Document.Handle);
+		}
+	}
+}
+
+FHdriVaultSearchIndex::FTrigram FHdriVaultSearchIndex::MakeTrigram(TCHAR A, TCHAR B, TCHAR C)
+{
+	return (uint64(uint32(A) & 0x1FFFFF) << 42) | (uint64(uint32(B) & 0x1FFFFF) << 21) | uint64(uint32(C) & 0x1FFFFF);
+}
+
+void FHdriVaultSearchIndex::Tokenize(const FString& Field, TArray<FString>& OutTokens)
+{
+	int32 TokenStart = INDEX_NONE;
+	for (int32 Index = 0; Index <= Field.Len(); ++Index)
+	{
+		const bool bIsTokenChar = Index < Field.Len() && FChar::IsAlnum(Field[Index]);
+		if (bIsTokenChar && TokenStart == INDEX_NONE)
+		{
+			TokenStart = Index;
+		}
+		else if (!bIsTokenChar && TokenStart != INDEX_NONE)
+		{
+			OutTokens.Add(Field.Mid(TokenStart, Index - TokenStart));
+			TokenStart = INDEX_NONE;
+		}
+	}
+}
+
+void FHdriVaultSearchIndex::AddPosting(TArray<int32>& Postings, int32 DocumentId)
+{
+	const int32 InsertIndex = Algo::LowerBound(Postings, DocumentId);
+	if (!Postings.IsValidIndex(InsertIndex) || Postings[InsertIndex] != DocumentId)
+	{
+		Postings.Insert(DocumentId, InsertIndex);
+	}
+}
+
+void FHdriVaultSearchIndex::RemovePosting(TArray<int32>& Postings, int32 DocumentId)
+{
+	const int32 FoundIndex = Algo::BinarySearch(Postings, DocumentId);
+	if (FoundIndex != INDEX_NONE)
+	{
+		Postings.RemoveAt(FoundIndex, 1, EAllowShrinking::No);
+	}
+}
+
+void FHdriVaultSearchIndex::SearchTrigrams(const FString& LowerTerm, TArray<int32>& OutDocumentIds) const
+{
+	TArray<const TArray<int32>*> Lists;
+	for (int32 Index = 0; Index + 2 < LowerTerm.Len(); ++Index)
+	{
+		const TArray<int32>* Postings = TrigramPostings.Find(MakeTrigram(LowerTerm[Index], LowerTerm[Index + 1], LowerTerm[Index + 2]));
+		if (!Postings)
+		{
+			// A trigram nobody has means nothing can match
+			return;
+		}
+		Lists.AddUnique(Postings);
+	}
+
+	// Intersect starting from the rarest trigram so the working set stays small
+	Lists.Sort([](const TArray<int32>& A, const TArray<int32>& B) { return A.Num() < B.Num(); });
+
+	OutDocumentIds = *Lists[0];
+	for (int32 ListIndex = 1; ListIndex < Lists.Num() && OutDocumentIds.Num() > 0; ++ListIndex)
+	{
+		const TArray<int32>& Other = *Lists[ListIndex];
+		int32 WriteIndex = 0;
+		int32 OtherIndex = 0;
+		for (int32 ReadIndex = 0; ReadIndex < OutDocumentIds.Num(); ++ReadIndex)
+		{
+			const int32 DocumentId = OutDocumentIds[ReadIndex];
+			while (OtherIndex < Other.Num() && Other[OtherIndex] < DocumentId)
+			{
+				++OtherIndex;
+			}
+			if (OtherIndex < Other.Num() && Other[OtherIndex] == DocumentId)
+			{
+				OutDocumentIds[WriteIndex++] = DocumentId;
+			}
+		}
+		OutDocumentIds.SetNum(WriteIndex, EAllowShrinking::No);
+	}
+}
+
+void FHdriVaultSearchIndex::SearchTokenPrefix(const FString& LowerTerm, TArray<int32>& OutDocumentIds) const
+{
+	UpdateSortedTokens();
+
+	// Tokens sharing the prefix form one contiguous run in the sorted dictionary
+	TSet<int32> Matches;
+	for (int32 Index = Algo::LowerBound(SortedTokens, LowerTerm); Index < SortedTokens.Num() && SortedTokens[Index].StartsWith(LowerTerm, ESearchCase::CaseSensitive); ++Index)
+	{
+		Matches.Append(TokenPostings.FindChecked(SortedTokens[Index]));
+	}
+
+	OutDocumentIds = Matches.Array();
+	OutDocumentIds.Sort();
+}
+
+bool FHdriVaultSearchIndex::DocumentContains(const FDocument& Document, const FString& LowerTerm, bool bPrefixOnly) const
+{
+	for (const FString& Field : Document.Fields)
+	{
+		int32 SearchFrom = 0;
+		while (true)
+		{
+			const int32 FoundIndex = Field.Find(LowerTerm, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom);
+			if (FoundIndex == INDEX_NONE)
+			{
+				break;
+			}
+			if (!bPrefixOnly || FoundIndex == 0 || !FChar::IsAlnum(Field[FoundIndex - 1]))
+			{
+				return true;
+			}
+			SearchFrom = FoundIndex + 1;
+		}
+	}
+	return false;
+}
+
+void FHdriVaultSearchIndex::UpdateSortedTokens() const
+{
+	if (!bSortedTokensDirty)
+	{
+		return;
+	}
+
+	TokenPostings.GetKeys(SortedTokens);
+	SortedTokens.Sort([](const FString& A, const FString& B) { return A.Compare(B, ESearchCase::CaseSensitive) < 0; });
+	bSortedTokensDirty = false;
+}
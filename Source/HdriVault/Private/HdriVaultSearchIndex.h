@@ -0,0 +1,67 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/SparseArray.h"
+#include "HdriVaultTypes.h"
+
+/**
+ * Case-insensitive full-text index over the searchable fields of vault items
+ * (name, package path, tags, notes, author and category).
+ *
+ * Substring queries of three or more characters are answered from a trigram index, shorter ones
+ * from one- and two-character postings, and short prefix queries from a token dictionary.
+ */
+class FHdriVaultSearchIndex
+{
+public:
+	void Reset();
+
+	// Add or re-index an item
+	void IndexItem(FHdriVaultItemHandle Handle, const FHdriVaultMaterialItem& Item);
+	void RemoveItem(FHdriVaultItemHandle Handle);
+
+	/**
+	 * Finds items whose searchable text contains Term.
+	 * @param Term - Text to look for, case-insensitive
+	 * @param OutHandles - Handles of matching items
+	 * @param bPrefixOnly - Only match at the start of a word
+	 */
+	void Search(const FString& Term, TArray<FHdriVaultItemHandle>& OutHandles, bool bPrefixOnly = false) const;
+
+	int32 Num() const { return DocumentIds.Num(); }
+
+private:
+	using FTrigram = uint64;
+
+	struct FDocument
+	{
+		FHdriVaultItemHandle Handle;
+		TArray<FString> Fields; // Lower-case
+		TArray<FTrigram> Trigrams;
+		TArray<FString> Tokens;
+	};
+
+	static FTrigram MakeTrigram(TCHAR A, TCHAR B, TCHAR C);
+	static void Tokenize(const FString& Field, TArray<FString>& OutTokens);
+	static void AddPosting(TArray<int32>& Postings, int32 DocumentId);
+	static void RemovePosting(TArray<int32>& Postings, int32 DocumentId);
+
+	void SearchTrigrams(const FString& LowerTerm, TArray<int32>& OutDocumentIds) const;
+	void SearchTokenPrefix(const FString& LowerTerm, TArray<int32>& OutDocumentIds) const;
+	bool DocumentContains(const FDocument& Document, const FString& LowerTerm, bool bPrefixOnly) const;
+	void UpdateSortedTokens() const;
+
+	TSparseArray<FDocument> Documents;
+	TMap<FHdriVaultItemHandle, int32> DocumentIds;
+
+	// Sorted document id lists. One- and two-character grams are padded with NUL, which never occurs
+	// in text, so they share the trigram keys.
+	TMap<FTrigram, TArray<int32>> TrigramPostings;
+	TMap<FString, TArray<int32>> TokenPostings;
+
+	// Token dictionary in sorted order for prefix lookups, rebuilt lazily after changes
+	mutable TArray<FString> SortedTokens;
+	mutable bool bSortedTokensDirty = true;
+};
@@ -15,6 +15,8 @@
 #include "Slate/SlateTextures.h"
 #include "TextureResource.h"
 #include "Async/Async.h"
+#include "HAL/PlatformTime.h"
+#include "HdriVaultWorkScheduler.h"
 #include "Misc/FileHelper.h"
 #include "Misc/Paths.h"
 #include "HAL/FileManager.h"
@@ -89,6 +91,8 @@ void FHdriVaultThumbnailManager::Initialize()
 	DefaultMaterialTexture = LoadObject<UTexture2D>(nullptr, TEXT("/Engine/EditorMaterials/DefaultMaterial"));
 	ErrorTexture = LoadObject<UTexture2D>(nullptr, TEXT("/Engine/EditorMaterials/DefaultDiffuse"));
 	
+	Completions = MakeShared<FCompletionQueue, ESPMode::ThreadSafe>();
+	
 	bIsInitialized = true;
 }
 
@@ -99,6 +103,9 @@ void FHdriVaultThumbnailManager::Shutdown()
 		return;
 	}
 	
+	// Loads still in flight find the queue gone and drop their results
+	Completions.Reset();
+	
 	// Clear cache
 	ClearThumbnailCache();
 	PendingThumbnails.Empty();
@@ -116,7 +123,7 @@ TSharedPtr<FSlateBrush> FHdriVaultThumbnailManager::GetMaterialThumbnail(TShared
 		return nullptr;
 	}
 	
-	FString CacheKey = GetCacheKey(MaterialItem->AssetData.GetObjectPathString(), ThumbnailSize);
+	FString CacheKey = GetCacheKey(MaterialItem->GetObjectPath().ToString(), ThumbnailSize);
 	
 	// Check cache first
 	if (ThumbnailCache.Contains(CacheKey))
@@ -145,7 +152,7 @@ void FHdriVaultThumbnailManager::RequestThumbnail(TSharedPtr<FHdriVaultMaterialI
 		return;
 	}
 	
-	FString MaterialPath = MaterialItem->AssetData.GetObjectPathString();
+	FString MaterialPath = MaterialItem->GetObjectPath().ToString();
 	
 	// Check if already pending
 	if (PendingThumbnails.Contains(MaterialPath))
@@ -389,27 +396,110 @@ void FHdriVaultThumbnailManager::LoadThumbnailAsync(TSharedPtr<FHdriVaultMateria
 		return;
 	}
 	
-	FString MaterialPath = MaterialItem->AssetData.GetObjectPathString();
+	FString MaterialPath = MaterialItem->GetObjectPath().ToString();
+	PendingThumbnails.Add(MaterialPath, MaterialItem);
 	
-	// Load material asynchronously
-	AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this, MaterialItem, ThumbnailSize, MaterialPath]()
+	// Load through the async loader; generation touches UObjects and can be slow, so finished loads are
+	// batched onto the game thread within the frame budget rather than handled one task at a time
+	TWeakPtr<FCompletionQueue, ESPMode::ThreadSafe> WeakCompletions = Completions;
+	MaterialItem->MaterialPtr.ToSoftObjectPath().LoadAsync(FLoadSoftObjectPathAsyncDelegate::CreateLambda(
+		[this, WeakCompletions, ThumbnailSize, MaterialPath](const FSoftObjectPath&, UObject* LoadedAsset)
+		{
+			if (WeakCompletions.IsValid())
+			{
+				QueueCompletion({ MaterialPath, LoadedAsset, ThumbnailSize });
+			}
+		}));
+}
+
+void FHdriVaultThumbnailManager::QueueCompletion(FThumbnailCompletion&& Completion)
+{
+	Completions->Queue.Enqueue(MoveTemp(Completion));
+	
+	// Only the first result since the last drain schedules one
+	if (!Completions->bDrainScheduled.exchange(true))
 	{
-		UObject* Asset = MaterialItem->MaterialPtr.LoadSynchronous();
-		TWeakObjectPtr<UObject> WeakAsset(Asset);
+		ScheduleCompletionDrain();
+	}
+}
 
-		AsyncTask(ENamedThreads::GameThread, [this, WeakAsset, ThumbnailSize, MaterialPath]()
+void FHdriVaultThumbnailManager::ScheduleCompletionDrain()
+{
+	TSharedPtr<FHdriVaultWorkScheduler> PinnedWorkScheduler = WorkScheduler.Pin();
+	if (!PinnedWorkScheduler.IsValid())
+	{
+		AsyncTask(ENamedThreads::GameThread, [this, WeakCompletions = TWeakPtr<FCompletionQueue, ESPMode::ThreadSafe>(Completions)]()
 		{
-			if (UObject* StrongAsset = WeakAsset.Get())
+			if (WeakCompletions.IsValid())
 			{
-				if (UTexture2D* Thumbnail = GenerateMaterialThumbnail(StrongAsset, ThumbnailSize))
-				{
-					UpdateCacheWithThumbnail(MaterialPath, Thumbnail, ThumbnailSize);
-				}
+				DrainCompletions(TNumericLimits<double>::Max());
 			}
-
-			PendingThumbnails.Remove(MaterialPath);
 		});
-	});
+		return;
+	}
+	
+	PinnedWorkScheduler->Enqueue(EHdriVaultWorkPriority::Visible,
+		[this, WeakCompletions = TWeakPtr<FCompletionQueue, ESPMode::ThreadSafe>(Completions), WeakWorkScheduler = WorkScheduler]()
+		{
+			// Shutdown resets the queue on the game thread, so a live queue means a live manager
+			TSharedPtr<FHdriVaultWorkScheduler> PinnedWorkScheduler = WeakWorkScheduler.Pin();
+			if (WeakCompletions.IsValid() && PinnedWorkScheduler.IsValid())
+			{
+				DrainCompletions(PinnedWorkScheduler->GetFrameDeadline());
+			}
+		});
+}
+
+void FHdriVaultThumbnailManager::DrainCompletions(double Deadline)
+{
+	bool bProcessedAny = false;
+	FThumbnailCompletion Completion;
+	while ((!bProcessedAny || FPlatformTime::Seconds() < Deadline) && Completions->Queue.Dequeue(Completion))
+	{
+		ProcessCompletion(Completion);
+		bProcessedAny = true;
+	}
+	
+	// Clear the flag before re-checking, so a result queued in between is never stranded
+	Completions->bDrainScheduled = false;
+	if (!Completions->Queue.IsEmpty() && !Completions->bDrainScheduled.exchange(true))
+	{
+		ScheduleCompletionDrain();
+	}
+}
+
+void FHdriVaultThumbnailManager::ProcessCompletion(const FThumbnailCompletion& Completion)
+{
+	// Cancelled while queued
+	if (!PendingThumbnails.Contains(Completion.MaterialPath))
+	{
+		return;
+	}
+	
+	if (UObject* Asset = Completion.Asset.Get())
+	{
+		if (UTexture2D* Thumbnail = GenerateMaterialThumbnail(Asset, Completion.ThumbnailSize))
+		{
+			UpdateCacheWithThumbnail(Completion.MaterialPath, Thumbnail, Completion.ThumbnailSize);
+		}
+	}
+	
+	PendingThumbnails.Remove(Completion.MaterialPath);
+}
+
+void FHdriVaultThumbnailManager::CancelPendingThumbnails()
+{
+	PendingThumbnails.Empty();
+	
+	// The scheduled drain may have been cancelled along with other queued work
+	if (Completions.IsValid())
+	{
+		FThumbnailCompletion Completion;
+		while (Completions->Queue.Dequeue(Completion))
+		{
+		}
+		Completions->bDrainScheduled = false;
+	}
 }
 
 void FHdriVaultThumbnailManager::SetThumbnailSize(int32 NewSize)
@@ -0,0 +1,10 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultTypes.h"
+#include "AssetRegistry/IAssetRegistry.h"
+
+FAssetData FHdriVaultMaterialItem::GetAssetData() const
+{
+	IAssetRegistry* AssetRegistry = IAssetRegistry::Get();
+	return AssetRegistry ? AssetRegistry->GetAssetByObjectPath(GetObjectPath()) : FAssetData();
+}
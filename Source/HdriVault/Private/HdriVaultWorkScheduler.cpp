@@ -0,0 +1,99 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultWorkScheduler.h"
+#include "HAL/PlatformTime.h"
+
+namespace HdriVaultWorkSchedulerUtils
+{
+	// Game thread time the queue may use per frame
+	static constexpr double FrameBudgetSeconds = 0.003;
+}
+
+FHdriVaultWorkScheduler::FHdriVaultWorkScheduler()
+	: bIsInitialized(false)
+{
+}
+
+FHdriVaultWorkScheduler::~FHdriVaultWorkScheduler()
+{
+	if (bIsInitialized)
+	{
+		Shutdown();
+	}
+}
+
+void FHdriVaultWorkScheduler::Initialize()
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateRaw(this, &FHdriVaultWorkScheduler::Tick));
+
+	bIsInitialized = true;
+}
+
+void FHdriVaultWorkScheduler::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	TickerHandle.Reset();
+
+	CancelAll();
+
+	bIsInitialized = false;
+}
+
+void FHdriVaultWorkScheduler::Enqueue(EHdriVaultWorkPriority Priority, TUniqueFunction<void()>&& Work)
+{
+	check(Priority < EHdriVaultWorkPriority::Num);
+
+	NumQueued.fetch_add(1, std::memory_order_relaxed);
+	Queues[static_cast<int32>(Priority)].Enqueue(MoveTemp(Work));
+}
+
+void FHdriVaultWorkScheduler::CancelAll()
+{
+	check(IsInGameThread());
+
+	TUniqueFunction<void()> Work;
+	for (TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc>& Queue : Queues)
+	{
+		while (Queue.Dequeue(Work))
+		{
+			NumQueued.fetch_sub(1, std::memory_order_relaxed);
+		}
+	}
+}
+
+bool FHdriVaultWorkScheduler::Tick(float DeltaTime)
+{
+	FrameDeadline = FPlatformTime::Seconds() + HdriVaultWorkSchedulerUtils::FrameBudgetSeconds;
+
+	bool bRanAny = false;
+	TUniqueFunction<void()> Work;
+	for (TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc>& Queue : Queues)
+	{
+		// Work queued while draining runs this frame only if its queue has not been passed yet
+		while ((!bRanAny || FPlatformTime::Seconds() < FrameDeadline) && Queue.Dequeue(Work))
+		{
+			NumQueued.fetch_sub(1, std::memory_order_relaxed);
+			Work();
+			Work.Reset();
+			bRanAny = true;
+		}
+
+		if (bRanAny && FPlatformTime::Seconds() >= FrameDeadline)
+		{
+			break;
+		}
+	}
+
+	return true;
+}
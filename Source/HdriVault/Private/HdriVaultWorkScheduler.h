@@ -0,0 +1,58 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include <atomic>
+
+// Order in which queued game-thread work is drained each frame
+enum class EHdriVaultWorkPriority : uint8
+{
+	Interactive,	// The user is waiting on it (search results)
+	Visible,		// Feeds something on screen (thumbnails)
+	Background,		// Maintenance nobody is looking at (reconciliation)
+	Num
+};
+
+/**
+ * Single queue for the vault's game-thread work.
+ *
+ * Work can be queued from any thread and runs on the game thread from a core ticker, highest
+ * priority first, until the frame budget is spent. At least one item runs per frame so a long
+ * item can never stall the queue entirely.
+ */
+class FHdriVaultWorkScheduler
+{
+public:
+	FHdriVaultWorkScheduler();
+	~FHdriVaultWorkScheduler();
+
+	// Initialize/cleanup. Shutdown drops anything still queued.
+	void Initialize();
+	void Shutdown();
+
+	// Safe to call from any thread
+	void Enqueue(EHdriVaultWorkPriority Priority, TUniqueFunction<void()>&& Work);
+
+	// Drops all queued work without running it. Game thread only.
+	void CancelAll();
+
+	int32 GetNumQueued() const { return NumQueued.load(std::memory_order_relaxed); }
+
+	// Platform time at which the current frame's budget runs out; work that can be sliced stops there
+	double GetFrameDeadline() const { return FrameDeadline; }
+
+private:
+	bool Tick(float DeltaTime);
+
+	TQueue<TUniqueFunction<void()>, EQueueMode::Mpsc> Queues[static_cast<int32>(EHdriVaultWorkPriority::Num)];
+	std::atomic<int32> NumQueued { 0 };
+
+	double FrameDeadline = 0.0;
+
+	FTSTicker::FDelegateHandle TickerHandle;
+
+	bool bIsInitialized = false;
+};
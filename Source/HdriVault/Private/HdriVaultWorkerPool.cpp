@@ -0,0 +1,224 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#include "HdriVaultWorkerPool.h"
+#include "Misc/QueuedThreadPool.h"
+#include "Misc/IQueuedWork.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMisc.h"
+#include "Misc/ScopeLock.h"
+
+namespace HdriVaultWorkerPoolUtils
+{
+	static int32 WorkerThreads = 0;
+	static FAutoConsoleVariableRef CVarWorkerThreads(
+		TEXT("HdriVault.WorkerThreads"),
+		WorkerThreads,
+		TEXT("Threads in the Hdri Vault worker pool. 0 uses half the logical cores, at most 8. Read when the pool starts."),
+		ECVF_Default);
+
+	static int32 MaxActiveWorkers = 0;
+	static FAutoConsoleVariableRef CVarMaxActiveWorkers(
+		TEXT("HdriVault.MaxActiveWorkers"),
+		MaxActiveWorkers,
+		TEXT("Caps how many Hdri Vault workers run at once, to limit CPU use on shared workstations. 0 uses every pool thread."),
+		ECVF_Default);
+
+	static constexpr uint32 StackSize = 256 * 1024;
+}
+
+class FHdriVaultWorkerPool::FQueuedTask : public IQueuedWork
+{
+public:
+	FQueuedTask(FHdriVaultWorkerPool& InOwner, TUniqueFunction<void()>&& InWork)
+		: Owner(InOwner)
+		, Work(MoveTemp(InWork))
+	{
+	}
+
+	virtual void DoThreadedWork() override
+	{
+		Work();
+		Promise.SetValue();
+
+		FHdriVaultWorkerPool& PoolOwner = Owner;
+		delete this;
+		PoolOwner.OnTaskFinished();
+	}
+
+	virtual void Abandon() override
+	{
+		Promise.SetValue();
+		delete this;
+	}
+
+	virtual const TCHAR* GetDebugName() const override
+	{
+		return TEXT("HdriVaultWorkerTask");
+	}
+
+	FHdriVaultWorkerPool& Owner;
+	TUniqueFunction<void()> Work;
+	TPromise<void> Promise;
+};
+
+FHdriVaultWorkerPool::FHdriVaultWorkerPool()
+	: bIsInitialized(false)
+{
+}
+
+FHdriVaultWorkerPool::~FHdriVaultWorkerPool()
+{
+	if (bIsInitialized)
+	{
+		Shutdown();
+	}
+}
+
+void FHdriVaultWorkerPool::Initialize()
+{
+	if (bIsInitialized)
+	{
+		return;
+	}
+
+	NumThreads = HdriVaultWorkerPoolUtils::WorkerThreads > 0
+		? HdriVaultWorkerPoolUtils::WorkerThreads
+		: FMath::Clamp(FPlatformMisc::NumberOfCoresIncludingHyperthreads() / 2, 1, 8);
+
+	ThreadPool = FQueuedThreadPool::Allocate();
+	if (!ThreadPool->Create(NumThreads, HdriVaultWorkerPoolUtils::StackSize, TPri_BelowNormal, TEXT("HdriVaultWorker")))
+	{
+		UE_LOG(LogTemp, Error, TEXT("HdriVault: Failed to create worker pool with %d threads"), NumThreads);
+		delete ThreadPool;
+		ThreadPool = nullptr;
+		NumThreads = 0;
+	}
+
+	MaxActiveWorkersChangedHandle = HdriVaultWorkerPoolUtils::CVarMaxActiveWorkers->OnChangedDelegate().AddRaw(this, &FHdriVaultWorkerPool::OnMaxActiveWorkersChanged);
+
+	bIsInitialized = true;
+}
+
+void FHdriVaultWorkerPool::Shutdown()
+{
+	if (!bIsInitialized)
+	{
+		return;
+	}
+
+	HdriVaultWorkerPoolUtils::CVarMaxActiveWorkers->OnChangedDelegate().Remove(MaxActiveWorkersChangedHandle);
+	MaxActiveWorkersChangedHandle.Reset();
+
+	// Drop queued work first so nothing new reaches the threads while they wind down
+	TArray<FQueuedTask*> Abandoned;
+	{
+		FScopeLock ScopeLock(&Lock);
+		for (TDeque<FQueuedTask*>& Pending : PendingTasks)
+		{
+			while (!Pending.IsEmpty())
+			{
+				Abandoned.Add(Pending.First());
+				Pending.PopFirst();
+			}
+		}
+	}
+
+	for (FQueuedTask* Task : Abandoned)
+	{
+		Task->Abandon();
+	}
+
+	// Waits for running work
+	if (ThreadPool)
+	{
+		ThreadPool->Destroy();
+		delete ThreadPool;
+		ThreadPool = nullptr;
+	}
+
+	NumRunning = 0;
+	bIsInitialized = false;
+}
+
+TFuture<void> FHdriVaultWorkerPool::Launch(EHdriVaultWorkerPriority Priority, TUniqueFunction<void()>&& Work)
+{
+	check(Priority < EHdriVaultWorkerPriority::Num);
+
+	FQueuedTask* Task = new FQueuedTask(*this, MoveTemp(Work));
+	TFuture<void> Future = Task->Promise.GetFuture();
+
+	// Without threads the work still has to happen
+	if (!ThreadPool)
+	{
+		Task->DoThreadedWork();
+		return Future;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	PendingTasks[static_cast<int32>(Priority)].PushLast(Task);
+	DispatchLocked();
+	return Future;
+}
+
+int32 FHdriVaultWorkerPool::GetActiveLimit() const
+{
+	const int32 MaxActive = HdriVaultWorkerPoolUtils::MaxActiveWorkers;
+	return MaxActive > 0 ? FMath::Min(MaxActive, NumThreads) : NumThreads;
+}
+
+void FHdriVaultWorkerPool::DispatchLocked()
+{
+	if (!ThreadPool)
+	{
+		return;
+	}
+
+	const int32 ActiveLimit = GetActiveLimit();
+
+	// Bulk work leaves one slot free for interactive work whenever there is more than one
+	const int32 BulkLimit = ActiveLimit > 1 ? ActiveLimit - 1 : ActiveLimit;
+
+	TDeque<FQueuedTask*>& Interactive = PendingTasks[static_cast<int32>(EHdriVaultWorkerPriority::Interactive)];
+	TDeque<FQueuedTask*>& Bulk = PendingTasks[static_cast<int32>(EHdriVaultWorkerPriority::Bulk)];
+
+	while (NumRunning < ActiveLimit)
+	{
+		FQueuedTask* Task = nullptr;
+		if (!Interactive.IsEmpty())
+		{
+			Task = Interactive.First();
+			Interactive.PopFirst();
+		}
+		else if (!Bulk.IsEmpty() && NumRunning < BulkLimit)
+		{
+			Task = Bulk.First();
+			Bulk.PopFirst();
+		}
+		else
+		{
+			break;
+		}
+
+		++NumRunning;
+		ThreadPool->AddQueuedWork(Task);
+	}
+}
+
+void FHdriVaultWorkerPool::OnMaxActiveWorkersChanged(IConsoleVariable* Variable)
+{
+	// A raised limit starts queued work right away; a lowered one takes hold as running work finishes
+	FScopeLock ScopeLock(&Lock);
+	DispatchLocked();
+}
+
+void FHdriVaultWorkerPool::OnTaskFinished()
+{
+	if (!ThreadPool)
+	{
+		return;
+	}
+
+	FScopeLock ScopeLock(&Lock);
+	--NumRunning;
+	DispatchLocked();
+}
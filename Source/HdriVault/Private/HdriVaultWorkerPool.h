@@ -0,0 +1,63 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Async/Future.h"
+#include "Containers/Deque.h"
+#include "HAL/CriticalSection.h"
+
+class FQueuedThreadPool;
+class IConsoleVariable;
+
+// Scheduling class for work on the vault's worker threads
+enum class EHdriVaultWorkerPriority : uint8
+{
+	Interactive,	// Someone is waiting on the result (search)
+	Bulk,			// Throughput work (metadata writes, conversion, analysis)
+	Num
+};
+
+/**
+ * The vault's own below-normal-priority worker threads, kept apart from the shared task graph so
+ * vault work neither competes with nor waits behind shader compilation and texture builds.
+ *
+ * Work is held here until a thread is free; interactive work is always handed out first, and one
+ * thread is kept out of reach of bulk work so interactive work never queues behind a long batch.
+ * HdriVault.WorkerThreads sizes the pool and HdriVault.MaxActiveWorkers caps how many run at once.
+ */
+class FHdriVaultWorkerPool
+{
+public:
+	FHdriVaultWorkerPool();
+	~FHdriVaultWorkerPool();
+
+	// Initialize/cleanup. Shutdown waits for running work; anything still queued is dropped.
+	void Initialize();
+	void Shutdown();
+
+	// Safe to call from any thread. The future is set once the work has run or been dropped.
+	TFuture<void> Launch(EHdriVaultWorkerPriority Priority, TUniqueFunction<void()>&& Work);
+
+	int32 GetNumThreads() const { return NumThreads; }
+
+private:
+	class FQueuedTask;
+
+	// Hands queued tasks to the thread pool while under the active limit. Requires Lock.
+	void DispatchLocked();
+	void OnTaskFinished();
+	void OnMaxActiveWorkersChanged(IConsoleVariable* Variable);
+	int32 GetActiveLimit() const;
+
+	FQueuedThreadPool* ThreadPool = nullptr;
+	int32 NumThreads = 0;
+
+	FCriticalSection Lock;
+	TDeque<FQueuedTask*> PendingTasks[static_cast<int32>(EHdriVaultWorkerPriority::Num)];
+	int32 NumRunning = 0;
+
+	FDelegateHandle MaxActiveWorkersChangedHandle;
+
+	bool bIsInitialized = false;
+};
@@ -135,6 +135,13 @@ void SHdriVaultCategoriesPanel::Construct(const FArguments& InArgs)
 		]
 	];
 
+	if (HdriVaultManager)
+	{
+		HdriVaultManager->OnItemsAdded.AddSP(this, &SHdriVaultCategoriesPanel::OnManagerItemsAdded);
+		HdriVaultManager->OnItemsRemoved.AddSP(this, &SHdriVaultCategoriesPanel::OnManagerItemsRemoved);
+		HdriVaultManager->OnItemsChanged.AddSP(this, &SHdriVaultCategoriesPanel::OnManagerItemsChanged);
+	}
+
 	RefreshCategories();
 	RefreshTags();
 }
@@ -163,30 +170,16 @@ void SHdriVaultCategoriesPanel::SetFilterText(const FString& FilterText)
 
 void SHdriVaultCategoriesPanel::RefreshTags()
 {
-	AllTags.Empty();
-	FilteredTags.Empty();
-
 	if (!HdriVaultManager) return;
 
-	// Collect all unique tags
-	TSet<FString> UniqueTags;
-	for (const auto& MaterialPair : HdriVaultManager->MaterialMap)
+	// Unique tags come straight from the manager's tag index. Rows for tags that still exist are
+	// kept, so the list does not lose its selection.
+	TSet<FString> CurrentTags(HdriVaultManager->GetAllTags());
+	AllTags.RemoveAll([&CurrentTags](const TSharedPtr<FString>& Tag)
 	{
-		const TSharedPtr<FHdriVaultMaterialItem>& Material = MaterialPair.Value;
-		if (Material.IsValid())
-		{
-			for (const FString& MatTag : Material->Metadata.Tags)
-			{
-				if (!MatTag.IsEmpty())
-				{
-					UniqueTags.Add(MatTag);
-				}
-			}
-		}
-	}
-
-	// Create tag items
-	for (const FString& TagStr : UniqueTags)
+		return CurrentTags.Remove(*Tag) == 0;
+	});
+	for (const FString& TagStr : CurrentTags)
 	{
 		AllTags.Add(MakeShared<FString>(TagStr));
 	}
@@ -362,35 +355,25 @@ void SHdriVaultCategoriesPanel::OnFilterTextChanged(const FText& FilterText)
 void SHdriVaultCategoriesPanel::BuildCategoryStructure()
 {
 	RootCategories.Empty();
+	MaterialCategories.Empty();
 	
 	if (!HdriVaultManager) return;
 
 	// Create "All" category
-	TSharedPtr<FHdriVaultCategoryItem> AllCategory = MakeShared<FHdriVaultCategoryItem>(TEXT("All"));
+	AllCategory = MakeShared<FHdriVaultCategoryItem>(TEXT("All"));
 	RootCategories.Add(AllCategory);
 	
 	// Create "Uncategorized" category
-	TSharedPtr<FHdriVaultCategoryItem> UncategorizedCategory = MakeShared<FHdriVaultCategoryItem>(TEXT("Uncategorized"));
+	UncategorizedCategory = MakeShared<FHdriVaultCategoryItem>(TEXT("Uncategorized"));
 	
-	for (const auto& MaterialPair : HdriVaultManager->MaterialMap)
+	AllCategory->Materials.Reserve(HdriVaultManager->GetNumMaterials());
+	MaterialCategories.Reserve(HdriVaultManager->GetNumMaterials());
+	HdriVaultManager->ForEachMaterial([this](FHdriVaultItemHandle Material)
 	{
-		const TSharedPtr<FHdriVaultMaterialItem>& Material = MaterialPair.Value;
-		if (Material.IsValid())
-		{
-			// Add to "All"
-			AllCategory->Materials.Add(Material);
-			
-			FString Category = Material->Metadata.Category;
-			if (Category.IsEmpty())
-			{
-				UncategorizedCategory->Materials.Add(Material);
-			}
-			else
-			{
-				AddMaterialToCategory(Material, Category);
-			}
-		}
-	}
+		// Add to "All"
+		AllCategory->Materials.Add(Material);
+		InsertMaterial(Material);
+	});
 	
 	// Add Uncategorized if it has items
 	if (UncategorizedCategory->Materials.Num() > 0)
@@ -398,7 +381,11 @@ void SHdriVaultCategoriesPanel::BuildCategoryStructure()
 		RootCategories.Add(UncategorizedCategory);
 	}
 	
-	// Sort categories
+	SortCategories();
+}
+
+void SHdriVaultCategoriesPanel::SortCategories()
+{
 	RootCategories.Sort([](const TSharedPtr<FHdriVaultCategoryItem>& A, const TSharedPtr<FHdriVaultCategoryItem>& B) {
 		// Keep "All" at top
 		if (A->CategoryName == TEXT("All")) return true;
@@ -429,47 +416,173 @@ TSharedPtr<FHdriVaultCategoryItem> SHdriVaultCategoriesPanel::GetOrCreateCategor
 	return NewCategory;
 }
 
-void SHdriVaultCategoriesPanel::AddMaterialToCategory(TSharedPtr<FHdriVaultMaterialItem> Material, const FString& CategoryName)
+void SHdriVaultCategoriesPanel::AddMaterialToCategory(FHdriVaultItemHandle Material, const FString& CategoryName)
 {
 	// Handle nested categories separated by / or |
 	// For now, just simple single level
 	
 	TSharedPtr<FHdriVaultCategoryItem> Category = GetOrCreateCategory(CategoryName);
 	Category->Materials.Add(Material);
+	MaterialCategories.Add(Material, Category);
+}
+
+TSharedPtr<FHdriVaultCategoryItem> SHdriVaultCategoriesPanel::InsertMaterial(FHdriVaultItemHandle Material)
+{
+	const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = HdriVaultManager ? HdriVaultManager->GetMaterial(Material) : nullptr;
+	const FString CategoryName = MaterialItem.IsValid() ? MaterialItem->Metadata.Category : FString();
+	if (CategoryName.IsEmpty())
+	{
+		UncategorizedCategory->Materials.Add(Material);
+		MaterialCategories.Add(Material, UncategorizedCategory);
+		return UncategorizedCategory;
+	}
+
+	AddMaterialToCategory(Material, CategoryName);
+	return MaterialCategories.FindChecked(Material);
+}
+
+TSharedPtr<FHdriVaultCategoryItem> SHdriVaultCategoriesPanel::RemoveMaterial(FHdriVaultItemHandle Material)
+{
+	TSharedPtr<FHdriVaultCategoryItem> Category;
+	if (MaterialCategories.RemoveAndCopyValue(Material, Category))
+	{
+		Category->Materials.RemoveSingle(Material);
+	}
+	return Category;
+}
+
+void SHdriVaultCategoriesPanel::CommitCategoryChanges(const TSet<TSharedPtr<FHdriVaultCategoryItem>>& ChangedCategories)
+{
+	// Categories are listed only while they hold materials; "All" is always shown. New categories
+	// were already listed when created, so the list is re-sorted either way.
+	for (const TSharedPtr<FHdriVaultCategoryItem>& Category : ChangedCategories)
+	{
+		const bool bShouldList = Category == AllCategory || Category->Materials.Num() > 0;
+		if (!bShouldList)
+		{
+			RootCategories.Remove(Category);
+		}
+		else
+		{
+			RootCategories.AddUnique(Category);
+		}
+	}
+
+	SortCategories();
+	ApplyFilter();
+	if (CategoryTreeView.IsValid())
+	{
+		CategoryTreeView->RequestTreeRefresh();
+	}
+
+	// Row counts are bound to the items, so only views showing a changed category need telling
+	for (const TSharedPtr<FHdriVaultCategoryItem>& Category : ChangedCategories)
+	{
+		OnCategoryContentsChanged.ExecuteIfBound(Category);
+	}
+}
+
+void SHdriVaultCategoriesPanel::OnManagerItemsAdded(const TArray<FHdriVaultItemHandle>& Items)
+{
+	if (!AllCategory.IsValid())
+	{
+		return;
+	}
+
+	TSet<TSharedPtr<FHdriVaultCategoryItem>> ChangedCategories;
+	ChangedCategories.Add(AllCategory);
+	for (FHdriVaultItemHandle Material : Items)
+	{
+		AllCategory->Materials.Add(Material);
+		ChangedCategories.Add(InsertMaterial(Material));
+	}
+
+	CommitCategoryChanges(ChangedCategories);
+	RefreshTags();
+}
+
+void SHdriVaultCategoriesPanel::OnManagerItemsRemoved(const TArray<FHdriVaultItemHandle>& Items)
+{
+	if (!AllCategory.IsValid())
+	{
+		return;
+	}
+
+	TSet<TSharedPtr<FHdriVaultCategoryItem>> ChangedCategories;
+	ChangedCategories.Add(AllCategory);
+	for (FHdriVaultItemHandle Material : Items)
+	{
+		AllCategory->Materials.RemoveSingle(Material);
+		if (TSharedPtr<FHdriVaultCategoryItem> Category = RemoveMaterial(Material))
+		{
+			ChangedCategories.Add(Category);
+		}
+	}
+
+	CommitCategoryChanges(ChangedCategories);
+	RefreshTags();
+}
+
+void SHdriVaultCategoriesPanel::OnManagerItemsChanged(const TArray<FHdriVaultItemHandle>& Items, EHdriVaultItemChange Change)
+{
+	if (EnumHasAnyFlags(Change, EHdriVaultItemChange::Category) && AllCategory.IsValid())
+	{
+		// Move just the changed materials between categories
+		TSet<TSharedPtr<FHdriVaultCategoryItem>> ChangedCategories;
+		for (FHdriVaultItemHandle Material : Items)
+		{
+			if (TSharedPtr<FHdriVaultCategoryItem> OldCategory = RemoveMaterial(Material))
+			{
+				ChangedCategories.Add(OldCategory);
+				ChangedCategories.Add(InsertMaterial(Material));
+			}
+		}
+
+		CommitCategoryChanges(ChangedCategories);
+	}
+
+	if (EnumHasAnyFlags(Change, EHdriVaultItemChange::Tags))
+	{
+		RefreshTags();
+	}
 }
 
 void SHdriVaultCategoriesPanel::OnDeleteCategory(TSharedPtr<FHdriVaultCategoryItem> CategoryToDelete)
 {
 	if (!CategoryToDelete.IsValid()) return;
 	
-	DeleteCategoryRecursive(CategoryToDelete);
+	// Collect first: saving moves materials out of the category being walked
+	TArray<FHdriVaultItemHandle> ChangedMaterials;
+	DeleteCategoryRecursive(CategoryToDelete, ChangedMaterials);
 	
-	// Refresh
+	// Saved as one batch; the manager's change notification moves the materials to Uncategorized
 	if (HdriVaultManager)
 	{
-		HdriVaultManager->RefreshMaterialDatabase();
+		HdriVaultManager->SaveMaterialMetadata(ChangedMaterials);
 	}
 }
 
-void SHdriVaultCategoriesPanel::DeleteCategoryRecursive(TSharedPtr<FHdriVaultCategoryItem> Category)
+void SHdriVaultCategoriesPanel::DeleteCategoryRecursive(TSharedPtr<FHdriVaultCategoryItem> Category, TArray<FHdriVaultItemHandle>& OutChangedMaterials)
 {
+	if (!HdriVaultManager)
+	{
+		return;
+	}
+	
 	// Move all materials to Uncategorized (empty category string)
-	for (const auto& Material : Category->Materials)
+	for (FHdriVaultItemHandle Material : Category->Materials)
 	{
-		if (Material.IsValid())
+		if (const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = HdriVaultManager->GetMaterial(Material))
 		{
-			Material->Metadata.Category.Empty();
-			if (HdriVaultManager)
-			{
-				HdriVaultManager->SaveMaterialMetadata(Material);
-			}
+			MaterialItem->Metadata.Category.Empty();
+			OutChangedMaterials.Add(Material);
 		}
 	}
 	
 	// Process children if any
 	for (const auto& Child : Category->Children)
 	{
-		DeleteCategoryRecursive(Child);
+		DeleteCategoryRecursive(Child, OutChangedMaterials);
 	}
 }
 
@@ -504,9 +617,28 @@ TSharedRef<ITableRow> SHdriVaultCategoriesPanel::OnGenerateTagWidget(TSharedPtr<
 {
 	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
 		[
-			SNew(STextBlock)
-			.Text(FText::FromString(*TagItem))
-			.Margin(FMargin(4.0f, 2.0f))
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(*TagItem))
+				.Margin(FMargin(4.0f, 2.0f))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.Padding(4.0f, 0.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text_Lambda([this, TagItem]()
+				{
+					// Live count from the tag index
+					const int32 Count = HdriVaultManager ? HdriVaultManager->GetTagCount(*TagItem) : 0;
+					return FText::Format(LOCTEXT("CountFormat", "({0})"), FText::AsNumber(Count));
+				})
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+			]
 		];
 }
 
@@ -550,19 +682,14 @@ void SHdriVaultCategoriesPanel::OnDeleteTag(TSharedPtr<FString> TagToDelete)
 	
 	FString TagName = *TagToDelete;
 	
-	// Remove tag from all materials
-	for (const auto& MaterialPair : HdriVaultManager->MaterialMap)
+	// Remove tag from every material carrying it; the tag list updates from the change notification
+	TArray<FHdriVaultItemHandle> TaggedMaterials;
+	HdriVaultManager->FilterMaterialsByTag(TagName, TaggedMaterials);
+	for (FHdriVaultItemHandle Material : TaggedMaterials)
 	{
-		const TSharedPtr<FHdriVaultMaterialItem>& Material = MaterialPair.Value;
-		if (Material.IsValid() && Material->Metadata.Tags.Contains(TagName))
-		{
-			Material->Metadata.Tags.Remove(TagName);
-			HdriVaultManager->SaveMaterialMetadata(Material);
-		}
+		HdriVaultManager->GetMaterial(Material)->Metadata.Tags.Remove(TagName);
 	}
-	
-	// Refresh
-	HdriVaultManager->RefreshMaterialDatabase();
+	HdriVaultManager->SaveMaterialMetadata(TaggedMaterials);
 }
 
 void SHdriVaultCategoriesPanel::ApplyFilter()
@@ -134,6 +134,8 @@ void SHdriVaultFolderTree::Construct(const FArguments& InArgs)
 	if (HdriVaultManager)
 	{
 		HdriVaultManager->OnRefreshRequested.AddSP(this, &SHdriVaultFolderTree::OnManagerRefreshRequested);
+		HdriVaultManager->OnFolderAdded.AddSP(this, &SHdriVaultFolderTree::OnManagerFolderAdded);
+		HdriVaultManager->OnFolderRemoved.AddSP(this, &SHdriVaultFolderTree::OnManagerFolderRemoved);
 	}
 
 	// Initial setup
@@ -382,9 +384,10 @@ bool SHdriVaultFolderTree::DoesNodeMatchFilter(TSharedPtr<FHdriVaultFolderNode>
 		}
 
 		// Check if any materials in this folder match
-		for (const auto& Material : Node->Materials)
+		for (FHdriVaultItemHandle Material : Node->Materials)
 		{
-			if (Material.IsValid() && Material->DisplayName.Contains(FilterText))
+			const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = HdriVaultManager ? HdriVaultManager->GetMaterial(Material) : nullptr;
+			if (MaterialItem.IsValid() && MaterialItem->GetDisplayName().Contains(FilterText))
 			{
 				return true;
 			}
@@ -416,6 +419,46 @@ void SHdriVaultFolderTree::OnManagerRefreshRequested()
 	}
 }
 
+void SHdriVaultFolderTree::OnManagerFolderAdded(TSharedPtr<FHdriVaultFolderNode> Folder)
+{
+	if (!Folder.IsValid() || !HdriVaultManager)
+	{
+		return;
+	}
+
+	// Children are read from the nodes on demand, so only top-level folders need tracking here
+	if (Folder->Parent == HdriVaultManager->GetRootFolder())
+	{
+		RootNodes.AddUnique(Folder);
+	}
+
+	TreeView->RequestTreeRefresh();
+}
+
+void SHdriVaultFolderTree::OnManagerFolderRemoved(TSharedPtr<FHdriVaultFolderNode> Folder)
+{
+	if (!Folder.IsValid())
+	{
+		return;
+	}
+
+	RootNodes.Remove(Folder);
+
+	// Move the selection up to the nearest folder that still exists
+	for (TSharedPtr<FHdriVaultFolderNode> Node = SelectedFolder; Node.IsValid(); Node = Node->Parent)
+	{
+		if (Node == Folder)
+		{
+			SelectedFolder = Folder->Parent;
+			TreeView->SetSelection(SelectedFolder);
+			OnFolderSelected.ExecuteIfBound(SelectedFolder);
+			break;
+		}
+	}
+
+	TreeView->RequestTreeRefresh();
+}
+
 void SHdriVaultFolderTree::SetFilterText(const FString& FilterText)
 {
 	CurrentFilterText = FilterText;
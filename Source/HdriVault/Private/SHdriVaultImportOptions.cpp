@@ -2,10 +2,14 @@
 
 #include "SHdriVaultImportOptions.h"
 #include "SHdriVaultMetadataPanel.h" // For SHdriVaultTagEditor
+#include "HdriVaultImportPrefetch.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SUniformGridPanel.h"
 #include "Widgets/Input/SButton.h"
 #include "Widgets/Text/STextBlock.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SBox.h"
+#include "Brushes/SlateDynamicImageBrush.h"
 #include "Styling/AppStyle.h"
 #include "PropertyEditorModule.h"
 #include "IDetailsView.h"
@@ -19,11 +23,13 @@ void SHdriVaultImportDialog::Construct(const FArguments& InArgs)
 	Options.DestinationPath = TEXT("/Game/HDRIs"); // Default path
 	bShouldImport = false;
 	ParentWindow = InArgs._ParentWindow;
+	OnImport = InArgs._OnImport;
+	Options.Prefetch = InArgs._Prefetch;
 
 	// Populate file list
 	for (const FString& File : Options.Files)
 	{
-		FileList.Add(MakeShareable(new FString(FPaths::GetCleanFilename(File))));
+		FileList.Add(MakeShareable(new FString(File)));
 	}
 
 	// Initialize transient settings object for Property Editor
@@ -214,6 +220,12 @@ void SHdriVaultImportDialog::Construct(const FArguments& InArgs)
 
 SHdriVaultImportDialog::~SHdriVaultImportDialog()
 {
+	// Closed without importing; nothing converted so far will be used
+	if (!bShouldImport && Options.Prefetch.IsValid())
+	{
+		Options.Prefetch->Discard();
+	}
+	
 	if (ImportSettingsObject)
 	{
 		ImportSettingsObject->RemoveFromRoot();
@@ -225,16 +237,104 @@ TSharedRef<ITableRow> SHdriVaultImportDialog::OnGenerateFileRow(TSharedPtr<FStri
 {
 	return SNew(STableRow<TSharedPtr<FString>>, OwnerTable)
 		[
-			SNew(STextBlock)
-			.Text(FText::FromString(*Item))
-			.Margin(FMargin(4, 2))
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(FMargin(4, 2, 0, 2))
+			[
+				// Sized for long-lat panoramas
+				SNew(SBox)
+				.WidthOverride(48.0f)
+				.HeightOverride(24.0f)
+				[
+					SNew(SImage)
+					.Image(this, &SHdriVaultImportDialog::GetFilePreviewBrush, Item)
+				]
+			]
+			+ SHorizontalBox::Slot()
+			.FillWidth(1.0f)
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(FText::FromString(FPaths::GetCleanFilename(*Item)))
+				.ToolTipText(FText::FromString(*Item))
+				.Margin(FMargin(4, 2))
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			[
+				SNew(STextBlock)
+				.Text(this, &SHdriVaultImportDialog::GetFileInfoText, Item)
+				.ColorAndOpacity(FSlateColor::UseSubduedForeground())
+				.Margin(FMargin(4, 2))
+			]
 		];
 }
 
+const FSlateBrush* SHdriVaultImportDialog::GetFilePreviewBrush(TSharedPtr<FString> Item) const
+{
+	if (!Item.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (const TSharedPtr<FSlateDynamicImageBrush>* Brush = PreviewBrushes.Find(*Item))
+	{
+		return Brush->Get();
+	}
+
+	const FHdriVaultImagePreview* Preview = Options.Prefetch.IsValid() ? Options.Prefetch->GetPreview(*Item) : nullptr;
+	if (!Preview)
+	{
+		return nullptr;
+	}
+
+	// FColor is laid out as BGRA, which is what dynamic brushes expect
+	TArray<uint8> ImageData;
+	ImageData.Append(reinterpret_cast<const uint8*>(Preview->Pixels.GetData()), Preview->Pixels.Num() * sizeof(FColor));
+
+	const FName ResourceName(*FString::Printf(TEXT("HdriVaultImportPreview_%s"), *FGuid::NewGuid().ToString()));
+	TSharedPtr<FSlateDynamicImageBrush> Brush = FSlateDynamicImageBrush::CreateWithImageData(ResourceName, FVector2D(Preview->Width, Preview->Height), ImageData);
+	PreviewBrushes.Add(*Item, Brush);
+	return Brush.Get();
+}
+
+FText SHdriVaultImportDialog::GetFileInfoText(TSharedPtr<FString> Item) const
+{
+	FHdriVaultImportPrefetch::FFileStatus Status;
+	if (!Options.Prefetch.IsValid() || !Item.IsValid() || !Options.Prefetch->GetStatus(*Item, Status))
+	{
+		return FText::GetEmpty();
+	}
+
+	if (!Status.bHasHeader)
+	{
+		return Status.State == FHdriVaultImportPrefetch::EFileState::Failed
+			? LOCTEXT("FileUnreadable", "Unreadable")
+			: LOCTEXT("FileReading", "Reading...");
+	}
+
+	const FHdriVaultImageInfo& Info = Status.ImageInfo;
+	const FText Resolution = FText::Format(LOCTEXT("FileResolution", "{0} x {1}"), FText::AsNumber(Info.Width), FText::AsNumber(Info.Height));
+	const FText Memory = FText::AsMemory(static_cast<uint64>(Info.GetEstimatedMemoryBytes()));
+
+	if (!Info.bHasPixelStats)
+	{
+		return FText::Format(LOCTEXT("FileInfoPending", "{0}   ~{1}   Analyzing..."), Resolution, Memory);
+	}
+
+	FNumberFormattingOptions PeakFormat;
+	PeakFormat.MaximumFractionalDigits = 1;
+	return FText::Format(LOCTEXT("FileInfo", "{0}   ~{1}   Peak {2}"), Resolution, Memory, FText::AsNumber(Info.PeakLuminance, &PeakFormat));
+}
+
 FReply SHdriVaultImportDialog::OnImportClicked()
 {
 	UpdateOptionsFromUI();
 	bShouldImport = true;
+	OnImport.ExecuteIfBound(Options);
 	
 	if (ParentWindow.IsValid())
 	{
@@ -2,6 +2,9 @@
 
 #include "SHdriVaultMaterialGrid.h"
 #include "HdriVaultManager.h"
+#include "HdriVaultAsyncSearch.h"
+#include "HdriVaultCatalogSnapshot.h"
+#include "HdriVaultQuery.h"
 #include "Engine/Engine.h"
 #include "Editor.h"
 #include "EditorStyleSet.h"
@@ -26,11 +29,13 @@
 
 void SHdriVaultMaterialTile::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
 {
-	MaterialItem = InArgs._MaterialItem;
+	Handle = InArgs._Handle;
+	AssetData = InArgs._AssetData;
+	DisplayName = InArgs._DisplayName;
 	ThumbnailSize = InArgs._ThumbnailSize;
 
 	// Create asset thumbnail
-	if (MaterialItem.IsValid())
+	if (AssetData.IsValid())
 	{
 		FAssetThumbnailConfig ThumbnailConfig;
 		ThumbnailConfig.bAllowFadeIn = true;
@@ -38,10 +43,10 @@ void SHdriVaultMaterialTile::Construct(const FArguments& InArgs, const TSharedRe
 		ThumbnailConfig.ThumbnailLabel = EThumbnailLabel::ClassName;
 		ThumbnailConfig.HighlightedText = FText::GetEmpty();
 
-		AssetThumbnail = MakeShareable(new FAssetThumbnail(MaterialItem->AssetData, ThumbnailSize * 2.0f, ThumbnailSize, UThumbnailManager::Get().GetSharedThumbnailPool()));
+		AssetThumbnail = MakeShareable(new FAssetThumbnail(AssetData, ThumbnailSize * 2.0f, ThumbnailSize, UThumbnailManager::Get().GetSharedThumbnailPool()));
 	}
 
-	STableRow<TSharedPtr<FHdriVaultMaterialItem>>::Construct(
+	STableRow<FHdriVaultItemHandle>::Construct(
 		STableRow::FArguments()
 		.Style(FAppStyle::Get(), "TableView.Row")
 		.Padding(FMargin(2))
@@ -87,37 +92,37 @@ FReply SHdriVaultMaterialTile::OnMouseButtonDown(const FGeometry& MyGeometry, co
 {
 	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
 	{
-		OnMaterialLeftClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialLeftClicked.ExecuteIfBound(Handle);
 		return FReply::Handled().DetectDrag(SharedThis(this), EKeys::LeftMouseButton);
 	}
 	else if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
 	{
-		OnMaterialRightClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialRightClicked.ExecuteIfBound(Handle);
 		return FReply::Handled();
 	}
 	else if (MouseEvent.GetEffectingButton() == EKeys::MiddleMouseButton)
 	{
-		OnMaterialMiddleClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialMiddleClicked.ExecuteIfBound(Handle);
 		return FReply::Handled();
 	}
 
-	return STableRow<TSharedPtr<FHdriVaultMaterialItem>>::OnMouseButtonDown(MyGeometry, MouseEvent);
+	return STableRow<FHdriVaultItemHandle>::OnMouseButtonDown(MyGeometry, MouseEvent);
 }
 
 FReply SHdriVaultMaterialTile::OnMouseButtonUp(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-	return STableRow<TSharedPtr<FHdriVaultMaterialItem>>::OnMouseButtonUp(MyGeometry, MouseEvent);
+	return STableRow<FHdriVaultItemHandle>::OnMouseButtonUp(MyGeometry, MouseEvent);
 }
 
 FReply SHdriVaultMaterialTile::OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent)
 {
 	if (InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
 	{
-		OnMaterialDoubleClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialDoubleClicked.ExecuteIfBound(Handle);
 		return FReply::Handled();
 	}
 
-	return STableRow<TSharedPtr<FHdriVaultMaterialItem>>::OnMouseButtonDoubleClick(InMyGeometry, InMouseEvent);
+	return STableRow<FHdriVaultItemHandle>::OnMouseButtonDoubleClick(InMyGeometry, InMouseEvent);
 }
 
 void SHdriVaultMaterialTile::OnDragEnter(const FGeometry& MyGeometry, const FDragDropEvent& DragDropEvent)
@@ -132,11 +137,11 @@ void SHdriVaultMaterialTile::OnDragLeave(const FDragDropEvent& DragDropEvent)
 
 FReply SHdriVaultMaterialTile::OnDragDetected(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-	if (MaterialItem.IsValid() && MouseEvent.IsMouseButtonDown(EKeys::LeftMouseButton))
+	if (Handle.IsValid() && MouseEvent.IsMouseButtonDown(EKeys::LeftMouseButton))
 	{
 		if (OnMaterialDragDetected.IsBound())
 		{
-			return OnMaterialDragDetected.Execute(MaterialItem, MyGeometry, MouseEvent);
+			return OnMaterialDragDetected.Execute(Handle, MyGeometry, MouseEvent);
 		}
 		return FReply::Handled();
 	}
@@ -146,27 +151,31 @@ FReply SHdriVaultMaterialTile::OnDragDetected(const FGeometry& MyGeometry, const
 
 FText SHdriVaultMaterialTile::GetMaterialName() const
 {
-	if (MaterialItem.IsValid())
+	if (!DisplayName.IsEmpty())
 	{
-		return FText::FromString(MaterialItem->DisplayName);
+		return FText::FromString(DisplayName);
+	}
+	if (AssetData.IsValid())
+	{
+		return FText::FromName(AssetData.AssetName);
 	}
 	return FText::GetEmpty();
 }
 
 FText SHdriVaultMaterialTile::GetMaterialTooltip() const
 {
-	if (MaterialItem.IsValid())
+	if (AssetData.IsValid())
 	{
 		FString Dimensions = TEXT("Unknown");
-		MaterialItem->AssetData.GetTagValue(TEXT("Dimensions"), Dimensions);
+		AssetData.GetTagValue(TEXT("Dimensions"), Dimensions);
 		
 		int64 ResourceSizeBytes = 0;
-		MaterialItem->AssetData.GetTagValue(TEXT("ResourceSize"), ResourceSizeBytes);
+		AssetData.GetTagValue(TEXT("ResourceSize"), ResourceSizeBytes);
 		FString SizeText = (ResourceSizeBytes > 0) ? FText::AsMemory(ResourceSizeBytes).ToString() : TEXT("Unknown");
 
 		FString TooltipText = FString::Printf(TEXT("HDRI: %s\nPath: %s\nDimensions: %s\nSize: %s"),
-			*MaterialItem->DisplayName,
-			*MaterialItem->AssetData.PackageName.ToString(),
+			*AssetData.AssetName.ToString(),
+			*AssetData.PackageName.ToString(),
 			*Dimensions,
 			*SizeText
 		);
@@ -189,17 +198,28 @@ void SHdriVaultMaterialTile::RefreshThumbnail()
 	}
 }
 
+void SHdriVaultMaterialTile::SetAssetData(const FAssetData& InAssetData)
+{
+	AssetData = InAssetData;
+	if (AssetThumbnail.IsValid())
+	{
+		AssetThumbnail->SetAsset(AssetData);
+	}
+}
+
 void SHdriVaultMaterialListItem::Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView)
 {
-	MaterialItem = InArgs._MaterialItem;
+	Handle = InArgs._Handle;
+	AssetData = InArgs._AssetData;
+	DisplayName = InArgs._DisplayName;
 
 	// Create asset thumbnail for list view (smaller)
-	if (MaterialItem.IsValid())
+	if (AssetData.IsValid())
 	{
-		AssetThumbnail = MakeShareable(new FAssetThumbnail(MaterialItem->AssetData, 32, 32, UThumbnailManager::Get().GetSharedThumbnailPool()));
+		AssetThumbnail = MakeShareable(new FAssetThumbnail(AssetData, 32, 32, UThumbnailManager::Get().GetSharedThumbnailPool()));
 	}
 
-	STableRow<TSharedPtr<FHdriVaultMaterialItem>>::Construct(
+	STableRow<FHdriVaultItemHandle>::Construct(
 		STableRow::FArguments()
 		.Style(FAppStyle::Get(), "ContentBrowser.AssetListView.ColumnListTableRow")
 		.Padding(FMargin(0, 2, 0, 0))
@@ -247,40 +267,57 @@ void SHdriVaultMaterialListItem::Construct(const FArguments& InArgs, const TShar
 	);
 }
 
+void SHdriVaultMaterialListItem::RefreshThumbnail()
+{
+	if (AssetThumbnail.IsValid())
+	{
+		AssetThumbnail->RefreshThumbnail();
+	}
+}
+
+void SHdriVaultMaterialListItem::SetAssetData(const FAssetData& InAssetData)
+{
+	AssetData = InAssetData;
+	if (AssetThumbnail.IsValid())
+	{
+		AssetThumbnail->SetAsset(AssetData);
+	}
+}
+
 FReply SHdriVaultMaterialListItem::OnMouseButtonDown(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
 	if (MouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
 	{
-		OnMaterialLeftClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialLeftClicked.ExecuteIfBound(Handle);
 		return FReply::Handled().DetectDrag(SharedThis(this), EKeys::LeftMouseButton);
 	}
 	else if (MouseEvent.GetEffectingButton() == EKeys::RightMouseButton)
 	{
-		OnMaterialRightClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialRightClicked.ExecuteIfBound(Handle);
 		return FReply::Handled();
 	}
 
-	return STableRow<TSharedPtr<FHdriVaultMaterialItem>>::OnMouseButtonDown(MyGeometry, MouseEvent);
+	return STableRow<FHdriVaultItemHandle>::OnMouseButtonDown(MyGeometry, MouseEvent);
 }
 
 FReply SHdriVaultMaterialListItem::OnMouseButtonDoubleClick(const FGeometry& InMyGeometry, const FPointerEvent& InMouseEvent)
 {
 	if (InMouseEvent.GetEffectingButton() == EKeys::LeftMouseButton)
 	{
-		OnMaterialDoubleClicked.ExecuteIfBound(MaterialItem);
+		OnMaterialDoubleClicked.ExecuteIfBound(Handle);
 		return FReply::Handled();
 	}
 
-	return STableRow<TSharedPtr<FHdriVaultMaterialItem>>::OnMouseButtonDoubleClick(InMyGeometry, InMouseEvent);
+	return STableRow<FHdriVaultItemHandle>::OnMouseButtonDoubleClick(InMyGeometry, InMouseEvent);
 }
 
 FReply SHdriVaultMaterialListItem::OnDragDetected(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
-	if (MaterialItem.IsValid() && MouseEvent.IsMouseButtonDown(EKeys::LeftMouseButton))
+	if (Handle.IsValid() && MouseEvent.IsMouseButtonDown(EKeys::LeftMouseButton))
 	{
 		if (OnMaterialDragDetected.IsBound())
 		{
-			return OnMaterialDragDetected.Execute(MaterialItem, MyGeometry, MouseEvent);
+			return OnMaterialDragDetected.Execute(Handle, MyGeometry, MouseEvent);
 		}
 		return FReply::Handled();
 	}
@@ -290,18 +327,22 @@ FReply SHdriVaultMaterialListItem::OnDragDetected(const FGeometry& MyGeometry, c
 
 FText SHdriVaultMaterialListItem::GetMaterialName() const
 {
-	if (MaterialItem.IsValid())
+	if (!DisplayName.IsEmpty())
+	{
+		return FText::FromString(DisplayName);
+	}
+	if (AssetData.IsValid())
 	{
-		return FText::FromString(MaterialItem->DisplayName);
+		return FText::FromName(AssetData.AssetName);
 	}
 	return FText::GetEmpty();
 }
 
 FText SHdriVaultMaterialListItem::GetMaterialType() const
 {
-	if (MaterialItem.IsValid())
+	if (AssetData.IsValid())
 	{
-		FString ClassName = MaterialItem->AssetData.AssetClassPath.GetAssetName().ToString();
+		FString ClassName = AssetData.AssetClassPath.GetAssetName().ToString();
 		return FText::FromString(ClassName);
 	}
 	return FText::GetEmpty();
@@ -309,9 +350,9 @@ FText SHdriVaultMaterialListItem::GetMaterialType() const
 
 FText SHdriVaultMaterialListItem::GetMaterialPath() const
 {
-	if (MaterialItem.IsValid())
+	if (AssetData.IsValid())
 	{
-		FString Path = MaterialItem->AssetData.PackagePath.ToString();
+		FString Path = AssetData.PackagePath.ToString();
 		Path.RemoveFromStart(TEXT("/Game/"));
 		return FText::FromString(Path);
 	}
@@ -320,18 +361,18 @@ FText SHdriVaultMaterialListItem::GetMaterialPath() const
 
 FText SHdriVaultMaterialListItem::GetMaterialTooltip() const
 {
-	if (MaterialItem.IsValid())
+	if (AssetData.IsValid())
 	{
 		FString Dimensions = TEXT("Unknown");
-		MaterialItem->AssetData.GetTagValue(TEXT("Dimensions"), Dimensions);
+		AssetData.GetTagValue(TEXT("Dimensions"), Dimensions);
 		
 		int64 ResourceSizeBytes = 0;
-		MaterialItem->AssetData.GetTagValue(TEXT("ResourceSize"), ResourceSizeBytes);
+		AssetData.GetTagValue(TEXT("ResourceSize"), ResourceSizeBytes);
 		FString SizeText = (ResourceSizeBytes > 0) ? FText::AsMemory(ResourceSizeBytes).ToString() : TEXT("Unknown");
 
 		FString TooltipText = FString::Printf(TEXT("HDRI: %s\nPath: %s\nDimensions: %s\nSize: %s"),
-			*MaterialItem->DisplayName,
-			*MaterialItem->AssetData.PackageName.ToString(),
+			*AssetData.AssetName.ToString(),
+			*AssetData.PackageName.ToString(),
 			*Dimensions,
 			*SizeText
 		);
@@ -347,6 +388,20 @@ void SHdriVaultMaterialGrid::Construct(const FArguments& InArgs)
 	ThumbnailSize = 128.0f;
 	CurrentFilterText = TEXT("");
 
+	AsyncSearch = MakeShared<FHdriVaultAsyncSearch>();
+	AsyncSearch->OnResults.BindSP(this, &SHdriVaultMaterialGrid::OnSearchResults);
+	AsyncSearch->OnFinished.BindSP(this, &SHdriVaultMaterialGrid::OnSearchFinished);
+	if (HdriVaultManager)
+	{
+		AsyncSearch->SetWorkScheduler(HdriVaultManager->GetWorkScheduler());
+		AsyncSearch->SetWorkerPool(HdriVaultManager->GetWorkerPool());
+	}
+
+	if (HdriVaultManager)
+	{
+		HdriVaultManager->OnItemsChanged.AddSP(this, &SHdriVaultMaterialGrid::OnManagerItemsChanged);
+	}
+
 	// Create thumbnail pool
 	ThumbnailPool = MakeShareable(new FAssetThumbnailPool(1000, true));
 
@@ -394,7 +449,11 @@ void SHdriVaultMaterialGrid::Construct(const FArguments& InArgs)
 void SHdriVaultMaterialGrid::RefreshGrid()
 {
 	UpdateFilteredMaterials();
+	RequestViewRefresh();
+}
 
+void SHdriVaultMaterialGrid::RequestViewRefresh()
+{
 	if (TileView.IsValid())
 	{
 		TileView->RequestListRefresh();
@@ -405,21 +464,36 @@ void SHdriVaultMaterialGrid::RefreshGrid()
 	}
 }
 
-void SHdriVaultMaterialGrid::SetMaterials(const TArray<TSharedPtr<FHdriVaultMaterialItem>>& InMaterials)
+void SHdriVaultMaterialGrid::SetMaterials(const TArray<FHdriVaultItemHandle>& InMaterials)
+{
+	SetMaterials(MakeShared<TArray<FHdriVaultItemHandle>>(InMaterials));
+}
+
+void SHdriVaultMaterialGrid::SetMaterials(TSharedRef<const TArray<FHdriVaultItemHandle>> InMaterials)
 {
 	AllMaterials = InMaterials;
-	UpdateFilteredMaterials();
+	++CandidateSetId;
 	RefreshGrid();
 }
 
-void SHdriVaultMaterialGrid::SetSelectedMaterial(TSharedPtr<FHdriVaultMaterialItem> Material)
+void SHdriVaultMaterialGrid::SetSelectedMaterial(FHdriVaultItemHandle Material)
 {
 	UpdateSelection(Material);
 }
 
 TSharedPtr<FHdriVaultMaterialItem> SHdriVaultMaterialGrid::GetSelectedMaterial() const
 {
-	return SelectedMaterial;
+	return ResolveMaterial(SelectedMaterial);
+}
+
+bool SHdriVaultMaterialGrid::ContainsMaterial(FHdriVaultItemHandle Material) const
+{
+	return AllMaterials->Contains(Material);
+}
+
+TSharedPtr<FHdriVaultMaterialItem> SHdriVaultMaterialGrid::ResolveMaterial(FHdriVaultItemHandle Material) const
+{
+	return HdriVaultManager ? HdriVaultManager->GetMaterial(Material) : nullptr;
 }
 
 void SHdriVaultMaterialGrid::SetViewMode(EHdriVaultViewMode InViewMode)
@@ -444,15 +518,15 @@ void SHdriVaultMaterialGrid::SetThumbnailSize(float InThumbnailSize)
 
 void SHdriVaultMaterialGrid::ClearSelection()
 {
-	UpdateSelection(nullptr);
+	UpdateSelection(FHdriVaultItemHandle());
 }
 
 void SHdriVaultMaterialGrid::SetFolder(const FString& FolderPath)
 {
 	if (HdriVaultManager)
 	{
-		TArray<TSharedPtr<FHdriVaultMaterialItem>> FolderMaterials = HdriVaultManager->GetMaterialsInFolder(FolderPath);
-		SetMaterials(FolderMaterials);
+		// Shares the manager's cached folder view rather than copying it
+		SetMaterials(HdriVaultManager->GetMaterialsInFolderView(FolderPath));
 	}
 }
 
@@ -464,13 +538,12 @@ void SHdriVaultMaterialGrid::SetFilterText(const FString& FilterText)
 
 void SHdriVaultMaterialGrid::ApplyFilters()
 {
-	UpdateFilteredMaterials();
 	RefreshGrid();
 }
 
 TSharedRef<SWidget> SHdriVaultMaterialGrid::CreateTileView()
 {
-	TileView = SNew(STileView<TSharedPtr<FHdriVaultMaterialItem>>)
+	TileView = SNew(STileView<FHdriVaultItemHandle>)
 		.ListItemsSource(&FilteredMaterials)
 		.OnGenerateTile(this, &SHdriVaultMaterialGrid::OnGenerateTileWidget)
 		.OnSelectionChanged(this, &SHdriVaultMaterialGrid::OnTileSelectionChanged)
@@ -485,7 +558,7 @@ TSharedRef<SWidget> SHdriVaultMaterialGrid::CreateTileView()
 
 TSharedRef<SWidget> SHdriVaultMaterialGrid::CreateListView()
 {
-	ListView = SNew(SListView<TSharedPtr<FHdriVaultMaterialItem>>)
+	ListView = SNew(SListView<FHdriVaultItemHandle>)
 		.ListItemsSource(&FilteredMaterials)
 		.OnGenerateRow(this, &SHdriVaultMaterialGrid::OnGenerateListWidget)
 		.OnSelectionChanged(this, &SHdriVaultMaterialGrid::OnListSelectionChanged)
@@ -506,10 +579,13 @@ void SHdriVaultMaterialGrid::SwitchToViewMode(EHdriVaultViewMode NewViewMode)
 	RefreshGrid();
 }
 
-TSharedRef<ITableRow> SHdriVaultMaterialGrid::OnGenerateTileWidget(TSharedPtr<FHdriVaultMaterialItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+TSharedRef<ITableRow> SHdriVaultMaterialGrid::OnGenerateTileWidget(FHdriVaultItemHandle Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
+	const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = ResolveMaterial(Item);
 	TSharedRef<SHdriVaultMaterialTile> TileWidget = SNew(SHdriVaultMaterialTile, OwnerTable)
-		.MaterialItem(Item)
+		.Handle(Item)
+		.AssetData(MaterialItem.IsValid() ? MaterialItem->GetAssetData() : FAssetData())
+		.DisplayName(MaterialItem.IsValid() ? MaterialItem->GetDisplayName() : FString())
 		.ThumbnailSize(ThumbnailSize);
 
 	TileWidget->OnMaterialLeftClicked.BindSP(this, &SHdriVaultMaterialGrid::OnMaterialLeftClicked);
@@ -521,15 +597,18 @@ TSharedRef<ITableRow> SHdriVaultMaterialGrid::OnGenerateTileWidget(TSharedPtr<FH
 	return TileWidget;
 }
 
-void SHdriVaultMaterialGrid::OnTileSelectionChanged(TSharedPtr<FHdriVaultMaterialItem> SelectedItem, ESelectInfo::Type SelectInfo)
+void SHdriVaultMaterialGrid::OnTileSelectionChanged(FHdriVaultItemHandle SelectedItem, ESelectInfo::Type SelectInfo)
 {
 	UpdateSelection(SelectedItem);
 }
 
-TSharedRef<ITableRow> SHdriVaultMaterialGrid::OnGenerateListWidget(TSharedPtr<FHdriVaultMaterialItem> Item, const TSharedRef<STableViewBase>& OwnerTable)
+TSharedRef<ITableRow> SHdriVaultMaterialGrid::OnGenerateListWidget(FHdriVaultItemHandle Item, const TSharedRef<STableViewBase>& OwnerTable)
 {
+	const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = ResolveMaterial(Item);
 	TSharedRef<SHdriVaultMaterialListItem> ListWidget = SNew(SHdriVaultMaterialListItem, OwnerTable)
-		.MaterialItem(Item);
+		.Handle(Item)
+		.AssetData(MaterialItem.IsValid() ? MaterialItem->GetAssetData() : FAssetData())
+		.DisplayName(MaterialItem.IsValid() ? MaterialItem->GetDisplayName() : FString());
 
 	ListWidget->OnMaterialLeftClicked.BindSP(this, &SHdriVaultMaterialGrid::OnMaterialLeftClicked);
 	ListWidget->OnMaterialRightClicked.BindSP(this, &SHdriVaultMaterialGrid::OnMaterialRightClicked);
@@ -539,52 +618,56 @@ TSharedRef<ITableRow> SHdriVaultMaterialGrid::OnGenerateListWidget(TSharedPtr<FH
 	return ListWidget;
 }
 
-void SHdriVaultMaterialGrid::OnListSelectionChanged(TSharedPtr<FHdriVaultMaterialItem> SelectedItem, ESelectInfo::Type SelectInfo)
+void SHdriVaultMaterialGrid::OnListSelectionChanged(FHdriVaultItemHandle SelectedItem, ESelectInfo::Type SelectInfo)
 {
 	UpdateSelection(SelectedItem);
 }
 
-void SHdriVaultMaterialGrid::OnMaterialLeftClicked(TSharedPtr<FHdriVaultMaterialItem> Material)
+void SHdriVaultMaterialGrid::OnMaterialLeftClicked(FHdriVaultItemHandle Material)
 {
 	// Left click should select the material
 	UpdateSelection(Material);
 }
 
-void SHdriVaultMaterialGrid::OnMaterialRightClicked(TSharedPtr<FHdriVaultMaterialItem> Material)
+void SHdriVaultMaterialGrid::OnMaterialRightClicked(FHdriVaultItemHandle Material)
 {
 	// Right click should select the material and show context menu
 	UpdateSelection(Material);
 	// Context menu will be shown automatically by the STileView/SListView OnContextMenuOpening delegate
 }
 
-void SHdriVaultMaterialGrid::OnMaterialMiddleClicked(TSharedPtr<FHdriVaultMaterialItem> Material)
+void SHdriVaultMaterialGrid::OnMaterialMiddleClicked(FHdriVaultItemHandle Material)
 {
 	// Middle click should show large thumbnail preview (from original HdriVault behavior)
 	UpdateSelection(Material);
 	// TODO: Implement large thumbnail preview window
 }
 
-void SHdriVaultMaterialGrid::OnMaterialDoubleClickedInternal(TSharedPtr<FHdriVaultMaterialItem> Material)
+void SHdriVaultMaterialGrid::OnMaterialDoubleClickedInternal(FHdriVaultItemHandle Material)
 {
-	OnMaterialDoubleClicked.ExecuteIfBound(Material);
+	OnMaterialDoubleClicked.ExecuteIfBound(ResolveMaterial(Material));
 }
 
-FReply SHdriVaultMaterialGrid::HandleMaterialDragDetected(TSharedPtr<FHdriVaultMaterialItem> Material, const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
+FReply SHdriVaultMaterialGrid::HandleMaterialDragDetected(FHdriVaultItemHandle Material, const FGeometry& MyGeometry, const FPointerEvent& MouseEvent)
 {
 	if (!Material.IsValid() || !MouseEvent.IsMouseButtonDown(EKeys::LeftMouseButton))
 	{
 		return FReply::Unhandled();
 	}
 
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> MaterialsForDrag;
+	TArray<FHdriVaultItemHandle> MaterialsForDrag;
 	GatherDragMaterials(MaterialsForDrag, Material);
 
 	TArray<FAssetData> DraggedAssets;
-	for (const TSharedPtr<FHdriVaultMaterialItem>& DragMaterial : MaterialsForDrag)
+	for (FHdriVaultItemHandle DragMaterial : MaterialsForDrag)
 	{
-		if (DragMaterial.IsValid() && DragMaterial->AssetData.IsValid())
+		if (const TSharedPtr<FHdriVaultMaterialItem> DragItem = ResolveMaterial(DragMaterial))
 		{
-			DraggedAssets.Add(DragMaterial->AssetData);
+			FAssetData DragAssetData = DragItem->GetAssetData();
+			if (DragAssetData.IsValid())
+			{
+				DraggedAssets.Add(MoveTemp(DragAssetData));
+			}
 		}
 	}
 
@@ -598,11 +681,11 @@ FReply SHdriVaultMaterialGrid::HandleMaterialDragDetected(TSharedPtr<FHdriVaultM
 	return FReply::Handled().BeginDragDrop(DragDropOp);
 }
 
-void SHdriVaultMaterialGrid::GatherDragMaterials(TArray<TSharedPtr<FHdriVaultMaterialItem>>& OutMaterials, TSharedPtr<FHdriVaultMaterialItem> PrimaryItem) const
+void SHdriVaultMaterialGrid::GatherDragMaterials(TArray<FHdriVaultItemHandle>& OutMaterials, FHdriVaultItemHandle PrimaryItem) const
 {
 	OutMaterials.Reset();
 
-	auto AddUniqueMaterial = [&OutMaterials](TSharedPtr<FHdriVaultMaterialItem> InMaterial)
+	auto AddUniqueMaterial = [&OutMaterials](FHdriVaultItemHandle InMaterial)
 	{
 		if (InMaterial.IsValid())
 		{
@@ -614,8 +697,8 @@ void SHdriVaultMaterialGrid::GatherDragMaterials(TArray<TSharedPtr<FHdriVaultMat
 
 	if (TileView.IsValid())
 	{
-		const TArray<TSharedPtr<FHdriVaultMaterialItem>> SelectedTiles = TileView->GetSelectedItems();
-		for (const TSharedPtr<FHdriVaultMaterialItem>& SelectedTileMaterial : SelectedTiles)
+		const TArray<FHdriVaultItemHandle> SelectedTiles = TileView->GetSelectedItems();
+		for (FHdriVaultItemHandle SelectedTileMaterial : SelectedTiles)
 		{
 			AddUniqueMaterial(SelectedTileMaterial);
 		}
@@ -623,8 +706,8 @@ void SHdriVaultMaterialGrid::GatherDragMaterials(TArray<TSharedPtr<FHdriVaultMat
 
 	if (ListView.IsValid())
 	{
-		const TArray<TSharedPtr<FHdriVaultMaterialItem>> SelectedListItems = ListView->GetSelectedItems();
-		for (const TSharedPtr<FHdriVaultMaterialItem>& SelectedListMaterial : SelectedListItems)
+		const TArray<FHdriVaultItemHandle> SelectedListItems = ListView->GetSelectedItems();
+		for (FHdriVaultItemHandle SelectedListMaterial : SelectedListItems)
 		{
 			AddUniqueMaterial(SelectedListMaterial);
 		}
@@ -677,18 +760,18 @@ TSharedPtr<SWidget> SHdriVaultMaterialGrid::OnContextMenuOpening()
 
 void SHdriVaultMaterialGrid::OnApplyMaterial()
 {
-	if (SelectedMaterial.IsValid())
+	if (const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = ResolveMaterial(SelectedMaterial))
 	{
-		OnMaterialApplied.ExecuteIfBound(SelectedMaterial);
+		OnMaterialApplied.ExecuteIfBound(MaterialItem);
 	}
 }
 
 void SHdriVaultMaterialGrid::OnBrowseToMaterial()
 {
-	if (SelectedMaterial.IsValid())
+	if (const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = ResolveMaterial(SelectedMaterial))
 	{
 		TArray<FAssetData> AssetDataArray;
-		AssetDataArray.Add(SelectedMaterial->AssetData);
+		AssetDataArray.Add(MaterialItem->GetAssetData());
 
 		FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
 		ContentBrowserModule.Get().SyncBrowserToAssets(AssetDataArray);
@@ -697,9 +780,9 @@ void SHdriVaultMaterialGrid::OnBrowseToMaterial()
 
 void SHdriVaultMaterialGrid::OnCopyMaterialPath()
 {
-	if (SelectedMaterial.IsValid())
+	if (const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = ResolveMaterial(SelectedMaterial))
 	{
-		FString AssetPath = SelectedMaterial->AssetData.GetObjectPathString();
+		FString AssetPath = MaterialItem->GetObjectPath().ToString();
 		FPlatformApplicationMisc::ClipboardCopy(*AssetPath);
 	}
 }
@@ -712,51 +795,163 @@ void SHdriVaultMaterialGrid::OnEditMaterialMetadata()
 
 void SHdriVaultMaterialGrid::UpdateFilteredMaterials()
 {
-	FilteredMaterials.Empty();
+	FilteredMaterials.Reset();
+
+	if (CurrentFilterText.IsEmpty() || !HdriVaultManager)
+	{
+		AsyncSearch->Cancel();
+		FilteredMaterials = *AllMaterials;
+		return;
+	}
+
+	// Matches arrive in batches on later frames; the view starts empty and fills in. The planner's index
+	// lookup runs here, the per-item checks against the snapshot on the worker.
+	AsyncSearch->Start(CurrentFilterText, HdriVaultManager->GetSnapshot(), TArray<FHdriVaultItemHandle>(*AllMaterials), CandidateSetId,
+		[this](TArray<FHdriVaultItemHandle>& OutSeed)
+		{
+			return HdriVaultManager->GetSearchCandidates(CurrentFilterText, OutSeed);
+		});
+}
+
+void SHdriVaultMaterialGrid::OnSearchResults(TConstArrayView<int32> CandidateIndices)
+{
+	// Indices refer to the candidate list the search was started with, which is still AllMaterials:
+	// replacing AllMaterials restarts the search and drops batches from the old one
+	for (const int32 Index : CandidateIndices)
+	{
+		if (AllMaterials->IsValidIndex(Index))
+		{
+			FilteredMaterials.Add((*AllMaterials)[Index]);
+		}
+	}
 
-	for (const auto& Material : AllMaterials)
+	RequestViewRefresh();
+}
+
+void SHdriVaultMaterialGrid::OnSearchFinished()
+{
+	// The view drops selections that are not in its source, so restore it once the item has streamed back in
+	if (SelectedMaterial.IsValid() && FilteredMaterials.Contains(SelectedMaterial))
 	{
-		if (DoesItemPassFilter(Material))
+		if (ViewMode == EHdriVaultViewMode::Grid && TileView.IsValid())
+		{
+			TileView->SetSelection(SelectedMaterial);
+		}
+		else if (ViewMode == EHdriVaultViewMode::List && ListView.IsValid())
 		{
-			FilteredMaterials.Add(Material);
+			ListView->SetSelection(SelectedMaterial);
 		}
+		ScrollToMaterial(SelectedMaterial);
 	}
 }
 
-bool SHdriVaultMaterialGrid::DoesItemPassFilter(TSharedPtr<FHdriVaultMaterialItem> Item) const
+void SHdriVaultMaterialGrid::OnManagerItemsChanged(const TArray<FHdriVaultItemHandle>& Items, EHdriVaultItemChange Change)
 {
-	if (!Item.IsValid())
+	// Rows cache the registry data and name they were generated with; refresh only the visible rows that changed
+	if (EnumHasAnyFlags(Change, EHdriVaultItemChange::Thumbnail | EHdriVaultItemChange::Asset | EHdriVaultItemChange::Metadata))
 	{
-		return false;
+		const bool bAssetChanged = EnumHasAnyFlags(Change, EHdriVaultItemChange::Asset);
+		const bool bThumbnailChanged = EnumHasAnyFlags(Change, EHdriVaultItemChange::Thumbnail | EHdriVaultItemChange::Asset);
+		const bool bNameChanged = EnumHasAnyFlags(Change, EHdriVaultItemChange::Asset | EHdriVaultItemChange::Metadata);
+		for (FHdriVaultItemHandle Item : Items)
+		{
+			const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = bNameChanged ? ResolveMaterial(Item) : nullptr;
+			if (ViewMode == EHdriVaultViewMode::Grid && TileView.IsValid())
+			{
+				if (TSharedPtr<SHdriVaultMaterialTile> Tile = StaticCastSharedPtr<SHdriVaultMaterialTile>(TileView->WidgetFromItem(Item)))
+				{
+					if (MaterialItem.IsValid())
+					{
+						if (bAssetChanged)
+						{
+							Tile->SetAssetData(MaterialItem->GetAssetData());
+						}
+						Tile->SetDisplayName(MaterialItem->GetDisplayName());
+					}
+					if (bThumbnailChanged)
+					{
+						Tile->RefreshThumbnail();
+					}
+				}
+			}
+			else if (ViewMode == EHdriVaultViewMode::List && ListView.IsValid())
+			{
+				if (TSharedPtr<SHdriVaultMaterialListItem> ListItem = StaticCastSharedPtr<SHdriVaultMaterialListItem>(ListView->WidgetFromItem(Item)))
+				{
+					if (MaterialItem.IsValid())
+					{
+						if (bAssetChanged)
+						{
+							ListItem->SetAssetData(MaterialItem->GetAssetData());
+						}
+						ListItem->SetDisplayName(MaterialItem->GetDisplayName());
+					}
+					if (bThumbnailChanged)
+					{
+						ListItem->RefreshThumbnail();
+					}
+				}
+			}
+		}
 	}
 
-	if (CurrentFilterText.IsEmpty())
+	if (CurrentFilterText.IsEmpty() || !HdriVaultManager || !EnumHasAnyFlags(Change, ~EHdriVaultItemChange::Thumbnail))
 	{
-		return true;
+		return;
 	}
 
-	// Check name
-	if (Item->DisplayName.Contains(CurrentFilterText))
+	// A search still in flight reads the previous snapshot, so run it again rather than patching partial results
+	if (AsyncSearch->IsRunning())
 	{
-		return true;
+		RefreshGrid();
+		return;
 	}
 
-	// Check path
-	if (Item->AssetData.PackagePath.ToString().Contains(CurrentFilterText))
+	const TSharedPtr<const FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> Snapshot = HdriVaultManager->GetSnapshot();
+	if (!Snapshot.IsValid())
 	{
-		return true;
+		return;
 	}
 
-	// Check metadata tags
-	for (const FString& ItemTag : Item->Metadata.Tags)
+	// Re-check just the changed items against the filter
+	const FHdriVaultQuery Query = FHdriVaultQuery::Parse(CurrentFilterText);
+	bool bMembershipChanged = false;
+	for (FHdriVaultItemHandle Item : Items)
 	{
-		if (ItemTag.Contains(CurrentFilterText))
+		const int32 AllIndex = AllMaterials->Find(Item);
+		if (AllIndex == INDEX_NONE)
 		{
-			return true;
+			continue;
+		}
+
+		const FHdriVaultSnapshotEntry* Entry = Snapshot->Find(Item);
+		const bool bMatches = Entry && Query.Matches(*Entry);
+		const int32 FilteredIndex = FilteredMaterials.Find(Item);
+		if (bMatches && FilteredIndex == INDEX_NONE)
+		{
+			// FilteredMaterials is an ordered subsequence of AllMaterials; find where the item falls in it
+			int32 InsertIndex = 0;
+			for (int32 Index = 0; Index < AllIndex && InsertIndex < FilteredMaterials.Num(); ++Index)
+			{
+				if ((*AllMaterials)[Index] == FilteredMaterials[InsertIndex])
+				{
+					++InsertIndex;
+				}
+			}
+			FilteredMaterials.Insert(Item, InsertIndex);
+			bMembershipChanged = true;
+		}
+		else if (!bMatches && FilteredIndex != INDEX_NONE)
+		{
+			FilteredMaterials.RemoveAt(FilteredIndex);
+			bMembershipChanged = true;
 		}
 	}
 
-	return false;
+	if (bMembershipChanged)
+	{
+		RequestViewRefresh();
+	}
 }
 
 FReply SHdriVaultMaterialGrid::OnDragOver(const FGeometry& MyGeometry, const FDragDropEvent& DragDropEvent)
@@ -808,7 +1003,7 @@ FReply SHdriVaultMaterialGrid::OnDrop(const FGeometry& MyGeometry, const FDragDr
 	return FReply::Unhandled();
 }
 
-void SHdriVaultMaterialGrid::UpdateSelection(TSharedPtr<FHdriVaultMaterialItem> NewSelection)
+void SHdriVaultMaterialGrid::UpdateSelection(FHdriVaultItemHandle NewSelection)
 {
 	if (SelectedMaterial != NewSelection)
 	{
@@ -817,18 +1012,32 @@ void SHdriVaultMaterialGrid::UpdateSelection(TSharedPtr<FHdriVaultMaterialItem>
 		// Update view selection
 		if (ViewMode == EHdriVaultViewMode::Grid && TileView.IsValid())
 		{
-			TileView->SetSelection(SelectedMaterial);
+			if (SelectedMaterial.IsValid())
+			{
+				TileView->SetSelection(SelectedMaterial);
+			}
+			else
+			{
+				TileView->ClearSelection();
+			}
 		}
 		else if (ViewMode == EHdriVaultViewMode::List && ListView.IsValid())
 		{
-			ListView->SetSelection(SelectedMaterial);
+			if (SelectedMaterial.IsValid())
+			{
+				ListView->SetSelection(SelectedMaterial);
+			}
+			else
+			{
+				ListView->ClearSelection();
+			}
 		}
 
-		OnMaterialSelected.ExecuteIfBound(SelectedMaterial);
+		OnMaterialSelected.ExecuteIfBound(ResolveMaterial(SelectedMaterial));
 	}
 }
 
-void SHdriVaultMaterialGrid::ScrollToMaterial(TSharedPtr<FHdriVaultMaterialItem> Material)
+void SHdriVaultMaterialGrid::ScrollToMaterial(FHdriVaultItemHandle Material)
 {
 	if (Material.IsValid())
 	{
@@ -845,13 +1054,18 @@ void SHdriVaultMaterialGrid::ScrollToMaterial(TSharedPtr<FHdriVaultMaterialItem>
 
 FText SHdriVaultMaterialGrid::GetStatusText() const
 {
-	int32 TotalMaterials = AllMaterials.Num();
+	int32 TotalMaterials = AllMaterials->Num();
 	int32 FilteredCount = FilteredMaterials.Num();
 
 	if (CurrentFilterText.IsEmpty())
 	{
 		return FText::Format(LOCTEXT("MaterialCountFormat", "{0} materials"), FText::AsNumber(TotalMaterials));
 	}
+	else if (AsyncSearch.IsValid() && AsyncSearch->IsRunning())
+	{
+		return FText::Format(LOCTEXT("SearchingMaterialCountFormat", "{0} of {1} materials (searching...)"),
+			FText::AsNumber(FilteredCount), FText::AsNumber(TotalMaterials));
+	}
 	else
 	{
 		return FText::Format(LOCTEXT("FilteredMaterialCountFormat", "{0} of {1} materials"), 
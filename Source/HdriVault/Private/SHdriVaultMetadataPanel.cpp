@@ -459,6 +459,7 @@ void SHdriVaultMetadataPanel::SetMaterialItem(TSharedPtr<FHdriVaultMaterialItem>
 	}
 
 	MaterialItem = InMaterialItem;
+	MaterialAssetData = MaterialItem.IsValid() ? MaterialItem->GetAssetData() : FAssetData();
 	PreviewThumbnail.Reset();
 	CustomPreviewBrush.Reset();
 	CurrentPreviewTexture.Reset();
@@ -496,7 +497,7 @@ void SHdriVaultMetadataPanel::SaveMetadata()
 	{
 		// Check if material name changed and offer to rename asset
 		FString NewName = MaterialItem->Metadata.MaterialName;
-		FString CurrentAssetName = MaterialItem->AssetData.AssetName.ToString();
+		FString CurrentAssetName = MaterialItem->GetObjectPath().GetAssetName();
 		
 		if (!NewName.IsEmpty() && NewName != CurrentAssetName)
 		{
@@ -903,7 +904,7 @@ FReply SHdriVaultMetadataPanel::OnBrowseToMaterialClicked()
 	if (MaterialItem.IsValid())
 	{
 		TArray<FAssetData> AssetDataArray;
-		AssetDataArray.Add(MaterialItem->AssetData);
+		AssetDataArray.Add(MaterialAssetData);
 
 		FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
 		ContentBrowserModule.Get().SyncBrowserToAssets(AssetDataArray);
@@ -918,7 +919,7 @@ FReply SHdriVaultMetadataPanel::OnOpenMaterialEditorClicked()
 		UAssetEditorSubsystem* AssetEditorSubsystem = GEditor->GetEditorSubsystem<UAssetEditorSubsystem>();
 		if (AssetEditorSubsystem)
 		{
-			UObject* MaterialObject = MaterialItem->AssetData.GetAsset();
+			UObject* MaterialObject = MaterialItem->MaterialPtr.LoadSynchronous();
 			if (MaterialObject)
 			{
 				AssetEditorSubsystem->OpenEditorForAsset(MaterialObject);
@@ -945,7 +946,7 @@ void SHdriVaultMetadataPanel::UpdateUI()
 
 		if (LocationTextBlock.IsValid())
 		{
-			LocationTextBlock->SetText(FText::FromString(MaterialItem->Metadata.Location));
+			LocationTextBlock->SetText(FText::FromString(MaterialItem->GetPackageName()));
 		}
 		
 		if (AuthorTextBox.IsValid())
@@ -1018,7 +1019,7 @@ void SHdriVaultMetadataPanel::UpdatePreviewWidget()
 	}
 	else if (MaterialItem.IsValid())
 	{
-		PreviewThumbnail = MakeShareable(new FAssetThumbnail(MaterialItem->AssetData, PreviewImageSize.X, PreviewImageSize.Y, UThumbnailManager::Get().GetSharedThumbnailPool()));
+		PreviewThumbnail = MakeShareable(new FAssetThumbnail(MaterialAssetData, PreviewImageSize.X, PreviewImageSize.Y, UThumbnailManager::Get().GetSharedThumbnailPool()));
 		ContentWidget = PreviewThumbnail->MakeThumbnailWidget();
 	}
 	else
@@ -1074,7 +1075,7 @@ FText SHdriVaultMetadataPanel::GetMaterialTypeText() const
 {
 	if (MaterialItem.IsValid())
 	{
-		return FText::FromString(MaterialItem->AssetData.AssetClassPath.GetAssetName().ToString());
+		return FText::FromString(MaterialAssetData.AssetClassPath.GetAssetName().ToString());
 	}
 	return FText::GetEmpty();
 }
@@ -1087,10 +1088,10 @@ FText SHdriVaultMetadataPanel::GetMaterialSizeText() const
 	}
 
 	FString Dimensions = TEXT("Unknown");
-	MaterialItem->AssetData.GetTagValue(TEXT("Dimensions"), Dimensions);
+	MaterialAssetData.GetTagValue(TEXT("Dimensions"), Dimensions);
 	
 	int64 ResourceSizeBytes = 0;
-	MaterialItem->AssetData.GetTagValue(TEXT("ResourceSize"), ResourceSizeBytes);
+	MaterialAssetData.GetTagValue(TEXT("ResourceSize"), ResourceSizeBytes);
 	
 	// Format: 2048x1024 (4.0 MB)
 	if (ResourceSizeBytes > 0)
@@ -1223,10 +1224,10 @@ bool SHdriVaultMetadataPanel::RenameAsset(const FString& NewName)
 		return false;
 	}
 
-	// Just update the metadata name (no actual asset renaming)
+	// Just update the metadata name (no actual asset renaming); it is the item's display name, and saving
+	// re-keys the catalog's name column and search tokens
 	FString OldName = MaterialItem->Metadata.MaterialName;
 	MaterialItem->Metadata.MaterialName = NewName;
-	MaterialItem->DisplayName = NewName;
 	
 	// Mark as changed for saving
 	MarkAsChanged();
@@ -6,6 +6,7 @@
 #include "SHdriVaultMaterialGrid.h"
 #include "SHdriVaultMetadataPanel.h"
 #include "SHdriVaultCategoriesPanel.h"
+#include "HdriVaultQuery.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Layout/SBox.h"
 #include "Widgets/Layout/SSplitter.h"
@@ -60,6 +61,9 @@ void SHdriVaultWidget::Construct(const FArguments& InArgs)
 		HdriVaultManager->OnMaterialDoubleClicked.AddSP(this, &SHdriVaultWidget::OnMaterialDoubleClicked);
 		HdriVaultManager->OnSettingsChanged.AddSP(this, &SHdriVaultWidget::OnSettingsChanged);
 		HdriVaultManager->OnRefreshRequested.AddSP(this, &SHdriVaultWidget::OnRefreshRequested);
+		HdriVaultManager->OnItemsAdded.AddSP(this, &SHdriVaultWidget::OnItemsAdded);
+		HdriVaultManager->OnItemsRemoved.AddSP(this, &SHdriVaultWidget::OnItemsRemoved);
+		HdriVaultManager->OnItemsChanged.AddSP(this, &SHdriVaultWidget::OnItemsChanged);
 	}
 	
 	// Bind widget events
@@ -72,6 +76,7 @@ void SHdriVaultWidget::Construct(const FArguments& InArgs)
 	{
 		CategoriesWidget->OnCategorySelected.BindSP(this, &SHdriVaultWidget::OnCategorySelected);
 		CategoriesWidget->OnTagSelected.BindSP(this, &SHdriVaultWidget::OnTagSelected);
+		CategoriesWidget->OnCategoryContentsChanged.BindSP(this, &SHdriVaultWidget::OnCategoryContentsChanged);
 	}
 	
 	if (MaterialGridWidget.IsValid())
@@ -81,11 +86,6 @@ void SHdriVaultWidget::Construct(const FArguments& InArgs)
 		MaterialGridWidget->OnMaterialApplied.BindSP(this, &SHdriVaultWidget::OnMaterialApplied);
 	}
 	
-	if (MetadataWidget.IsValid())
-	{
-		MetadataWidget->OnMetadataChanged.BindSP(this, &SHdriVaultWidget::OnMetadataChanged);
-	}
-	
 	// Initial refresh
 	RefreshInterface();
 
@@ -104,7 +104,12 @@ void SHdriVaultWidget::Tick(const FGeometry& AllottedGeometry, const double InCu
 {
 	SCompoundWidget::Tick(AllottedGeometry, InCurrentTime, InDeltaTime);
 	
-	// Update thumbnails or other time-based operations if needed
+	// Bursts of asset events reload the visible set once per frame
+	if (bMaterialGridDirty)
+	{
+		bMaterialGridDirty = false;
+		UpdateMaterialGrid();
+	}
 }
 
 void SHdriVaultWidget::RefreshInterface()
@@ -126,16 +131,9 @@ void SHdriVaultWidget::RefreshInterface()
 			CurrentCategoryName = CurrentSelectedCategory->CategoryName;
 		}
 		
-		// Refresh the database
+		// Refresh the database; categories and tags follow from the manager's notifications
 		HdriVaultManager->RefreshMaterialDatabase();
 		
-		// Refresh categories and tags explicitly
-		if (CategoriesWidget.IsValid())
-		{
-			CategoriesWidget->RefreshCategories();
-			CategoriesWidget->RefreshTags();
-		}
-		
 		// Restore selections after refresh
 		if (!CurrentFolderPath.IsEmpty() && bShowFolders)
 		{
@@ -155,7 +153,6 @@ void SHdriVaultWidget::RefreshInterface()
 			// Restore category selection
 			if (CategoriesWidget.IsValid())
 			{
-				CategoriesWidget->RefreshCategories();
 				CategoriesWidget->SetSelectedCategoryByName(CurrentCategoryName);
 				// Update our local pointer to the new one
 				CurrentSelectedCategory = CategoriesWidget->GetSelectedCategory();
@@ -167,7 +164,6 @@ void SHdriVaultWidget::RefreshInterface()
 			CurrentSelectedTag = CurrentTag;
 			if (CategoriesWidget.IsValid())
 			{
-				CategoriesWidget->RefreshTags();
 				CategoriesWidget->SetSelectedTag(CurrentTag);
 			}
 		}
@@ -226,7 +222,7 @@ TSharedRef<SWidget> SHdriVaultWidget::CreateToolbar()
 			.FillWidth(1.0f)
 			.Padding(10.0f, 2.0f)
 			[
-				SNew(SSearchBox)
+				SAssignNew(SearchBox, SSearchBox)
 				.OnTextChanged(this, &SHdriVaultWidget::OnSearchTextChanged)
 				.HintText(NSLOCTEXT("HdriVault", "SearchHint", "Search materials..."))
 			]
@@ -389,7 +385,7 @@ FReply SHdriVaultWidget::OnBrowseToFolderClicked()
 	if (CurrentSelectedMaterial.IsValid())
 	{
 		TArray<FAssetData> AssetDataArray;
-		AssetDataArray.Add(CurrentSelectedMaterial->AssetData);
+		AssetDataArray.Add(CurrentSelectedMaterial->GetAssetData());
 
 		FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
 		ContentBrowserModule.Get().SyncBrowserToAssets(AssetDataArray);
@@ -412,7 +408,18 @@ void SHdriVaultWidget::OnThumbnailSizeChanged(float NewSize)
 void SHdriVaultWidget::OnSearchTextChanged(const FText& SearchText)
 {
 	CurrentSearchText = SearchText.ToString();
-	UpdateMaterialGrid();
+
+	// Terms the query parser had to drop are shown on the box rather than silently widening the results
+	if (SearchBox.IsValid())
+	{
+		SearchBox->SetError(FString::Join(FHdriVaultQuery::Parse(CurrentSearchText).GetWarnings(), TEXT("\n")));
+	}
+
+	// The visible set is unchanged, so only the filter is re-run; keeping the same candidate list lets the grid narrow from the last results
+	if (MaterialGridWidget.IsValid())
+	{
+		MaterialGridWidget->SetFilterText(CurrentSearchText);
+	}
 }
 
 void SHdriVaultWidget::OnSortModeChanged(EHdriVaultSortMode NewSortMode)
@@ -464,7 +471,7 @@ void SHdriVaultWidget::OnMaterialDoubleClicked(TSharedPtr<FHdriVaultMaterialItem
 	// Apply material to selected objects or open material editor
 	if (HdriVaultManager)
 	{
-		HdriVaultManager->ApplyMaterialToSelection(SelectedMaterial);
+		HdriVaultManager->ApplyMaterialToSelectionAsync(SelectedMaterial);
 	}
 }
 
@@ -473,16 +480,7 @@ void SHdriVaultWidget::OnMaterialApplied(TSharedPtr<FHdriVaultMaterialItem> Mate
 	// Apply material to selected objects
 	if (HdriVaultManager && MaterialToApply.IsValid())
 	{
-		HdriVaultManager->ApplyMaterialToSelection(MaterialToApply);
-	}
-}
-
-void SHdriVaultWidget::OnMetadataChanged(TSharedPtr<FHdriVaultMaterialItem> ChangedMaterial)
-{
-	// Refresh the material grid to show updated metadata
-	if (MaterialGridWidget.IsValid())
-	{
-		MaterialGridWidget->RefreshGrid();
+		HdriVaultManager->ApplyMaterialToSelectionAsync(MaterialToApply);
 	}
 }
 
@@ -503,6 +501,94 @@ void SHdriVaultWidget::OnRefreshRequested()
 	UpdateMaterialGrid();
 }
 
+void SHdriVaultWidget::OnItemsAdded(const TArray<FHdriVaultItemHandle>& Items)
+{
+	// Category views are reloaded through OnCategoryContentsChanged once the panel has sorted the items
+	if (!bShowFolders && CurrentSelectedCategory.IsValid())
+	{
+		return;
+	}
+
+	for (FHdriVaultItemHandle Item : Items)
+	{
+		if (DoesViewContain(Item))
+		{
+			bMaterialGridDirty = true;
+			return;
+		}
+	}
+}
+
+void SHdriVaultWidget::OnItemsRemoved(const TArray<FHdriVaultItemHandle>& Items)
+{
+	// The catalog clears an item's handle when the item leaves it
+	if (CurrentSelectedMaterial.IsValid() && !CurrentSelectedMaterial->Handle.IsValid())
+	{
+		CurrentSelectedMaterial.Reset();
+		UpdateMetadataPanel();
+	}
+
+	if ((!bShowFolders && CurrentSelectedCategory.IsValid()) || !MaterialGridWidget.IsValid())
+	{
+		return;
+	}
+
+	// Removed handles no longer resolve, so compare them with what the grid is listing
+	for (FHdriVaultItemHandle Item : Items)
+	{
+		if (MaterialGridWidget->ContainsMaterial(Item))
+		{
+			bMaterialGridDirty = true;
+			return;
+		}
+	}
+}
+
+void SHdriVaultWidget::OnItemsChanged(const TArray<FHdriVaultItemHandle>& Items, EHdriVaultItemChange Change)
+{
+	// Only a tag view can gain or lose materials through an edit; other changes are handled per row by the grid
+	if (!bShowFolders && !CurrentSelectedCategory.IsValid() && !CurrentSelectedTag.IsEmpty() && EnumHasAnyFlags(Change, EHdriVaultItemChange::Tags))
+	{
+		bMaterialGridDirty = true;
+	}
+}
+
+void SHdriVaultWidget::OnCategoryContentsChanged(TSharedPtr<FHdriVaultCategoryItem> Category)
+{
+	if (!bShowFolders && Category.IsValid() && Category == CurrentSelectedCategory)
+	{
+		bMaterialGridDirty = true;
+	}
+}
+
+bool SHdriVaultWidget::DoesViewContain(FHdriVaultItemHandle Material) const
+{
+	if (!Material.IsValid() || !HdriVaultManager)
+	{
+		return false;
+	}
+
+	if (bShowFolders)
+	{
+		// A folder view lists its whole subtree
+		if (!CurrentSelectedFolder.IsValid())
+		{
+			return false;
+		}
+		const FString MaterialFolder = HdriVaultManager->GetMaterialFolderPath(Material);
+		const FString& ViewFolder = CurrentSelectedFolder->FolderPath;
+		return MaterialFolder == ViewFolder || MaterialFolder.StartsWith(ViewFolder + TEXT("/"));
+	}
+
+	if (!CurrentSelectedTag.IsEmpty())
+	{
+		const TSharedPtr<FHdriVaultMaterialItem> MaterialItem = HdriVaultManager->GetMaterial(Material);
+		return MaterialItem.IsValid() && MaterialItem->Metadata.Tags.Contains(CurrentSelectedTag);
+	}
+
+	return false;
+}
+
 void SHdriVaultWidget::UpdateMaterialGrid()
 {
 	if (MaterialGridWidget.IsValid())
@@ -526,7 +612,8 @@ void SHdriVaultWidget::UpdateMaterialGrid()
 			else if (!CurrentSelectedTag.IsEmpty() && HdriVaultManager)
 			{
 				// Restore tag view if no category is selected but a tag is
-				TArray<TSharedPtr<FHdriVaultMaterialItem>> TaggedMaterials = HdriVaultManager->FilterMaterialsByTag(CurrentSelectedTag);
+				TArray<FHdriVaultItemHandle> TaggedMaterials;
+				HdriVaultManager->FilterMaterialsByTag(CurrentSelectedTag, TaggedMaterials);
 				MaterialGridWidget->SetMaterials(TaggedMaterials);
 				MaterialGridWidget->SetFilterText(CurrentSearchText);
 			}
@@ -547,7 +634,7 @@ void SHdriVaultWidget::UpdateMaterialGrid()
 		// Try to restore selection if the item exists in the new view
 		if (CurrentSelectedMaterial.IsValid())
 		{
-			MaterialGridWidget->SetSelectedMaterial(CurrentSelectedMaterial);
+			MaterialGridWidget->SetSelectedMaterial(CurrentSelectedMaterial->Handle);
 		}
 
 		bIsUpdatingView = false;
@@ -565,7 +652,7 @@ void SHdriVaultWidget::UpdateMaterialGridFromCategory()
 		
 		if (CurrentSelectedMaterial.IsValid())
 		{
-			MaterialGridWidget->SetSelectedMaterial(CurrentSelectedMaterial);
+			MaterialGridWidget->SetSelectedMaterial(CurrentSelectedMaterial->Handle);
 		}
 
 		bIsUpdatingView = false;
@@ -579,13 +666,14 @@ void SHdriVaultWidget::UpdateMaterialGridFromTag()
 		bIsUpdatingView = true;
 
 		// Get materials with the selected tag
-		TArray<TSharedPtr<FHdriVaultMaterialItem>> TaggedMaterials = HdriVaultManager->FilterMaterialsByTag(CurrentSelectedTag);
+		TArray<FHdriVaultItemHandle> TaggedMaterials;
+		HdriVaultManager->FilterMaterialsByTag(CurrentSelectedTag, TaggedMaterials);
 		MaterialGridWidget->SetMaterials(TaggedMaterials);
 		MaterialGridWidget->SetFilterText(CurrentSearchText);
 
 		if (CurrentSelectedMaterial.IsValid())
 		{
-			MaterialGridWidget->SetSelectedMaterial(CurrentSelectedMaterial);
+			MaterialGridWidget->SetSelectedMaterial(CurrentSelectedMaterial->Handle);
 		}
 
 		bIsUpdatingView = false;
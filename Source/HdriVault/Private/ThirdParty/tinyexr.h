@@ -148,6 +148,8 @@ extern "C" {
 #define TINYEXR_COMPRESSIONTYPE_ZIPS (2)
 #define TINYEXR_COMPRESSIONTYPE_ZIP (3)
 #define TINYEXR_COMPRESSIONTYPE_PIZ (4)
+#define TINYEXR_COMPRESSIONTYPE_DWAA (8)  // Needs TINYEXR_DWA_DECOMPRESS
+#define TINYEXR_COMPRESSIONTYPE_DWAB (9)  // Needs TINYEXR_DWA_DECOMPRESS
 #define TINYEXR_COMPRESSIONTYPE_ZFP (128)  // TinyEXR extension
 
 #define TINYEXR_ZFP_COMPRESSIONTYPE_RATE (0)
@@ -7608,7 +7610,13 @@ static bool DecompressZip(unsigned char *dst,
   }
   std::vector<unsigned char> tmpBuf(*uncompressed_size);
 
-#if TINYEXR_USE_MINIZ
+#if defined(TINYEXR_INFLATE)
+  // HdriVault: user-supplied inflater, with the signature of zlib's uncompress
+  // returning true on success.
+  if (!TINYEXR_INFLATE(&tmpBuf.at(0), uncompressed_size, src, src_size)) {
+    return false;
+  }
+#elif TINYEXR_USE_MINIZ
   int ret =
       miniz::mz_uncompress(&tmpBuf.at(0), uncompressed_size, src, src_size);
   if (miniz::MZ_OK != ret) {
@@ -9847,7 +9855,9 @@ static bool DecodePixelData(/* out */ unsigned char **out_images,
 #endif
 
   } else if (compression_type == TINYEXR_COMPRESSIONTYPE_ZIPS ||
-             compression_type == TINYEXR_COMPRESSIONTYPE_ZIP) {
+             compression_type == TINYEXR_COMPRESSIONTYPE_ZIP ||
+             compression_type == TINYEXR_COMPRESSIONTYPE_DWAA ||
+             compression_type == TINYEXR_COMPRESSIONTYPE_DWAB) {
     // Allocate original data size.
     std::vector<unsigned char> outBuf(static_cast<size_t>(width) *
                                       static_cast<size_t>(num_lines) *
@@ -9855,6 +9865,18 @@ static bool DecodePixelData(/* out */ unsigned char **out_images,
 
     unsigned long dstLen = static_cast<unsigned long>(outBuf.size());
     TEXR_ASSERT(dstLen > 0);
+#if defined(TINYEXR_DWA_DECOMPRESS)
+    // HdriVault: DWA chunks decode to the same layout as ZIP ones. Returns
+    // true on success.
+    if (compression_type == TINYEXR_COMPRESSIONTYPE_DWAA ||
+        compression_type == TINYEXR_COMPRESSIONTYPE_DWAB) {
+      if (!TINYEXR_DWA_DECOMPRESS(&outBuf.at(0), outBuf.size(), data_ptr,
+                                  data_len, num_channels, channels, width,
+                                  num_lines)) {
+        return false;
+      }
+    } else
+#endif
     if (!tinyexr::DecompressZip(
             reinterpret_cast<unsigned char *>(&outBuf.at(0)), &dstLen, data_ptr,
             static_cast<unsigned long>(data_len))) {
@@ -10535,6 +10557,18 @@ static int ParseEXRHeader(HeaderInfo *info, bool *empty_header,
 #endif
       }
 
+      if (data[0] == TINYEXR_COMPRESSIONTYPE_DWAA ||
+          data[0] == TINYEXR_COMPRESSIONTYPE_DWAB) {
+#if defined(TINYEXR_DWA_DECOMPRESS)
+        ok = true;
+#else
+        if (err) {
+          (*err) = "DWA compression is not supported.";
+        }
+        return TINYEXR_ERROR_UNSUPPORTED_FORMAT;
+#endif
+      }
+
       if (data[0] == TINYEXR_COMPRESSIONTYPE_ZFP) {
 #if TINYEXR_USE_ZFP
         ok = true;
@@ -10816,6 +10850,10 @@ static int DecodeChunk(EXRImage *exr_image, const EXRHeader *exr_header,
     num_scanline_blocks = 16;
   } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_PIZ) {
     num_scanline_blocks = 32;
+  } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_DWAA) {
+    num_scanline_blocks = 32;
+  } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_DWAB) {
+    num_scanline_blocks = 256;
   } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_ZFP) {
     num_scanline_blocks = 16;
   }
@@ -11226,6 +11264,10 @@ static int DecodeEXRImage(EXRImage *exr_image, const EXRHeader *exr_header,
     num_scanline_blocks = 16;
   } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_PIZ) {
     num_scanline_blocks = 32;
+  } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_DWAA) {
+    num_scanline_blocks = 32;
+  } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_DWAB) {
+    num_scanline_blocks = 256;
   } else if (exr_header->compression_type == TINYEXR_COMPRESSIONTYPE_ZFP) {
     num_scanline_blocks = 16;
   }
@@ -8,6 +8,8 @@
 #include "Widgets/Docking/SDockTab.h"
 #include "HdriVaultTypes.h"
 
+HDRIVAULT_API DECLARE_LOG_CATEGORY_EXTERN(LogHdriVault, Log, All);
+
 class FToolBarBuilder;
 class FMenuBuilder;
 class SHdriVaultWidget;
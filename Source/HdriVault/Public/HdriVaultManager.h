@@ -10,8 +10,15 @@
 #include "Materials/MaterialInterface.h"
 #include "HdriVaultTypes.h"
 #include "EditorSubsystem.h"
+#include "HAL/CriticalSection.h"
+#include "IO/IoHash.h"
+#include "HdriVaultOperation.h"
 #include "HdriVaultManager.generated.h"
 
+struct FHdriVaultImportOptions;
+struct FHdriVaultImportFileResult;
+enum class EHdriVaultWorkPriority : uint8;
+
 UCLASS()
 class HDRIVAULT_API UHdriVaultManager : public UEditorSubsystem
 {
@@ -34,39 +41,81 @@ public:
 	TSharedPtr<FHdriVaultFolderNode> FindFolder(const FString& FolderPath) const;
 	TArray<TSharedPtr<FHdriVaultFolderNode>> GetChildFolders(const FString& FolderPath) const;
 	
-	// Material operations
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> GetMaterialsInFolder(const FString& FolderPath) const;
+	// Material operations. Views and lists hold handles; resolve one with GetMaterial when its item is needed.
+	TSharedRef<const TArray<FHdriVaultItemHandle>> GetMaterialsInFolderView(const FString& FolderPath) const;
 	TSharedPtr<FHdriVaultMaterialItem> GetMaterialByPath(const FString& AssetPath) const;
+	TSharedPtr<FHdriVaultMaterialItem> GetMaterial(FHdriVaultItemHandle Handle) const;
+	int32 GetNumMaterials() const;
+	void ForEachMaterial(TFunctionRef<void(FHdriVaultItemHandle)> Visitor) const;
+	FString GetMaterialFolderPath(FHdriVaultItemHandle Handle) const;
+	void SortMaterials(TArray<FHdriVaultItemHandle>& Handles) const;
+	
+	// Shared queue for budgeted game-thread work
+	TSharedPtr<class FHdriVaultWorkScheduler> GetWorkScheduler() const { return WorkScheduler; }
+	
+	// The vault's own worker threads for background work
+	TSharedPtr<class FHdriVaultWorkerPool> GetWorkerPool() const { return WorkerPool; }
+	
+	// Drops queued thumbnail, search and reconcile work, e.g. when the vault tab closes. Imports keep running.
+	void CancelQueuedWork();
+	
+	// Latest published catalog snapshot. Safe to call and read from any thread.
+	TSharedPtr<const class FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> GetSnapshot() const;
 	void LoadMaterialThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
 	void LoadMaterialDependencies(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
 	void ApplyMaterialToSelection(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
 	
 	// Metadata operations
 	void SaveMaterialMetadata(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
+	void SaveMaterialMetadata(const TArray<FHdriVaultItemHandle>& Handles);
 	void LoadMaterialMetadata(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
 	void RegenerateMaterialThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, int32 ThumbnailSize = 512);
 	UTexture2D* ImportCustomThumbnail(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, const FString& SourceFile, int32 ThumbnailSize = 512);
 	
-	// Import operations
+	// Import operations. Shows the import dialog, which queues the import as a background job.
 	void ImportHdriFiles(const TArray<FString>& Files);
+	
+	// Async variants. Each returns at once with a handle for progress, cancellation and chaining;
+	// UObject work stays on the game thread, sliced through the work scheduler
+	FHdriVaultOperationRef RefreshMaterialDatabaseAsync();
+	FHdriVaultOperationRef ImportHdriFilesAsync(const FHdriVaultImportOptions& Options);
+	FHdriVaultOperationRef RegenerateMaterialThumbnailAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, int32 ThumbnailSize = 512);
+	FHdriVaultOperationRef LoadMaterialDependenciesAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
+	FHdriVaultOperationRef ApplyMaterialToSelectionAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem);
 
 	// Settings
 	const FHdriVaultSettings& GetSettings() const { return Settings; }
 	void SetSettings(const FHdriVaultSettings& NewSettings);
 	
 	// Search and filtering
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> SearchMaterials(const FString& SearchTerm) const;
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> FilterMaterialsByTag(const FString& Tag) const;
+	// Results come back in the current sort order
+	void SearchMaterials(const FString& SearchTerm, TArray<FHdriVaultItemHandle>& OutHandles) const;
+	void FilterMaterialsByTag(const FString& Tag, TArray<FHdriVaultItemHandle>& OutHandles) const;
+	void SearchMaterialHandles(const FString& SearchTerm, TSet<FHdriVaultItemHandle>& OutHandles) const;
+	
+	// Superset of the matches drawn from the index the query planner picks, for searches that check items
+	// against a snapshot themselves. Returns false when no term is indexed and every item is a candidate.
+	bool GetSearchCandidates(const FString& SearchTerm, TArray<FHdriVaultItemHandle>& OutHandles) const;
+	
+	// Tag index
+	TArray<FString> GetAllTags() const;
+	int32 GetTagCount(const FString& Tag) const;
 	
 	// Delegates
 	FOnHdriVaultFolderSelected OnFolderSelected;
 	FOnHdriVaultMaterialSelected OnMaterialSelected;
 	FOnHdriVaultMaterialDoubleClicked OnMaterialDoubleClicked;
 	FOnHdriVaultSettingsChanged OnSettingsChanged;
+	
+	// Fired after a full rebuild of the database; views should reload everything
 	FOnHdriVaultRefreshRequested OnRefreshRequested;
-
-	// Needs to be public for SHdriVaultCategoriesPanel to access efficiently
-	TMap<FString, TSharedPtr<FHdriVaultMaterialItem>> MaterialMap;
+	
+	// Fired for individual changes, after the indexes and snapshot have been updated
+	FOnHdriVaultItemsAdded OnItemsAdded;
+	FOnHdriVaultItemsRemoved OnItemsRemoved;
+	FOnHdriVaultItemsChanged OnItemsChanged;
+	FOnHdriVaultFolderAdded OnFolderAdded;
+	FOnHdriVaultFolderRemoved OnFolderRemoved;
 
 private:
 	// Asset registry callbacks
@@ -76,13 +125,51 @@ private:
 	void OnAssetUpdated(const FAssetData& AssetData);
 	
 	// Internal helpers
+	void QueryHdriAssets(TArray<FAssetData>& OutAssets) const;
+	void GetScanRoots(TArray<FString>& OutPaths) const;
+	void QueryHdriAssetsInFolder(const FString& PackagePath, TArray<FAssetData>& OutAssets, TArray<FString>& OutSubPaths) const;
+	void LoadMaterialDatabase(const TArray<FAssetData>& HdriAssets);
+	void MergeMaterialDatabase(const TArray<FAssetData>& HdriAssets, const TArray<TSharedPtr<FHdriVaultMaterialItem>>& MaterialItems, const TArray<FDateTime>& MetadataFileTimes);
+	bool StepReconcile(struct FHdriVaultReconcilePass& Pass, double Deadline);
+	void ReloadChangedMetadata(FHdriVaultItemHandle Handle, FString& Scratch);
+	void PublishPendingChanges();
+	void BeginBackgroundReconcile();
+	bool StepBackgroundReconcile(double Deadline);
+	void CreateMaterialItems(TConstArrayView<FAssetData> Assets, TArray<TSharedPtr<FHdriVaultMaterialItem>>& OutItems, TArray<FDateTime>& OutMetadataFileTimes) const;
+	void AddMaterialItem(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, const FAssetData& AssetData, const FDateTime& MetadataFileTime);
+	bool GatherMaterialDependencies(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, UObject* Asset);
+	bool ApplyHdriToLevel(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, UObject* Asset);
+	bool RegenerateThumbnailForAsset(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem, UObject* Asset, int32 ThumbnailSize);
+	FHdriVaultImportFileResult ImportPreparedFile(const FString& File, const FHdriVaultImportOptions& Options);
+	
+	// Async operation plumbing
+	FHdriVaultOperationRef BeginOperation();
+	void CancelActiveOperations();
+	void LoadAssetForOperation(const FHdriVaultOperationRef& Operation, const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem,
+		EHdriVaultWorkPriority Priority, TFunction<bool(UObject*)>&& OnLoaded);
+	void StepReconcileAsync(const FHdriVaultOperationRef& Operation, const TSharedRef<struct FHdriVaultReconcilePass>& Pass);
+	FIoHash GetPackageStamp(const FAssetData& AssetData) const;
+	void UpdateScanScope();
+	bool IsInScanScope(const FAssetData& AssetData) const;
+	bool IsPathInScanScope(const FString& PackagePath) const;
 	void ProcessMaterialAsset(const FAssetData& AssetData);
-	void RemoveMaterialAsset(const FAssetData& AssetData);
+	void RemoveMaterialAsset(const FSoftObjectPath& ObjectPath);
+	void QueueItemChanged(FHdriVaultItemHandle Handle, EHdriVaultItemChange Change);
+	void BroadcastPendingChanges();
+	EHdriVaultItemChange ReindexMaterial(const TSharedPtr<FHdriVaultMaterialItem>& MaterialItem);
+	void AddMaterialToFolder(FHdriVaultItemHandle Handle);
+	void RemoveMaterialFromFolder(FHdriVaultItemHandle Handle);
+	void InvalidateFolderViews(TSharedPtr<FHdriVaultFolderNode> FolderNode);
+	void PublishSnapshot();
 	TSharedPtr<FHdriVaultFolderNode> CreateFolderNode(const FString& FolderPath);
 	TSharedPtr<FHdriVaultFolderNode> GetOrCreateFolderNode(const FString& FolderPath);
-	void SortMaterials(TArray<TSharedPtr<FHdriVaultMaterialItem>>& Materials) const;
-	FString GetMetadataFilePath(const FAssetData& AssetData) const;
+	FString GetMetadataFilePath(const FSoftObjectPath& ObjectPath) const;
 	FString OrganizePackagePath(const FString& PackagePath) const;
+	void AddTagsToIndex(FHdriVaultItemHandle Handle, const TArray<FString>& Tags);
+	void RemoveTagsFromIndex(FHdriVaultItemHandle Handle, const TArray<FString>& Tags);
+	void ExecuteQuery(const class FHdriVaultQuery& Query, TArray<FHdriVaultItemHandle>& OutHandles) const;
+	int32 SeedQueryCandidates(const class FHdriVaultQuery& Query, TArray<FHdriVaultItemHandle>& OutCandidates, bool& bOutSeedIsExact) const;
+	void GetResolutionRange(const struct FHdriVaultQueryTerm& Term, int32& OutBegin, int32& OutEnd) const;
 	
 	// Data members
 	TSharedPtr<FHdriVaultFolderNode> RootFolderNode;
@@ -90,14 +177,64 @@ private:
 	
 	FHdriVaultSettings Settings;
 	
+	// Normalized scan scope derived from Settings. Without configured include paths this is just RootFolder;
+	// it is empty only when "/" was named, which scans every mount point and so the whole project registry.
+	TArray<FString> ScanIncludePaths;
+	TArray<FString> ScanExcludePaths;
+	
 	// Asset registry
 	FAssetRegistryModule* AssetRegistryModule;
 	
 	// Thumbnail manager
 	TSharedPtr<class FHdriVaultThumbnailManager> ThumbnailManager;
 	
-	// Metadata cache
-	TMap<FString, FHdriVaultMetadata> MetadataCache;
+	// Write-behind metadata persistence
+	TSharedPtr<class FHdriVaultMetadataWriter> MetadataWriter;
+	
+	// Dedicated worker threads with interactive and bulk priorities
+	TSharedPtr<class FHdriVaultWorkerPool> WorkerPool;
+	
+	// Budgeted game-thread work queue shared by every vault system
+	TSharedPtr<class FHdriVaultWorkScheduler> WorkScheduler;
+	
+	// Background import jobs, one file at a time
+	TSharedPtr<class FHdriVaultImportQueue, ESPMode::ThreadSafe> ImportQueue;
+	
+	// Periodic background reconciliation and the pass it is currently advancing
+	TSharedPtr<class FHdriVaultRefreshScheduler> RefreshScheduler;
+	TSharedPtr<struct FHdriVaultReconcilePass> ReconcilePass;
+	
+	// Async operations still running; cancelled when their queued work is dropped
+	TArray<TWeakPtr<FHdriVaultOperation, ESPMode::ThreadSafe>> ActiveOperations;
+	
+	// Every vault item, addressed by handle
+	TSharedPtr<class FHdriVaultCatalog> Catalog;
+	
+	// Tag index (tag -> items carrying it), kept in sync with saved/loaded metadata
+	TMap<FString, TSet<FHdriVaultItemHandle>> TagIndex;
+	
+	// Full-text index over names, paths, tags, notes, authors and categories
+	TSharedPtr<class FHdriVaultSearchIndex> SearchIndex;
+	
+	// Items sorted by resolution for range queries, rebuilt lazily after the catalog changes
+	mutable TArray<TPair<int32, FHdriVaultItemHandle>> ResolutionIndex;
+	mutable bool bResolutionIndexDirty = true;
+	
+	// Published snapshot for background readers; the lock only guards swapping the pointer
+	TSharedPtr<const class FHdriVaultCatalogSnapshot, ESPMode::ThreadSafe> CurrentSnapshot;
+	mutable FRWLock SnapshotLock;
+	uint64 SnapshotVersion = 0;
+	
+	// Aggregated, sorted contents of each folder's subtree, keyed by folder path, then by sort modes
+	mutable TMap<FString, TMap<uint16, TSharedRef<const TArray<FHdriVaultItemHandle>>>> FolderViewCache;
+	
+	// Item notifications collected while the catalog changes, sent once the snapshot is published
+	TArray<FHdriVaultItemHandle> PendingAddedItems;
+	TArray<FHdriVaultItemHandle> PendingRemovedItems;
+	TArray<TPair<FHdriVaultItemHandle, EHdriVaultItemChange>> PendingChangedItems;
+	
+	// Set while the folder tree is rebuilt from scratch; per-folder notifications are skipped
+	bool bRebuildingFolders = false;
 	
 	bool bIsInitialized = false;
 }; 
\ No newline at end of file
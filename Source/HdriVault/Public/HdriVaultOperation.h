@@ -0,0 +1,69 @@
+// Copyright Pyre Labs 2025. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Tasks/Task.h"
+#include "HAL/CriticalSection.h"
+#include <atomic>
+
+// Outcome of an asynchronous vault operation
+enum class EHdriVaultOperationResult : uint8
+{
+	Pending,
+	Succeeded,
+	Failed,
+	Cancelled
+};
+
+/**
+ * Handle to an asynchronous vault operation.
+ *
+ * Progress, status and cancellation can be read or requested from any thread. Completion triggers a
+ * UE::Tasks event, so other tasks can take the operation as a prerequisite, and then runs any
+ * continuations added with Then on the game thread.
+ */
+class HDRIVAULT_API FHdriVaultOperation : public TSharedFromThis<FHdriVaultOperation, ESPMode::ThreadSafe>
+{
+public:
+	FHdriVaultOperation();
+	~FHdriVaultOperation();
+
+	// Asks the operation to stop; it completes as Cancelled at its next check point
+	void Cancel() { bCancelRequested.store(true, std::memory_order_relaxed); }
+	bool IsCancelRequested() const { return bCancelRequested.load(std::memory_order_relaxed); }
+
+	// Fraction done, 0 to 1, and a short description of the current step
+	float GetProgress() const { return Progress.load(std::memory_order_relaxed); }
+	FText GetStatusText() const;
+
+	EHdriVaultOperationResult GetResult() const { return Result.load(std::memory_order_acquire); }
+	bool IsComplete() const { return GetResult() != EHdriVaultOperationResult::Pending; }
+
+	// Triggered once the operation completes, whatever the result
+	const UE::Tasks::FTaskEvent& GetCompletionEvent() const { return CompletionEvent; }
+
+	// Runs Continuation on completion, or right away if already complete. Game thread only.
+	void Then(TUniqueFunction<void(EHdriVaultOperationResult)>&& Continuation);
+
+	// Called by the operation itself. SetProgress is safe from any thread.
+	void SetProgress(float InProgress);
+	void SetProgress(float InProgress, const FText& InStatusText);
+
+	// Only the first call has any effect. Game thread only.
+	bool Complete(EHdriVaultOperationResult InResult);
+
+private:
+	std::atomic<float> Progress { 0.0f };
+	std::atomic<bool> bCancelRequested { false };
+	std::atomic<EHdriVaultOperationResult> Result { EHdriVaultOperationResult::Pending };
+
+	mutable FCriticalSection StatusLock;
+	FText StatusText;
+
+	UE::Tasks::FTaskEvent CompletionEvent;
+	TArray<TUniqueFunction<void(EHdriVaultOperationResult)>> Continuations;
+};
+
+typedef TSharedRef<FHdriVaultOperation, ESPMode::ThreadSafe> FHdriVaultOperationRef;
+typedef TSharedPtr<FHdriVaultOperation, ESPMode::ThreadSafe> FHdriVaultOperationPtr;
@@ -8,7 +8,9 @@
 #include "Engine/Texture2D.h"
 #include "Slate/SlateGameResources.h"
 #include "Brushes/SlateDynamicImageBrush.h"
+#include "Containers/Queue.h"
 #include "HdriVaultTypes.h"
+#include <atomic>
 
 /**
  * Manages thumbnail generation and caching for materials
@@ -37,6 +39,10 @@ public:
 	
 	// Async thumbnail loading
 	void LoadThumbnailAsync(TSharedPtr<FHdriVaultMaterialItem> MaterialItem, int32 ThumbnailSize = 128);
+	void CancelPendingThumbnails();
+	
+	// Generation runs as budgeted game-thread work on this scheduler
+	void SetWorkScheduler(const TSharedPtr<class FHdriVaultWorkScheduler>& InWorkScheduler) { WorkScheduler = InWorkScheduler; }
 	
 	// Settings
 	void SetThumbnailSize(int32 NewSize);
@@ -73,6 +79,29 @@ private:
 	
 	// Async loading
 	TMap<FString, TSharedPtr<FHdriVaultMaterialItem>> PendingThumbnails;
+	TWeakPtr<class FHdriVaultWorkScheduler> WorkScheduler;
+	
+	// A finished load waiting for its thumbnail to be generated on the game thread
+	struct FThumbnailCompletion
+	{
+		FString MaterialPath;
+		TWeakObjectPtr<UObject> Asset;
+		int32 ThumbnailSize = 128;
+	};
+	
+	// Loaded assets are queued here from any thread and drained in batches by a single scheduled work item.
+	// Callbacks only hold a weak reference, so anything arriving after Shutdown is dropped.
+	struct FCompletionQueue
+	{
+		TQueue<FThumbnailCompletion, EQueueMode::Mpsc> Queue;
+		std::atomic<bool> bDrainScheduled { false };
+	};
+	TSharedPtr<FCompletionQueue, ESPMode::ThreadSafe> Completions;
+	
+	void QueueCompletion(FThumbnailCompletion&& Completion);
+	void ScheduleCompletionDrain();
+	void DrainCompletions(double Deadline);
+	void ProcessCompletion(const FThumbnailCompletion& Completion);
 	
 	// Helper functions
 	FString GetCacheKey(const FString& MaterialPath, int32 ThumbnailSize) const;
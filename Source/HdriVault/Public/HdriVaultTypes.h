@@ -9,6 +9,7 @@
 #include "Containers/Array.h"
 #include "Containers/Map.h"
 #include "UObject/SoftObjectPath.h"
+#include "Misc/PackageName.h"
 #include "HdriVaultTypes.generated.h"
 
 USTRUCT()
@@ -19,9 +20,6 @@ struct HDRIVAULT_API FHdriVaultMetadata
 	UPROPERTY()
 	FString MaterialName;
 
-	UPROPERTY()
-	FString Location;
-
 	UPROPERTY()
 	FString Author;
 
@@ -40,28 +38,64 @@ struct HDRIVAULT_API FHdriVaultMetadata
 	UPROPERTY()
 	FString CustomThumbnailPath;
 
+	/** Size of the long-lat image the cubemap was imported from; zero when unknown */
+	UPROPERTY()
+	int32 SourceWidth;
+
+	UPROPERTY()
+	int32 SourceHeight;
+
 	FHdriVaultMetadata()
 		: MaterialName(TEXT(""))
-		, Location(TEXT(""))
 		, Author(TEXT(""))
 		, LastModified(FDateTime::Now())
 		, Notes(TEXT(""))
 		, Category(TEXT(""))
 		, CustomThumbnailPath(TEXT(""))
+		, SourceWidth(0)
+		, SourceHeight(0)
 	{
 	}
 };
 
+/**
+ * Stable reference to an item in the vault catalog.
+ * Low 24 bits are the slot index, high 8 bits the slot generation so stale handles never alias a reused slot.
+ */
+struct FHdriVaultItemHandle
+{
+	static constexpr uint32 IndexBits = 24;
+	static constexpr uint32 IndexMask = (1u << IndexBits) - 1;
+
+	FHdriVaultItemHandle() = default;
+
+	FHdriVaultItemHandle(uint32 InIndex, uint32 InGeneration)
+		: Value((InGeneration << IndexBits) | (InIndex & IndexMask))
+	{
+	}
+
+	uint32 GetIndex() const { return Value & IndexMask; }
+	uint32 GetGeneration() const { return Value >> IndexBits; }
+
+	// Generations start at 1, so a zero value is never handed out
+	bool IsValid() const { return Value != 0; }
+
+	bool operator==(const FHdriVaultItemHandle& Other) const { return Value == Other.Value; }
+	bool operator!=(const FHdriVaultItemHandle& Other) const { return Value != Other.Value; }
+	bool operator<(const FHdriVaultItemHandle& Other) const { return Value < Other.Value; }
+
+	friend uint32 GetTypeHash(const FHdriVaultItemHandle& Handle) { return Handle.Value; }
+
+	uint32 Value = 0;
+};
+
 USTRUCT()
 struct HDRIVAULT_API FHdriVaultMaterialItem
 {
 	GENERATED_BODY()
 
-	// Asset data
-	UPROPERTY()
-	FAssetData AssetData;
-
-	// Soft reference to the asset (Hdri, Texture, Material)
+	// Soft reference to the asset (Hdri, Texture, Material). Registry data such as sizes and
+	// class names is held once, in the vault catalog's columns, rather than on every item.
 	UPROPERTY()
 	TSoftObjectPtr<UObject> MaterialPtr;
 
@@ -76,12 +110,12 @@ struct HDRIVAULT_API FHdriVaultMaterialItem
 	UPROPERTY()
 	TArray<TSoftObjectPtr<UTexture2D>> TextureDependencies;
 
-	// Display name
-	FString DisplayName;
-
 	// Whether thumbnail is loaded
 	bool bThumbnailLoaded = false;
 
+	// Catalog slot for this item
+	FHdriVaultItemHandle Handle;
+
 	FHdriVaultMaterialItem()
 		: MaterialPtr(nullptr)
 		, ThumbnailBrush(nullptr)
@@ -90,15 +124,21 @@ struct HDRIVAULT_API FHdriVaultMaterialItem
 	}
 
 	FHdriVaultMaterialItem(const FAssetData& InAssetData)
-		: AssetData(InAssetData)
-		, MaterialPtr(InAssetData.ToSoftObjectPath())
+		: MaterialPtr(InAssetData.ToSoftObjectPath())
 		, ThumbnailBrush(nullptr)
 		, bThumbnailLoaded(false)
 	{
-		DisplayName = AssetData.AssetName.ToString();
-		Metadata.MaterialName = DisplayName;
-		Metadata.Location = AssetData.PackageName.ToString();
+		Metadata.MaterialName = InAssetData.AssetName.ToString();
 	}
+
+	// The display name comes from the metadata name when one is set; everything else derives from the object path
+	FSoftObjectPath GetObjectPath() const { return MaterialPtr.ToSoftObjectPath(); }
+	FString GetDisplayName() const { return Metadata.MaterialName.IsEmpty() ? MaterialPtr.GetAssetName() : Metadata.MaterialName; }
+	FString GetPackageName() const { return MaterialPtr.GetLongPackageName(); }
+	FString GetPackagePath() const { return FPackageName::GetLongPackagePath(MaterialPtr.GetLongPackageName()); }
+
+	// Looks the asset up in the registry; meant for a single item in the UI, not for loops over the vault
+	FAssetData GetAssetData() const;
 };
 
 USTRUCT()
@@ -119,7 +159,7 @@ struct HDRIVAULT_API FHdriVaultFolderNode
 	TArray<TSharedPtr<FHdriVaultFolderNode>> Children;
 
 	// Materials in this folder
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> Materials;
+	TArray<FHdriVaultItemHandle> Materials;
 
 	// Whether this folder is expanded in the tree
 	bool bIsExpanded = false;
@@ -141,6 +181,18 @@ struct HDRIVAULT_API FHdriVaultFolderNode
 	}
 };
 
+/** Parts of a vault item reported by FOnHdriVaultItemsChanged */
+enum class EHdriVaultItemChange : uint8
+{
+	None = 0,
+	Asset = 1 << 0,		// Asset data or display name
+	Metadata = 1 << 1,	// Any metadata field
+	Tags = 1 << 2,
+	Category = 1 << 3,
+	Thumbnail = 1 << 4
+};
+ENUM_CLASS_FLAGS(EHdriVaultItemChange);
+
 UENUM()
 enum class EHdriVaultViewMode : uint8
 {
@@ -154,7 +206,8 @@ enum class EHdriVaultSortMode : uint8
 	Name,
 	DateModified,
 	Size,
-	Type
+	Type,
+	Category
 };
 
 USTRUCT()
@@ -168,6 +221,10 @@ struct HDRIVAULT_API FHdriVaultSettings
 	UPROPERTY()
 	EHdriVaultSortMode SortMode = EHdriVaultSortMode::Name;
 
+	// Breaks ties left by SortMode, e.g. Category then Size
+	UPROPERTY()
+	EHdriVaultSortMode SecondarySortMode = EHdriVaultSortMode::Name;
+
 	UPROPERTY()
 	float ThumbnailSize = 128.0f;
 
@@ -180,6 +237,14 @@ struct HDRIVAULT_API FHdriVaultSettings
 	UPROPERTY()
 	FString RootFolder = TEXT("/Game");
 
+	// Package paths or mount points scanned (recursively) for HDRIs. Empty scans RootFolder only; "/" scans everything.
+	UPROPERTY()
+	TArray<FString> ScanIncludePaths;
+
+	// Package paths or mount points skipped even when they sit under an included path
+	UPROPERTY()
+	TArray<FString> ScanExcludePaths;
+
 	UPROPERTY()
 	bool bAutoRefresh = true;
 
@@ -192,4 +257,9 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultFolderSelected, TSharedPtr<FHdri
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultMaterialSelected, TSharedPtr<FHdriVaultMaterialItem>);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultMaterialDoubleClicked, TSharedPtr<FHdriVaultMaterialItem>);
 DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultSettingsChanged, const FHdriVaultSettings&);
-DECLARE_MULTICAST_DELEGATE(FOnHdriVaultRefreshRequested); 
\ No newline at end of file
+DECLARE_MULTICAST_DELEGATE(FOnHdriVaultRefreshRequested);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultItemsAdded, const TArray<FHdriVaultItemHandle>&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultItemsRemoved, const TArray<FHdriVaultItemHandle>&);
+DECLARE_MULTICAST_DELEGATE_TwoParams(FOnHdriVaultItemsChanged, const TArray<FHdriVaultItemHandle>&, EHdriVaultItemChange);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultFolderAdded, TSharedPtr<FHdriVaultFolderNode>);
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnHdriVaultFolderRemoved, TSharedPtr<FHdriVaultFolderNode>);
@@ -21,7 +21,7 @@ class UHdriVaultManager;
 struct FHdriVaultCategoryItem
 {
 	FString CategoryName;
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> Materials;
+	TArray<FHdriVaultItemHandle> Materials;
 	TArray<TSharedPtr<FHdriVaultCategoryItem>> Children;
 	TSharedPtr<FHdriVaultCategoryItem> Parent;
 	bool bIsExpanded = false;
@@ -85,6 +85,10 @@ public:
 	
 	FOnCategorySelected OnCategorySelected;
 	FOnTagSelected OnTagSelected;
+	
+	// Fired when materials move into or out of an existing category
+	DECLARE_DELEGATE_OneParam(FOnCategoryContentsChanged, TSharedPtr<FHdriVaultCategoryItem>);
+	FOnCategoryContentsChanged OnCategoryContentsChanged;
 
 private:
 	// Tree view
@@ -97,6 +101,11 @@ private:
 	TArray<TSharedPtr<FHdriVaultCategoryItem>> RootCategories;
 	TArray<TSharedPtr<FHdriVaultCategoryItem>> FilteredCategories;
 	TSharedPtr<FHdriVaultCategoryItem> SelectedCategory;
+	TSharedPtr<FHdriVaultCategoryItem> AllCategory;
+	TSharedPtr<FHdriVaultCategoryItem> UncategorizedCategory;
+	
+	// Category each material is currently listed under
+	TMap<FHdriVaultItemHandle, TSharedPtr<FHdriVaultCategoryItem>> MaterialCategories;
 	
 	// Tags data
 	TArray<TSharedPtr<FString>> AllTags;
@@ -121,11 +130,20 @@ private:
 	// Category building
 	void BuildCategoryStructure();
 	TSharedPtr<FHdriVaultCategoryItem> GetOrCreateCategory(const FString& CategoryName);
-	void AddMaterialToCategory(TSharedPtr<FHdriVaultMaterialItem> Material, const FString& CategoryName);
+	void AddMaterialToCategory(FHdriVaultItemHandle Material, const FString& CategoryName);
+	TSharedPtr<FHdriVaultCategoryItem> InsertMaterial(FHdriVaultItemHandle Material);
+	TSharedPtr<FHdriVaultCategoryItem> RemoveMaterial(FHdriVaultItemHandle Material);
+	void SortCategories();
+	void CommitCategoryChanges(const TSet<TSharedPtr<FHdriVaultCategoryItem>>& ChangedCategories);
+	
+	// Manager event handlers
+	void OnManagerItemsAdded(const TArray<FHdriVaultItemHandle>& Items);
+	void OnManagerItemsRemoved(const TArray<FHdriVaultItemHandle>& Items);
+	void OnManagerItemsChanged(const TArray<FHdriVaultItemHandle>& Items, EHdriVaultItemChange Change);
 	
 	// Category operations
 	void OnDeleteCategory(TSharedPtr<FHdriVaultCategoryItem> CategoryToDelete);
-	void DeleteCategoryRecursive(TSharedPtr<FHdriVaultCategoryItem> Category);
+	void DeleteCategoryRecursive(TSharedPtr<FHdriVaultCategoryItem> Category, TArray<FHdriVaultItemHandle>& OutChangedMaterials);
 
 	// UI creation
 	TSharedRef<SWidget> CreateTagsPanel();
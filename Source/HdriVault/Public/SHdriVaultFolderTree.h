@@ -95,6 +95,8 @@ private:
 	
 	// Manager event handlers
 	void OnManagerRefreshRequested();
+	void OnManagerFolderAdded(TSharedPtr<FHdriVaultFolderNode> Folder);
+	void OnManagerFolderRemoved(TSharedPtr<FHdriVaultFolderNode> Folder);
 	
 	// Filter support
 	FString CurrentFilterText;
@@ -12,6 +12,8 @@
 
 class SHdriVaultTagEditor;
 class IDetailsView;
+class FHdriVaultImportPrefetch;
+struct FSlateDynamicImageBrush;
 
 // UObject wrapper to allow utilizing the Property Editor with ContentDir metadata
 UCLASS()
@@ -32,14 +34,22 @@ struct FHdriVaultImportOptions
 	FString Author;
 	TArray<FString> Tags;
 	FString Notes;
+
+	// Conversions already started while the dialog was open, if any
+	TSharedPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe> Prefetch;
 };
 
+DECLARE_DELEGATE_OneParam(FOnHdriVaultImportConfirmed, const FHdriVaultImportOptions&);
+
 class SHdriVaultImportDialog : public SCompoundWidget
 {
 public:
 	SLATE_BEGIN_ARGS(SHdriVaultImportDialog) {}
 		SLATE_ARGUMENT(TArray<FString>, Files)
 		SLATE_ARGUMENT(TSharedPtr<SWindow>, ParentWindow)
+		SLATE_ARGUMENT(TSharedPtr<FHdriVaultImportPrefetch, ESPMode::ThreadSafe>, Prefetch)
+		// Fired when Import is clicked, before the window closes
+		SLATE_EVENT(FOnHdriVaultImportConfirmed, OnImport)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs);
@@ -52,12 +62,13 @@ private:
 	FHdriVaultImportOptions Options;
 	bool bShouldImport;
 	TSharedPtr<SWindow> ParentWindow;
+	FOnHdriVaultImportConfirmed OnImport;
 
 	// Data object for property editor
 	UHdriVaultImportSettings* ImportSettingsObject;
 
 	// UI Components
-	TArray<TSharedPtr<FString>> FileList;
+	TArray<TSharedPtr<FString>> FileList; // Full source paths
 	TSharedPtr<SListView<TSharedPtr<FString>>> FileListView;
 	TSharedPtr<IDetailsView> DestinationPathDetailsView;
 	TSharedPtr<SEditableTextBox> CategoryBox;
@@ -65,8 +76,13 @@ private:
 	TSharedPtr<SHdriVaultTagEditor> TagEditor;
 	TSharedPtr<SMultiLineEditableTextBox> NotesBox;
 
+	// Preview brushes by source path, made once each file's preview is available
+	mutable TMap<FString, TSharedPtr<FSlateDynamicImageBrush>> PreviewBrushes;
+
 	// Callbacks
 	TSharedRef<ITableRow> OnGenerateFileRow(TSharedPtr<FString> Item, const TSharedRef<STableViewBase>& OwnerTable);
+	FText GetFileInfoText(TSharedPtr<FString> Item) const;
+	const FSlateBrush* GetFilePreviewBrush(TSharedPtr<FString> Item) const;
 	FReply OnImportClicked();
 	FReply OnCancelClicked();
 
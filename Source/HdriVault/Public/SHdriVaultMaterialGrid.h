@@ -8,6 +8,7 @@
 #include "Widgets/Views/SListView.h"
 #include "Widgets/Views/STableViewBase.h"
 #include "Widgets/Views/STableRow.h"
+#include "Widgets/Views/TableViewTypeTraits.h"
 #include "Widgets/Layout/SBorder.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Widgets/Images/SImage.h"
@@ -18,15 +19,53 @@
 #include "HdriVaultTypes.h"
 
 class UHdriVaultManager;
+class FHdriVaultAsyncSearch;
+
+/**
+ * Lets the grid's views list catalog handles directly; an invalid handle is the null item
+ */
+template <>
+struct TListTypeTraits<FHdriVaultItemHandle>
+{
+	typedef FHdriVaultItemHandle NullableType;
+
+	using MapKeyFuncs = TDefaultMapHashableKeyFuncs<FHdriVaultItemHandle, TSharedRef<ITableRow>, false>;
+	using MapKeyFuncsSparse = TDefaultMapHashableKeyFuncs<FHdriVaultItemHandle, FSparseItemInfo, false>;
+	using SetKeyFuncs = DefaultKeyFuncs<FHdriVaultItemHandle>;
+
+	template<typename U>
+	static void AddReferencedObjects(FReferenceCollector&, TArray<FHdriVaultItemHandle>&, TSet<FHdriVaultItemHandle>&, TMap<const U*, FHdriVaultItemHandle>&)
+	{
+	}
+
+	static bool IsPtrValid(const FHdriVaultItemHandle& InHandle) { return InHandle.IsValid(); }
+	static void ResetPtr(FHdriVaultItemHandle& InHandle) { InHandle = FHdriVaultItemHandle(); }
+	static FHdriVaultItemHandle MakeNullPtr() { return FHdriVaultItemHandle(); }
+	static FHdriVaultItemHandle NullableItemTypeConvertToItemType(const FHdriVaultItemHandle& InHandle) { return InHandle; }
+	static FString DebugDump(FHdriVaultItemHandle InHandle) { return FString::Printf(TEXT("0x%08x"), InHandle.Value); }
+
+	class SerializerType {};
+};
+
+template <>
+struct TIsValidListItem<FHdriVaultItemHandle>
+{
+	enum
+	{
+		Value = true
+	};
+};
 
 /**
  * Tile widget for material items in grid view
  */
-class SHdriVaultMaterialTile : public STableRow<TSharedPtr<FHdriVaultMaterialItem>>
+class SHdriVaultMaterialTile : public STableRow<FHdriVaultItemHandle>
 {
 public:
 	SLATE_BEGIN_ARGS(SHdriVaultMaterialTile) {}
-		SLATE_ARGUMENT(TSharedPtr<FHdriVaultMaterialItem>, MaterialItem)
+		SLATE_ARGUMENT(FHdriVaultItemHandle, Handle)
+		SLATE_ARGUMENT(FAssetData, AssetData)
+		SLATE_ARGUMENT(FString, DisplayName)
 		SLATE_ARGUMENT(float, ThumbnailSize)
 	SLATE_END_ARGS()
 
@@ -41,9 +80,9 @@ public:
 	virtual FReply OnDragDetected(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 
 	// Delegates
-	DECLARE_DELEGATE_OneParam(FOnMaterialClicked, TSharedPtr<FHdriVaultMaterialItem>);
-	DECLARE_DELEGATE_OneParam(FOnMaterialDoubleClicked, TSharedPtr<FHdriVaultMaterialItem>);
-	DECLARE_DELEGATE_RetVal_ThreeParams(FReply, FOnMaterialDragDetected, TSharedPtr<FHdriVaultMaterialItem>, const FGeometry&, const FPointerEvent&);
+	DECLARE_DELEGATE_OneParam(FOnMaterialClicked, FHdriVaultItemHandle);
+	DECLARE_DELEGATE_OneParam(FOnMaterialDoubleClicked, FHdriVaultItemHandle);
+	DECLARE_DELEGATE_RetVal_ThreeParams(FReply, FOnMaterialDragDetected, FHdriVaultItemHandle, const FGeometry&, const FPointerEvent&);
 	
 	FOnMaterialClicked OnMaterialLeftClicked;
 	FOnMaterialClicked OnMaterialRightClicked;
@@ -51,8 +90,16 @@ public:
 	FOnMaterialDoubleClicked OnMaterialDoubleClicked;
 	FOnMaterialDragDetected OnMaterialDragDetected;
 
+	// Re-renders the thumbnail after it changed on the asset
+	void RefreshThumbnail();
+	void SetAssetData(const FAssetData& InAssetData);
+	void SetDisplayName(const FString& InDisplayName) { DisplayName = InDisplayName; }
+
 private:
-	TSharedPtr<FHdriVaultMaterialItem> MaterialItem;
+	// Looked up once when the row is generated; the grid itself only holds handles
+	FHdriVaultItemHandle Handle;
+	FAssetData AssetData;
+	FString DisplayName;
 	TSharedPtr<FAssetThumbnail> AssetThumbnail;
 	float ThumbnailSize;
 
@@ -60,19 +107,18 @@ private:
 	FText GetMaterialName() const;
 	FText GetMaterialTooltip() const;
 	EVisibility GetLoadingVisibility() const;
-	
-	// Thumbnail helpers
-	void RefreshThumbnail();
 };
 
 /**
  * List row widget for material items in list view
  */
-class SHdriVaultMaterialListItem : public STableRow<TSharedPtr<FHdriVaultMaterialItem>>
+class SHdriVaultMaterialListItem : public STableRow<FHdriVaultItemHandle>
 {
 public:
 	SLATE_BEGIN_ARGS(SHdriVaultMaterialListItem) {}
-		SLATE_ARGUMENT(TSharedPtr<FHdriVaultMaterialItem>, MaterialItem)
+		SLATE_ARGUMENT(FHdriVaultItemHandle, Handle)
+		SLATE_ARGUMENT(FAssetData, AssetData)
+		SLATE_ARGUMENT(FString, DisplayName)
 	SLATE_END_ARGS()
 
 	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTableView);
@@ -83,16 +129,20 @@ public:
 	virtual FReply OnDragDetected(const FGeometry& MyGeometry, const FPointerEvent& MouseEvent) override;
 
 	// Delegates
-	DECLARE_DELEGATE_OneParam(FOnMaterialClicked, TSharedPtr<FHdriVaultMaterialItem>);
-	DECLARE_DELEGATE_OneParam(FOnMaterialDoubleClicked, TSharedPtr<FHdriVaultMaterialItem>);
-	
-	FOnMaterialClicked OnMaterialLeftClicked;
-	FOnMaterialClicked OnMaterialRightClicked;
-	FOnMaterialDoubleClicked OnMaterialDoubleClicked;
+	SHdriVaultMaterialTile::FOnMaterialClicked OnMaterialLeftClicked;
+	SHdriVaultMaterialTile::FOnMaterialClicked OnMaterialRightClicked;
+	SHdriVaultMaterialTile::FOnMaterialDoubleClicked OnMaterialDoubleClicked;
 	SHdriVaultMaterialTile::FOnMaterialDragDetected OnMaterialDragDetected;
 
+	// Re-renders the thumbnail after it changed on the asset
+	void RefreshThumbnail();
+	void SetAssetData(const FAssetData& InAssetData);
+	void SetDisplayName(const FString& InDisplayName) { DisplayName = InDisplayName; }
+
 private:
-	TSharedPtr<FHdriVaultMaterialItem> MaterialItem;
+	FHdriVaultItemHandle Handle;
+	FAssetData AssetData;
+	FString DisplayName;
 	TSharedPtr<FAssetThumbnail> AssetThumbnail;
 
 	// UI helpers
@@ -121,9 +171,11 @@ public:
 
 	// Public interface
 	void RefreshGrid();
-	void SetMaterials(const TArray<TSharedPtr<FHdriVaultMaterialItem>>& InMaterials);
-	void SetSelectedMaterial(TSharedPtr<FHdriVaultMaterialItem> Material);
+	void SetMaterials(const TArray<FHdriVaultItemHandle>& InMaterials);
+	void SetMaterials(TSharedRef<const TArray<FHdriVaultItemHandle>> InMaterials);
+	void SetSelectedMaterial(FHdriVaultItemHandle Material);
 	TSharedPtr<FHdriVaultMaterialItem> GetSelectedMaterial() const;
+	bool ContainsMaterial(FHdriVaultItemHandle Material) const;
 	void SetViewMode(EHdriVaultViewMode InViewMode);
 	void SetThumbnailSize(float InThumbnailSize);
 	void ClearSelection();
@@ -144,20 +196,24 @@ public:
 
 private:
 	// View widgets
-	TSharedPtr<STileView<TSharedPtr<FHdriVaultMaterialItem>>> TileView;
-	TSharedPtr<SListView<TSharedPtr<FHdriVaultMaterialItem>>> ListView;
+	TSharedPtr<STileView<FHdriVaultItemHandle>> TileView;
+	TSharedPtr<SListView<FHdriVaultItemHandle>> ListView;
 	TSharedPtr<SBorder> ViewContainer;
 
-	// Data
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> AllMaterials;
-	TArray<TSharedPtr<FHdriVaultMaterialItem>> FilteredMaterials;
-	TSharedPtr<FHdriVaultMaterialItem> SelectedMaterial;
+	// Data; items are resolved through the manager only where a row or action needs them
+	TSharedRef<const TArray<FHdriVaultItemHandle>> AllMaterials = MakeShared<TArray<FHdriVaultItemHandle>>();
+	uint64 CandidateSetId = 0; // Bumped whenever AllMaterials is replaced
+	TArray<FHdriVaultItemHandle> FilteredMaterials;
+	FHdriVaultItemHandle SelectedMaterial;
 
 	// Settings
 	EHdriVaultViewMode ViewMode;
 	float ThumbnailSize;
 	FString CurrentFilterText;
 
+	// Background search; matches stream into FilteredMaterials as they arrive
+	TSharedPtr<FHdriVaultAsyncSearch> AsyncSearch;
+
 	// Manager reference
 	UHdriVaultManager* HdriVaultManager;
 
@@ -170,20 +226,20 @@ private:
 	void SwitchToViewMode(EHdriVaultViewMode NewViewMode);
 
 	// Tile view callbacks
-	TSharedRef<ITableRow> OnGenerateTileWidget(TSharedPtr<FHdriVaultMaterialItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
-	void OnTileSelectionChanged(TSharedPtr<FHdriVaultMaterialItem> SelectedItem, ESelectInfo::Type SelectInfo);
+	TSharedRef<ITableRow> OnGenerateTileWidget(FHdriVaultItemHandle Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnTileSelectionChanged(FHdriVaultItemHandle SelectedItem, ESelectInfo::Type SelectInfo);
 	
 	// List view callbacks
-	TSharedRef<ITableRow> OnGenerateListWidget(TSharedPtr<FHdriVaultMaterialItem> Item, const TSharedRef<STableViewBase>& OwnerTable);
-	void OnListSelectionChanged(TSharedPtr<FHdriVaultMaterialItem> SelectedItem, ESelectInfo::Type SelectInfo);
+	TSharedRef<ITableRow> OnGenerateListWidget(FHdriVaultItemHandle Item, const TSharedRef<STableViewBase>& OwnerTable);
+	void OnListSelectionChanged(FHdriVaultItemHandle SelectedItem, ESelectInfo::Type SelectInfo);
 
 	// Material interaction callbacks
-	void OnMaterialLeftClicked(TSharedPtr<FHdriVaultMaterialItem> Material);
-	void OnMaterialRightClicked(TSharedPtr<FHdriVaultMaterialItem> Material);
-	void OnMaterialMiddleClicked(TSharedPtr<FHdriVaultMaterialItem> Material);
-	void OnMaterialDoubleClickedInternal(TSharedPtr<FHdriVaultMaterialItem> Material);
-	FReply HandleMaterialDragDetected(TSharedPtr<FHdriVaultMaterialItem> Material, const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
-	void GatherDragMaterials(TArray<TSharedPtr<FHdriVaultMaterialItem>>& OutMaterials, TSharedPtr<FHdriVaultMaterialItem> PrimaryItem) const;
+	void OnMaterialLeftClicked(FHdriVaultItemHandle Material);
+	void OnMaterialRightClicked(FHdriVaultItemHandle Material);
+	void OnMaterialMiddleClicked(FHdriVaultItemHandle Material);
+	void OnMaterialDoubleClickedInternal(FHdriVaultItemHandle Material);
+	FReply HandleMaterialDragDetected(FHdriVaultItemHandle Material, const FGeometry& MyGeometry, const FPointerEvent& MouseEvent);
+	void GatherDragMaterials(TArray<FHdriVaultItemHandle>& OutMaterials, FHdriVaultItemHandle PrimaryItem) const;
 
 	// Context menu
 	TSharedPtr<SWidget> OnContextMenuOpening();
@@ -194,10 +250,16 @@ private:
 
 	// Filtering
 	void UpdateFilteredMaterials();
-	bool DoesItemPassFilter(TSharedPtr<FHdriVaultMaterialItem> Item) const;
+	void OnSearchResults(TConstArrayView<int32> CandidateIndices);
+	void OnSearchFinished();
+
+	// Manager event handlers
+	void OnManagerItemsChanged(const TArray<FHdriVaultItemHandle>& Items, EHdriVaultItemChange Change);
+	void RequestViewRefresh();
 
 	// Helper functions
-	void UpdateSelection(TSharedPtr<FHdriVaultMaterialItem> NewSelection);
-	void ScrollToMaterial(TSharedPtr<FHdriVaultMaterialItem> Material);
+	void UpdateSelection(FHdriVaultItemHandle NewSelection);
+	void ScrollToMaterial(FHdriVaultItemHandle Material);
+	TSharedPtr<FHdriVaultMaterialItem> ResolveMaterial(FHdriVaultItemHandle Material) const;
 	FText GetStatusText() const;
 }; 
\ No newline at end of file
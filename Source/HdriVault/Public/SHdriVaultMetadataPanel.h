@@ -148,8 +148,9 @@ public:
 	FOnMetadataChanged OnMetadataChanged;
 
 private:
-	// Current material
+	// Current material, with its registry data looked up once on selection
 	TSharedPtr<FHdriVaultMaterialItem> MaterialItem;
+	FAssetData MaterialAssetData;
 	
 	// Manager reference
 	UHdriVaultManager* HdriVaultManager;
@@ -55,6 +55,7 @@ private:
 	TSharedPtr<SSplitter> ContentSplitter;
 	TSharedPtr<SButton> FoldersTabButton;
 	TSharedPtr<SButton> CategoriesTabButton;
+	TSharedPtr<SSearchBox> SearchBox;
 
 	// Event handlers
 	void OnFolderSelected(TSharedPtr<FHdriVaultFolderNode> SelectedFolder);
@@ -63,9 +64,12 @@ private:
 	void OnMaterialSelected(TSharedPtr<FHdriVaultMaterialItem> SelectedMaterial);
 	void OnMaterialDoubleClicked(TSharedPtr<FHdriVaultMaterialItem> SelectedMaterial);
 	void OnMaterialApplied(TSharedPtr<FHdriVaultMaterialItem> MaterialToApply);
-	void OnMetadataChanged(TSharedPtr<FHdriVaultMaterialItem> ChangedMaterial);
 	void OnSettingsChanged(const FHdriVaultSettings& NewSettings);
 	void OnRefreshRequested();
+	void OnItemsAdded(const TArray<FHdriVaultItemHandle>& Items);
+	void OnItemsRemoved(const TArray<FHdriVaultItemHandle>& Items);
+	void OnItemsChanged(const TArray<FHdriVaultItemHandle>& Items, EHdriVaultItemChange Change);
+	void OnCategoryContentsChanged(TSharedPtr<struct FHdriVaultCategoryItem> Category);
 
 	// Toolbar event handlers
 	FReply OnRefreshClicked();
@@ -90,6 +94,7 @@ private:
 	FString CurrentSearchText;
 	bool bShowFolders = false;
 	bool bIsUpdatingView = false; // Flag to prevent selection clearing during view updates
+	bool bMaterialGridDirty = false; // The visible set changed; reloaded once on the next tick
 
 	// Manager reference
 	UHdriVaultManager* HdriVaultManager;
@@ -102,6 +107,7 @@ private:
 	TSharedRef<SWidget> CreateMetadataPanel();
 
 	// Utility functions
+	bool DoesViewContain(FHdriVaultItemHandle Material) const;
 	void UpdateMaterialGrid();
 	void UpdateMaterialGridFromCategory();
 	void UpdateMaterialGridFromTag(); // Update grid for tag filtering